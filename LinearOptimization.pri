@@ -0,0 +1,69 @@
+#-------------------------------------------------------------------------------
+#
+# Settings shared by the GUI and the command-line targets
+#
+#-------------------------------------------------------------------------------
+
+CONFIG += c++14 thread warn_on no_keywords
+
+QMAKE_CXX = ccache g++
+
+CONFIG(release, release|debug) {
+  message("Using `release' config")
+  QMAKE_CXXFLAGS_RELEASE += -O3 -mtune=generic
+} else {
+  message("Using `debug' config")
+  QMAKE_CXXFLAGS_DEBUG += -O0 -march=native
+}
+
+equals(QT_ARCH, x86_64) {
+  message("Building for `x86_64' target arch")
+  QMAKE_CXXFLAGS += -m64 -mno-fp-ret-in-387
+} else {
+  equals(QT_ARCH, i386) {
+    message("Building for `i386' target arch")
+    QMAKE_CXXFLAGS += -m32
+  }
+}
+
+QMAKE_CXXFLAGS += \
+  -msse -msse2 -mfpmath=sse \
+  -mieee-fp -mno-fancy-math-387 -malign-double \
+  -ffp-contract=off -ffloat-store -frounding-math -fsignaling-nans
+
+QMAKE_CXXFLAGS_WARN_ON += \
+  -fdiagnostics-color=auto \
+  -Wpedantic -Wall -Wextra -Wdouble-promotion -Wformat
+
+QMAKE_EXT_CPP += cxx
+
+QMAKE_EXT_H += hxx txx
+
+## NOTE: Temporarily disabled
+#CONFIG(release, debug|release) {
+#  DEFINES += QT_NO_DEBUG_OUTPUT QT_NO_INFO_OUTPUT QT_NO_WARNING_OUTPUT
+#}
+
+## NOTE: This quickly resolves many problems when targeting `i386' arch,
+## but can (and will) lead to the performance degradation. For the reference see:
+## `http://eigen.tuxfamily.org/dox-devel/group__TopicUnalignedArrayAssert.html'
+equals(QT_ARCH, i386) {
+#  DEFINES += EIGEN_DONT_ALIGN_STATICALLY
+  DEFINES += EIGEN_DONT_VECTORIZE EIGEN_DISABLE_UNALIGNED_ARRAY_ASSERT
+}
+
+DEFINES += \
+  EIGEN_MPL2_ONLY \
+  FMT_HEADER_ONLY \
+  LP_WITH_BLAND_RULE
+
+#DEFINES += LP_WITH_MULTIPRECISION #TODO: ~! Not yet implemented.
+
+INCLUDEPATH += \
+  $$PWD/lib/boost \
+  $$PWD/lib/cxx-prettyprint \
+  $$PWD/lib/eigen3 \
+  $$PWD/lib/fmt
+
+## NOTE: Disabled due to `FMT_HEADER_ONLY' presence
+#LIBS += -L$$PWD/lib/fmt/build -lcppformat
@@ -0,0 +1,56 @@
+#-------------------------------------------------------------------------------
+#
+# Command-line solver: reads the programs, writes the solutions
+# as JSON Lines to the standard output. Links QtCore only.
+#
+#-------------------------------------------------------------------------------
+
+QT = core
+
+include($$PWD/LinearOptimization.pri)
+include($$PWD/LinearOptimizationCore.pri)
+
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = lpsolve
+
+TEMPLATE = app
+
+VERSION = 0.0.1
+
+## NOTE: Keeps all the targets buildable from the same directory
+MAKEFILE = Makefile.Cli
+OBJECTS_DIR = obj-cli
+
+#DEFINES += LP_TEST_MODE
+
+## NOTE: Qt's own zlib (the bundled or the system one, whichever Qt uses)
+QT += zlib-private
+
+SOURCES += \
+  src/cli/main.cxx \
+  src/cli/solvedaemon.cxx \
+  src/io/binaryprogram.cxx \
+  src/io/compressedstreambuffer.cxx \
+  src/io/ijsonhandler.cxx \
+  src/io/jsonparser.cxx \
+  src/io/jsonreader.cxx \
+  src/io/mappedfile.cxx \
+  src/io/parseerror.cxx \
+  src/io/programfile.cxx \
+  src/io/solutionwriter.cxx \
+  src/misc/processpool.cxx \
+  src/test/benchmark.cxx \
+  src/test/clitest.cxx \
+  src/test/iotest.cxx \
+  src/test/test.cxx
+
+HEADERS += \
+  src/cli/solvedaemon.hxx \
+  src/globaldefinitions.hxx \
+  src/misc/processpool.hxx \
+  src/test/benchmark.hxx \
+  src/test/clitest.hxx \
+  src/test/iotest.hxx \
+  src/test/test.hxx
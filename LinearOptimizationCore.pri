@@ -0,0 +1,111 @@
+#-------------------------------------------------------------------------------
+#
+# Solver core: `src/lp', `src/math' and the Qt-free bits of `src/misc'.
+# Templates are instantiated for `real_t' and `rational_t' in the `.cxx'
+# files below, the headers only declare these instantiations.
+#
+#-------------------------------------------------------------------------------
+
+SOURCES += \
+  src/lp/basiscache.cxx \
+  src/lp/batchsolver.cxx \
+  src/lp/boundedprogramdata.cxx \
+  src/lp/boundedsimplexsolver.cxx \
+  src/lp/columngenerator.cxx \
+  src/lp/cycledetector.cxx \
+  src/lp/generalprogramdata.cxx \
+  src/lp/graphicalsolver2d.cxx \
+  src/lp/linearprogramdata.cxx \
+  src/lp/linearprogrammingutils.cxx \
+  src/lp/linearprogramsolution.cxx \
+  src/lp/multirhssolver.cxx \
+  src/lp/packedsimplexsolver.cxx \
+  src/lp/parametricsolution.cxx \
+  src/lp/parametricsolver.cxx \
+  src/lp/plotdata2d.cxx \
+  src/lp/sensitivityanalysis.cxx \
+  src/lp/simplexsolver.cxx \
+  src/lp/simplextableau.cxx \
+  src/lp/simplexworkspace.cxx \
+  src/lp/solutioncache.cxx \
+  src/misc/hasher.cxx \
+  src/misc/logsink.cxx \
+  src/misc/threadpool.cxx
+
+HEADERS += \
+  src/config.hxx \
+  src/lp/basiscache.hxx \
+  src/lp/basiscache.txx \
+  src/lp/batchsolver.hxx \
+  src/lp/batchsolver.txx \
+  src/lp/boundedprogramdata.hxx \
+  src/lp/boundedprogramdata.txx \
+  src/lp/boundedsimplexsolver.hxx \
+  src/lp/boundedsimplexsolver.txx \
+  src/lp/columngenerator.hxx \
+  src/lp/columngenerator.txx \
+  src/lp/columngenerator_fwd.hxx \
+  src/lp/columnmapping.hxx \
+  src/lp/cycledetector.hxx \
+  src/lp/degeneracystrategy.hxx \
+  src/lp/dualizationmode.hxx \
+  src/lp/generalprogramdata.hxx \
+  src/lp/generalprogramdata.txx \
+  src/lp/graphicalsolver2d.hxx \
+  src/lp/graphicalsolver2d.txx \
+  src/lp/isolver.hxx \
+  src/lp/isolver.txx \
+  src/lp/linearfunction.hxx \
+  src/lp/linearprogramdata.hxx \
+  src/lp/linearprogramdata.txx \
+  src/lp/linearprogrammingutils.hxx \
+  src/lp/linearprogrammingutils.txx \
+  src/lp/linearprogramsolution.hxx \
+  src/lp/linearprogramsolution.txx \
+  src/lp/multirhssolution.hxx \
+  src/lp/multirhssolver.hxx \
+  src/lp/multirhssolver.txx \
+  src/lp/multirhssolver_fwd.hxx \
+  src/lp/optimizationgoaltype.hxx \
+  src/lp/packedsimplexsolver.hxx \
+  src/lp/packedsimplexsolver.txx \
+  src/lp/packedsimplexsolver_fwd.hxx \
+  src/lp/parametricsolution.hxx \
+  src/lp/parametricsolution.txx \
+  src/lp/parametricsolver.hxx \
+  src/lp/parametricsolver.txx \
+  src/lp/parametricsolver_fwd.hxx \
+  src/lp/plotdata2d.hxx \
+  src/lp/plotdata2d.txx \
+  src/lp/rowsense.hxx \
+  src/lp/sensitivityanalysis.hxx \
+  src/lp/sensitivityanalysis.txx \
+  src/lp/simplexsolver.hxx \
+  src/lp/simplexsolver.txx \
+  src/lp/simplexsolver_fwd.hxx \
+  src/lp/simplexsolvercontroller.hxx \
+  src/lp/simplexsolvercontroller_fwd.hxx \
+  src/lp/simplexstatistics.hxx \
+  src/lp/simplextableau.hxx \
+  src/lp/simplextableau.txx \
+  src/lp/simplextableau_fwd.hxx \
+  src/lp/simplexworkspace.hxx \
+  src/lp/simplexworkspace.txx \
+  src/lp/solutionphase.hxx \
+  src/lp/solutioncache.hxx \
+  src/lp/solutioncache.txx \
+  src/lp/solutiontype.hxx \
+  src/lp/solvertype.hxx \
+  src/math/mathutils.hxx \
+  src/math/mathutils.txx \
+  src/math/numericlimits.hxx \
+  src/math/numericlimits.txx \
+  src/math/numerictypes.hxx \
+  src/misc/boostextensions.hxx \
+  src/misc/eigenextensions.hxx \
+  src/misc/hasher.hxx \
+  src/misc/logsink.hxx \
+  src/misc/lrucache.hxx \
+  src/misc/lrucache.txx \
+  src/misc/threadpool.hxx \
+  src/misc/utils.hxx
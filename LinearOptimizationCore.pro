@@ -0,0 +1,24 @@
+#-------------------------------------------------------------------------------
+#
+# Solver core library: no Qt, to be embedded into other programs.
+# The solvers log through `Utils::setLogSink'.
+#
+#-------------------------------------------------------------------------------
+
+QT =
+
+include($$PWD/LinearOptimization.pri)
+include($$PWD/LinearOptimizationCore.pri)
+
+CONFIG += staticlib
+CONFIG -= qt
+
+TARGET = lpcore
+
+TEMPLATE = lib
+
+VERSION = 0.0.1
+
+## NOTE: Keeps all the targets buildable from the same directory
+MAKEFILE = Makefile.Core
+OBJECTS_DIR = obj-core
@@ -0,0 +1,996 @@
+﻿#include <csignal>
+#include <cstddef>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+
+#include "solvedaemon.hxx"
+#include "../globaldefinitions.hxx"
+#include "../io/importedprogram.hxx"
+#include "../io/jsonreader.hxx"
+#include "../io/numericformat.hxx"
+#include "../io/parseerror.hxx"
+#include "../io/programfile.hxx"
+#include "../io/solutionwriter.hxx"
+#include "../lp/basiscache.hxx"
+#include "../lp/degeneracystrategy.hxx"
+#include "../lp/dualizationmode.hxx"
+#include "../lp/graphicalsolver2d.hxx"
+#include "../lp/linearprogramsolution.hxx"
+#include "../lp/parametricsolver.hxx"
+#include "../lp/simplexsolver.hxx"
+#include "../lp/simplexstatistics.hxx"
+#include "../lp/solutioncache.hxx"
+#include "../lp/solvertype.hxx"
+#include "../math/numerictypes.hxx"
+#include "../misc/logsink.hxx"
+#include "../misc/processpool.hxx"
+#include "../config.hxx"
+
+#ifdef LP_TEST_MODE
+#include "../test/benchmark.hxx"
+#include "../test/clitest.hxx"
+#include "../test/iotest.hxx"
+#include "../test/test.hxx"
+#endif // LP_TEST_MODE
+
+
+namespace
+{
+  using boost::optional;
+  using LinearProgramming::BasisCache;
+  using LinearProgramming::DegeneracyStrategy;
+  using LinearProgramming::DualizationMode;
+  using LinearProgramming::GraphicalSolver2D;
+  using LinearProgramming::LinearProgramSolution;
+  using LinearProgramming::ParametricSolver;
+  using LinearProgramming::SimplexSolver;
+  using LinearProgramming::SimplexStatistics;
+  using LinearProgramming::SolutionCache;
+  using LinearProgramming::SolverType;
+  using NumericTypes::Field;
+  using NumericTypes::rational_t;
+  using NumericTypes::real_t;
+  using ProgramIO::ImportedProgram;
+  using ProgramIO::ParseError;
+  using ProgramIO::SolutionWriter;
+  using std::ostream;
+  using std::size_t;
+  using std::string;
+  using std::vector;
+
+
+  /**
+   * @brief The SolutionMethod enum
+   */
+  enum struct SolutionMethod : int
+  {
+    Simplex = 0,
+    Graphical = 1
+  };
+
+
+  /**
+   * @brief The ExitCode enum
+   */
+  enum struct ExitCode : int
+  {
+    Success = 0,
+    Fail = 1,
+    Usage = 2
+  };
+
+
+  /**
+   * @brief The ParametricSweep struct
+   * The ray to solve the program along (see `ParametricSolver'):
+   * `t' in [lowerParameter; upperParameter] is added to `β[index]'
+   * or `c[index]' of the standard form.
+   */
+  struct ParametricSweep
+  {
+    bool isObjective = false;
+
+    size_t index = 0;
+
+    string lowerParameter;
+
+    string upperParameter;
+  };
+
+
+  /**
+   * @brief The Options struct
+   * Parsed command-line arguments.
+   */
+  struct Options
+  {
+    optional<Field> field;
+
+    SolutionMethod method = SolutionMethod::Simplex;
+
+    bool areNamesWritten = false;
+
+    bool isVerbose = false;
+
+    //Whether the simplex method starts from the cached optimal bases
+    bool isWarmStarted = false;
+
+    DegeneracyStrategy degeneracyStrategy = DegeneracyStrategy::None;
+
+    DualizationMode dualizationMode = DualizationMode::Never;
+
+    //Worker processes count, `0' for the number of the hardware threads,
+    //the programs are solved in this process if it is `none'
+    optional<size_t> processesCount;
+
+    std::chrono::seconds timeout = std::chrono::seconds::zero();
+
+    //Socket to serve the requests on instead of solving the files
+    optional<string> daemonSocketName;
+
+    //Directory of the persistent solution cache, none if it is empty
+    string cacheDirectoryName;
+
+    optional<ParametricSweep> parametricSweep;
+
+    vector<string> fileNames;
+  };
+
+
+  constexpr const char* const StdinFileName = "-";
+
+
+  void
+  printUsage(std::ostream& stream, const char* programName)
+  {
+    stream << "Usage: " << programName << " [options] <file>...\n"
+           << "       " << programName << " [options] --daemon <socket>\n"
+           << "Solves the linear programs and writes the solutions to the "
+              "standard output,\none JSON object per line.\n"
+           << "\n"
+           << "Files can be JSON, MPS (.mps), LP (.lp) or binary (.lpb), "
+              "optionally\ngzip-compressed (.gz). `-' reads JSON from the "
+              "standard input.\n"
+           << "\n"
+           << "Options:\n"
+           << "  -f, --field <real|rational>     "
+              "Number field (default: as declared, or real)\n"
+           << "  -m, --method <simplex|graphical> "
+              "Solution method (default: simplex)\n"
+           << "  -n, --names                     "
+              "Write the names of the variables\n"
+           << "  -v, --verbose                   "
+              "Write the solvers' log to stderr\n"
+           << "  -w, --warm-start                "
+              "Reuse the optimal bases of the same-shaped programs\n"
+           << "  -g, --degeneracy <none|perturbation|lexicographic>\n"
+           << "                                  "
+              "Degeneracy strategy of the simplex method (default: none)\n"
+           << "  -u, --dualize <never|auto|always>\n"
+           << "                                  "
+              "Solve the dual program instead (default: never)\n"
+           << "  -j, --jobs <count>              "
+              "Solve in worker processes (0: one per core)\n"
+           << "  -t, --timeout <seconds>         "
+              "Time limit per program w/ `--jobs'\n"
+           << "  -d, --daemon <socket>           "
+              "Serve the requests on the UNIX socket\n"
+           << "  -c, --cache <directory>         "
+              "Keep the solutions in the existing directory\n"
+           << "  -p, --parametric <rhs|objective>:<index>:<from>:<to>\n"
+           << "                                  "
+              "Solve for every `t' in [from; to] added to the `index'-th\n"
+           << "                                  "
+              "`β' or `c' of the standard form, write the breakpoints\n"
+           << "  -h, --help                      "
+              "Print this help and exit\n"
+           << "      --version                   "
+              "Print the version and exit\n";
+  }
+
+
+  /**
+   * @brief parseCount
+   * @param value
+   * @return (optional) The non-negative decimal integer.
+   */
+  optional<size_t>
+  parseCount(const string& value)
+  {
+    optional<size_t> ret;
+
+    if (
+      !value.empty() && value.size() < 10 &&
+      std::all_of(
+        value.cbegin(), value.cend(),
+        [](char c) { return (c >= '0' && c <= '9'); }
+      )
+    )
+    {
+      ret = size_t(std::stoul(value));
+    }
+
+    return ret;
+  }
+
+
+  /**
+   * @brief parseDegeneracyStrategy
+   * @param value
+   * @return (optional)
+   */
+  optional<DegeneracyStrategy>
+  parseDegeneracyStrategy(const string& value)
+  {
+    optional<DegeneracyStrategy> ret;
+
+    if (value == "none")
+    {
+      ret = DegeneracyStrategy::None;
+    }
+    else if (value == "perturbation")
+    {
+      ret = DegeneracyStrategy::Perturbation;
+    }
+    else if (value == "lexicographic")
+    {
+      ret = DegeneracyStrategy::Lexicographic;
+    }
+
+    return ret;
+  }
+
+
+  /**
+   * @brief parseDualizationMode
+   * @param value
+   * @return (optional)
+   */
+  optional<DualizationMode>
+  parseDualizationMode(const string& value)
+  {
+    optional<DualizationMode> ret;
+
+    if (value == "never")
+    {
+      ret = DualizationMode::Never;
+    }
+    else if (value == "auto")
+    {
+      ret = DualizationMode::Automatic;
+    }
+    else if (value == "always")
+    {
+      ret = DualizationMode::Always;
+    }
+
+    return ret;
+  }
+
+
+  /**
+   * @brief parseParametricSweep
+   * @param value `<rhs|objective>:<index>:<from>:<to>'.
+   * @return (optional) The sweep, the range is parsed in the field
+   * of the program.
+   */
+  optional<ParametricSweep>
+  parseParametricSweep(const string& value)
+  {
+    optional<ParametricSweep> ret;
+
+    vector<string> fields;
+    size_t first(0);
+    while (true)
+    {
+      const size_t last(value.find(':', first));
+      fields.push_back(value.substr(first, last - first));
+
+      if (last == string::npos)
+      {
+        break;
+      }
+
+      first = last + 1;
+    }
+
+    if (fields.size() != 4 || (fields[0] != "rhs" && fields[0] != "objective"))
+    {
+      return ret;
+    }
+
+    const optional<size_t> index(parseCount(fields[1]));
+    if (!index || fields[2].empty() || fields[3].empty())
+    {
+      return ret;
+    }
+
+    ret = ParametricSweep();
+    ret->isObjective = (fields[0] == "objective");
+    ret->index = *index;
+    ret->lowerParameter = fields[2];
+    ret->upperParameter = fields[3];
+
+    return ret;
+  }
+
+
+  /**
+   * @brief parseOptions
+   * @param argc
+   * @param argv
+   * @param options
+   * @return `ExitCode::Success' if the files are to be solved.
+   */
+  optional<ExitCode>
+  parseOptions(int argc, char** argv, Options& options)
+  {
+    for (int i(1); i < argc; ++i)
+    {
+      const string argument(argv[i]);
+
+      if (argument == "-h" || argument == "--help")
+      {
+        printUsage(std::cout, argv[0]);
+
+        return ExitCode::Success;
+      }
+
+      if (argument == "--version")
+      {
+        std::cout << LP_APP_VERSION << "\n";
+
+        return ExitCode::Success;
+      }
+
+      if (argument == "-n" || argument == "--names")
+      {
+        options.areNamesWritten = true;
+      }
+      else if (argument == "-v" || argument == "--verbose")
+      {
+        options.isVerbose = true;
+      }
+      else if (argument == "-w" || argument == "--warm-start")
+      {
+        options.isWarmStarted = true;
+      }
+      else if (
+        argument == "-f" || argument == "--field" ||
+        argument == "-m" || argument == "--method" ||
+        argument == "-g" || argument == "--degeneracy" ||
+        argument == "-u" || argument == "--dualize" ||
+        argument == "-j" || argument == "--jobs" ||
+        argument == "-t" || argument == "--timeout" ||
+        argument == "-d" || argument == "--daemon" ||
+        argument == "-c" || argument == "--cache" ||
+        argument == "-p" || argument == "--parametric"
+      )
+      {
+        if (++i == argc)
+        {
+          std::cerr << argv[0] << ": Missing value of `" << argument << "'\n";
+
+          return ExitCode::Usage;
+        }
+
+        const string value(argv[i]);
+        bool isValid(true);
+
+        if (argument == "-f" || argument == "--field")
+        {
+          options.field = ProgramIO::Detail::parseFieldName(value);
+          isValid = bool(options.field);
+        }
+        else if (argument == "-g" || argument == "--degeneracy")
+        {
+          const optional<DegeneracyStrategy> degeneracyStrategy(
+            parseDegeneracyStrategy(value)
+          );
+          options.degeneracyStrategy =
+            degeneracyStrategy.get_value_or(DegeneracyStrategy::None);
+          isValid = bool(degeneracyStrategy);
+        }
+        else if (argument == "-u" || argument == "--dualize")
+        {
+          const optional<DualizationMode> dualizationMode(
+            parseDualizationMode(value)
+          );
+          options.dualizationMode =
+            dualizationMode.get_value_or(DualizationMode::Never);
+          isValid = bool(dualizationMode);
+        }
+        else if (argument == "-j" || argument == "--jobs")
+        {
+          options.processesCount = parseCount(value);
+          isValid = bool(options.processesCount);
+        }
+        else if (argument == "-d" || argument == "--daemon")
+        {
+          options.daemonSocketName = value;
+        }
+        else if (argument == "-c" || argument == "--cache")
+        {
+          options.cacheDirectoryName = value;
+          isValid = !value.empty();
+        }
+        else if (argument == "-p" || argument == "--parametric")
+        {
+          options.parametricSweep = parseParametricSweep(value);
+          isValid = bool(options.parametricSweep);
+        }
+        else if (argument == "-t" || argument == "--timeout")
+        {
+          const optional<size_t> timeout(parseCount(value));
+          options.timeout = std::chrono::seconds(timeout.get_value_or(0));
+          isValid = bool(timeout);
+        }
+        else if (value == "simplex")
+        {
+          options.method = SolutionMethod::Simplex;
+        }
+        else if (value == "graphical")
+        {
+          options.method = SolutionMethod::Graphical;
+        }
+        else
+        {
+          isValid = false;
+        }
+
+        if (!isValid)
+        {
+          std::cerr << argv[0] << ": Invalid value of `" << argument
+                    << "': `" << value << "'\n";
+
+          return ExitCode::Usage;
+        }
+      }
+      else if (argument.size() > 1 && argument[0] == '-')
+      {
+        std::cerr << argv[0] << ": Unknown option `" << argument << "'\n";
+
+        return ExitCode::Usage;
+      }
+      else
+      {
+        options.fileNames.push_back(argument);
+      }
+    }
+
+    if (options.fileNames.empty() && !options.daemonSocketName)
+    {
+      printUsage(std::cerr, argv[0]);
+
+      return ExitCode::Usage;
+    }
+
+    return optional<ExitCode>();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief readProgram
+   * @param fileName
+   * @param input The standard input contents (for `StdinFileName').
+   * @return
+   */
+  ImportedProgram<T>
+  readProgram(const string& fileName, const string& input) throw(ParseError)
+  {
+    if (fileName == StdinFileName)
+    {
+      return
+        ProgramIO::JsonReader<T>().read(
+          input.data(), input.data() + input.size()
+        );
+    }
+
+    return ProgramIO::readProgramFile<T>(fileName);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief solutionCache
+   * NOTE: The cache is shared by all the files solved by the process
+   * (every worker process of `--jobs' has its own one).
+   * @param options
+   * @return
+   */
+  SolutionCache<T>&
+  solutionCache(const Options& options)
+  {
+    static SolutionCache<T> ret(
+      Config::LinearProgramming::SolutionCacheCapacity,
+      options.cacheDirectoryName
+    );
+
+    return ret;
+  }
+
+
+  /**
+   * @brief basisCache
+   * NOTE: The cache is shared by both fields and all the files solved
+   * by the process.
+   * @param options
+   * @return (optional) The cache, null unless `--warm-start' is given.
+   */
+  const std::shared_ptr<BasisCache>&
+  basisCache(const Options& options)
+  {
+    static const std::shared_ptr<BasisCache> ret(
+      options.isWarmStarted ? std::make_shared<BasisCache>() : nullptr
+    );
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief parseParameter
+   * @param value
+   * @return
+   */
+  T
+  parseParameter(const string& value) throw(std::runtime_error)
+  {
+    T ret(0);
+    if (
+      !ProgramIO::parseNumber<T>(
+        value.data(), value.data() + value.size(), ret
+      )
+    )
+    {
+      throw std::runtime_error("Invalid parameter `" + value + "'");
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief sweepProgram
+   * Solves the program along the ray of `--parametric' and writes
+   * its breakpoints (the solution cache is not used).
+   * @param fileName
+   * @param program
+   * @param options
+   * @param stream
+   */
+  void
+  sweepProgram(
+    const string& fileName, const ImportedProgram<T>& program,
+    const Options& options, ostream& stream
+  )
+  {
+    const ParametricSweep& sweep(*options.parametricSweep);
+    const T lowerParameter(parseParameter<T>(sweep.lowerParameter));
+    const T upperParameter(parseParameter<T>(sweep.upperParameter));
+
+    const auto& linearProgramData(program.linearProgramData);
+    const Eigen::DenseIndex index(sweep.index);
+    if (
+      index >= (
+        sweep.isObjective ?
+        linearProgramData.variablesCount() :
+        linearProgramData.constraintsCount()
+      )
+    )
+    {
+      throw std::runtime_error(
+        "Index of `--parametric' is out of the program"
+      );
+    }
+
+    ParametricSolver<T> solver(linearProgramData);
+    typename ParametricSolver<T>::Result result;
+
+    if (sweep.isObjective)
+    {
+      Eigen::Matrix<T, 1, Eigen::Dynamic> direction(
+        Eigen::Matrix<T, 1, Eigen::Dynamic>::Zero(
+          linearProgramData.variablesCount()
+        )
+      );
+      direction(index) = T(1);
+
+      result =
+        solver.sweepObjective(direction, lowerParameter, upperParameter);
+    }
+    else
+    {
+      Eigen::Matrix<T, Eigen::Dynamic, 1> direction(
+        Eigen::Matrix<T, Eigen::Dynamic, 1>::Zero(
+          linearProgramData.constraintsCount()
+        )
+      );
+      direction(index) = T(1);
+
+      result = solver.sweepRHS(direction, lowerParameter, upperParameter);
+    }
+
+    SolutionWriter<T>(options.areNamesWritten).write(
+      stream, fileName, program, result.first, result.second
+    );
+  }
+
+
+  template<typename T>
+  /**
+   * @brief solveProgram
+   * Reads, solves (unless the solution is cached) and writes
+   * the solution of the single program.
+   * @param fileName
+   * @param input
+   * @param options
+   * @param stream
+   */
+  void
+  solveProgram(
+    const string& fileName, const string& input, const Options& options,
+    ostream& stream
+  )
+  {
+    const ImportedProgram<T> program(readProgram<T>(fileName, input));
+
+    if (options.parametricSweep)
+    {
+      sweepProgram<T>(fileName, program, options, stream);
+
+      return;
+    }
+
+    SolutionCache<T>& cache(solutionCache<T>(options));
+    optional<typename SolutionCache<T>::Result> result;
+
+    if (options.method == SolutionMethod::Graphical)
+    {
+      const typename SolutionCache<T>::Key key(
+        SolutionCache<T>::makeKey(
+          program.linearProgramData, SolverType::Graphical2D
+        )
+      );
+
+      result = cache.find(key);
+      if (!result)
+      {
+        GraphicalSolver2D<T> solver(program.linearProgramData);
+        const auto plotData2D(solver.solve());
+
+        result = std::make_pair(
+          plotData2D.first, optional<LinearProgramSolution<T>>()
+        );
+        if (plotData2D.second)
+        {
+          result->second = plotData2D.second->linearProgramSolution;
+        }
+
+        cache.insert(key, *result);
+      }
+    }
+    else
+    {
+      SimplexSolver<T> solver(program.linearProgramData);
+      solver.setBasisCache(basisCache(options));
+      solver.setDegeneracyStrategy(options.degeneracyStrategy);
+      solver.setDualizationMode(options.dualizationMode);
+      result = cache.solve(solver);
+
+      //NOTE: Nothing is counted if the solution is cached
+      const SimplexStatistics& statistics(solver.statistics());
+      if (statistics.pivotsCount > 0)
+      {
+        Utils::writeLog(
+          Utils::LogLevel::Debug,
+          fileName + ": " + std::to_string(statistics.pivotsCount) +
+          " pivots, " + std::to_string(statistics.degeneratePivotsCount) +
+          " degenerate"
+        );
+      }
+    }
+
+    SolutionWriter<T>(options.areNamesWritten).write(
+      stream, fileName, program, result->first, result->second
+    );
+  }
+
+
+  /**
+   * @brief solveFile
+   * Solves the program in the field it is declared in (unless the field
+   * is given) and writes either the solution or the error to `stream'.
+   * @param fileName
+   * @param input
+   * @param options
+   * @param stream
+   * @return `false' on error.
+   */
+  bool
+  solveFile(
+    const string& fileName, const string& input, const Options& options,
+    ostream& stream
+  )
+  {
+    try
+    {
+      Field field(Field::Real);
+      if (options.field)
+      {
+        field = *options.field;
+      }
+      else if (fileName == StdinFileName)
+      {
+        field =
+          ProgramIO::readJsonField(
+            input.data(), input.data() + input.size()
+          ).get_value_or(Field::Real);
+      }
+      else
+      {
+        field =
+          ProgramIO::readProgramFileField(fileName).get_value_or(Field::Real);
+      }
+
+      switch (field)
+      {
+        case Field::Rational:
+          solveProgram<rational_t>(fileName, input, options, stream);
+          break;
+
+        default:
+          solveProgram<real_t>(fileName, input, options, stream);
+      }
+
+      return true;
+    }
+    catch (const std::exception& ex)
+    {
+      ProgramIO::writeSolutionError(stream, fileName, ex.what());
+
+      return false;
+    }
+  }
+
+
+#ifndef _WIN32
+  /**
+   * @brief solveFilesInWorkers
+   * Solves the programs in the worker processes (see `ProcessPool'),
+   * so that the program that crashes or hangs the solver only fails
+   * by itself. The solutions are written in the order of the files.
+   * @param input
+   * @param options
+   * @return `false' if any of the programs has failed.
+   */
+  bool
+  solveFilesInWorkers(const string& input, const Options& options)
+  throw(std::runtime_error)
+  {
+    using TaskStatus = Utils::ProcessPool::TaskStatus;
+
+    bool ret(true);
+
+    Utils::ProcessPool(*options.processesCount, options.timeout).run(
+      options.fileNames.size(),
+      [&input, &options](size_t fileIdx, string& output)
+      {
+        std::ostringstream stream;
+        const bool isSolved(
+          solveFile(options.fileNames[fileIdx], input, options, stream)
+        );
+        output = stream.str();
+
+        return isSolved;
+      },
+      [&ret, &options](size_t fileIdx, TaskStatus status, const string& data)
+      {
+        switch (status)
+        {
+          case TaskStatus::Done:
+            std::cout << data;
+            break;
+
+          case TaskStatus::Failed:
+            std::cout << data;
+            ret = false;
+            break;
+
+          default:
+            ProgramIO::writeSolutionError(
+              std::cout, options.fileNames[fileIdx], data
+            );
+            ret = false;
+        }
+
+        std::cout.flush();
+      }
+    );
+
+    return ret;
+  }
+
+
+  //NOTE: Only set while the daemon runs
+  Cli::SolveDaemon* runningDaemon(nullptr);
+
+
+  void
+  stopDaemon(int)
+  {
+    if (runningDaemon != nullptr)
+    {
+      runningDaemon->stop();
+    }
+  }
+
+
+  /**
+   * @brief runDaemon
+   * Serves the requests (see `SolveDaemon') until SIGINT or SIGTERM.
+   * @param options
+   */
+  void
+  runDaemon(const Options& options) throw(std::runtime_error)
+  {
+    Cli::SolveDaemon daemon(
+      *options.daemonSocketName, options.field, options.areNamesWritten,
+      options.cacheDirectoryName, options.isWarmStarted
+    );
+
+    runningDaemon = &daemon;
+    std::signal(SIGINT, stopDaemon);
+    std::signal(SIGTERM, stopDaemon);
+
+    try
+    {
+      daemon.run();
+    }
+    catch (...)
+    {
+      runningDaemon = nullptr;
+
+      throw;
+    }
+
+    runningDaemon = nullptr;
+  }
+#endif // _WIN32
+}
+
+
+/**
+ * @brief main
+ * The entry point of the command-line solver. No application object
+ * is created, so that nothing but the solvers runs before the first
+ * program is read.
+ * @param argc Command-line arguments count.
+ * @param argv Command-line arguments values.
+ * @return Exit code.
+ */
+int
+main(int argc, char** argv)
+{
+  std::ios::sync_with_stdio(false);
+
+#ifdef LP_TEST_MODE
+  Test::testRREF();
+  Test::testAllocations();
+  Test::testSolutionCache();
+  Test::testBasisCache();
+  Test::testBoundedSimplexSolver();
+  Test::testParametricSolver();
+  Test::testMultiRHSSolver();
+  Test::testIncrementalEdits();
+  Test::testColumnGenerator();
+  Test::testMpsWriter();
+  Test::testLpReader();
+  Test::testBinaryProgram();
+  Test::testJsonReader();
+  Test::testCompressedFiles();
+#ifndef _WIN32
+  Test::testProcessPool();
+  Test::testSolveDaemon();
+#endif // _WIN32
+  Test::benchmarkPackedSimplexSolver();
+
+  return int(ExitCode::Success);
+#endif // LP_TEST_MODE
+
+  Options options;
+  const optional<ExitCode> exitCode(parseOptions(argc, argv, options));
+  if (exitCode)
+  {
+    return int(*exitCode);
+  }
+
+  //NOTE: The solvers' log is dropped unless `--verbose' is given
+  if (!options.isVerbose)
+  {
+    Utils::setLogSink(Utils::LogSink());
+  }
+
+#ifndef _WIN32
+  if (options.daemonSocketName)
+  {
+    try
+    {
+      runDaemon(options);
+    }
+    catch (const std::exception& ex)
+    {
+      std::cerr << argv[0] << ": " << ex.what() << "\n";
+
+      return int(ExitCode::Fail);
+    }
+
+    return int(ExitCode::Success);
+  }
+#endif // _WIN32
+
+  //NOTE: The standard input is read once, however many times it is given
+  string input;
+  if (
+    std::find(
+      options.fileNames.cbegin(), options.fileNames.cend(), StdinFileName
+    ) != options.fileNames.cend()
+  )
+  {
+    input.assign(
+      std::istreambuf_iterator<char>(std::cin),
+      std::istreambuf_iterator<char>()
+    );
+  }
+
+  ExitCode ret(ExitCode::Success);
+
+#ifndef _WIN32
+  if (options.processesCount)
+  {
+    try
+    {
+      if (!solveFilesInWorkers(input, options))
+      {
+        ret = ExitCode::Fail;
+      }
+    }
+    catch (const std::exception& ex)
+    {
+      std::cerr << argv[0] << ": " << ex.what() << "\n";
+      ret = ExitCode::Fail;
+    }
+
+    std::cout.flush();
+
+    return int(ret);
+  }
+#endif // _WIN32
+
+  for (const string& fileName : options.fileNames)
+  {
+    if (!solveFile(fileName, input, options, std::cout))
+    {
+      ret = ExitCode::Fail;
+    }
+  }
+
+  std::cout.flush();
+
+  return int(ret);
+}
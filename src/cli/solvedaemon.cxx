@@ -0,0 +1,569 @@
+﻿#include "solvedaemon.hxx"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "boost/optional.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../io/binaryprogram.hxx"
+#include "../io/importedprogram.hxx"
+#include "../io/jsonreader.hxx"
+#include "../io/solutionwriter.hxx"
+#include "../lp/simplexsolver.hxx"
+#include "../math/numerictypes.hxx"
+#include "../config.hxx"
+
+
+namespace Cli
+{
+  using LinearProgramming::SimplexSolver;
+  using NumericTypes::rational_t;
+  using NumericTypes::real_t;
+  using ProgramIO::BinaryProgram;
+  using ProgramIO::ImportedProgram;
+  using ProgramIO::JsonReader;
+  using ProgramIO::SolutionWriter;
+  using std::lock_guard;
+  using std::ostringstream;
+  using std::runtime_error;
+  using std::size_t;
+  using std::string;
+  using std::thread;
+  using std::unique_lock;
+  using std::vector;
+
+
+  /**
+   * @brief The SolveDaemon::Workspace struct
+   * Everything the connection keeps between the requests.
+   */
+  struct SolveDaemon::Workspace
+  {
+    SimplexSolver<real_t> realSolver;
+
+    SimplexSolver<rational_t> rationalSolver;
+
+    //Received data, the requests before `inputOffset' are done
+    string input;
+
+    size_t inputOffset = 0;
+
+    //Responses to be sent
+    ostringstream output;
+
+    //NOTE: The arrays of the binary programs must be aligned
+    vector<uint64_t> image;
+
+
+    template<typename T>
+    SimplexSolver<T>& solver();
+  };
+
+
+  template<>
+  SimplexSolver<real_t>&
+  SolveDaemon::Workspace::solver<real_t>()
+  {
+    return realSolver;
+  }
+
+
+  template<>
+  SimplexSolver<rational_t>&
+  SolveDaemon::Workspace::solver<rational_t>()
+  {
+    return rationalSolver;
+  }
+
+
+  namespace
+  {
+    bool
+    writeAll(int socket, const string& data)
+    {
+      const char* first(data.data());
+      size_t size(data.size());
+
+      while (size > 0)
+      {
+        //NOTE: The client may be gone already, no SIGPIPE is wanted then
+        const ssize_t count(::send(socket, first, size, MSG_NOSIGNAL));
+        if (count < 0 && errno == EINTR)
+        {
+          continue;
+        }
+
+        if (count <= 0)
+        {
+          return false;
+        }
+
+        first += count;
+        size -= size_t(count);
+      }
+
+      return true;
+    }
+
+
+    /**
+     * @brief parseRequestHeader
+     * Parses the `<format> <size> [<name>]' line.
+     * @param line
+     * @param isBinary
+     * @param size
+     * @param name
+     * @return `false' if the line is malformed.
+     */
+    bool
+    parseRequestHeader(
+      const string& line, bool& isBinary, uint64_t& size, string& name
+    )
+    {
+      const size_t formatEnd(line.find(' '));
+      if (formatEnd == string::npos)
+      {
+        return false;
+      }
+
+      const string format(line, 0, formatEnd);
+      if (format == "json")
+      {
+        isBinary = false;
+      }
+      else if (format == "lpb")
+      {
+        isBinary = true;
+      }
+      else
+      {
+        return false;
+      }
+
+      const size_t sizeEnd(std::min(line.find(' ', formatEnd + 1), line.size()));
+      if (sizeEnd == formatEnd + 1 || sizeEnd - formatEnd > 11)
+      {
+        return false;
+      }
+
+      size = 0;
+      for (size_t i(formatEnd + 1); i < sizeEnd; ++i)
+      {
+        if (line[i] < '0' || line[i] > '9')
+        {
+          return false;
+        }
+
+        size = size * 10 + uint64_t(line[i] - '0');
+      }
+
+      name = (sizeEnd < line.size() ? line.substr(sizeEnd + 1) : string());
+
+      return (size <= Config::Cli::MaxRequestSize);
+    }
+  }
+
+
+  /**
+   * @brief SolveDaemon::SolveDaemon
+   * @param socketName Path of the socket, the stale one is replaced.
+   * @param field Field to solve the programs in, the declared one
+   * (or `real') if `none'.
+   * @param areNamesWritten
+   * @param cacheDirectoryName Existing directory of the persistent
+   * solution cache, none if it is empty.
+   * @param isWarmStarted Whether the programs are solved starting from
+   * the optimal basis of the program of the same structure solved before.
+   */
+  SolveDaemon::SolveDaemon(
+    const string& socketName, const optional<Field>& field,
+    bool areNamesWritten, const string& cacheDirectoryName,
+    bool isWarmStarted
+  ) :
+    socketName_(socketName),
+    field_(field),
+    areNamesWritten_(areNamesWritten),
+    realSolutionCache_(
+      Config::LinearProgramming::SolutionCacheCapacity, cacheDirectoryName
+    ),
+    rationalSolutionCache_(
+      Config::LinearProgramming::SolutionCacheCapacity, cacheDirectoryName
+    ),
+    basisCache_(isWarmStarted ? std::make_shared<BasisCache>() : nullptr),
+    socket_(-1),
+    isStopping_(false)
+  { }
+
+
+  SolveDaemon::~SolveDaemon()
+  {
+    stop();
+  }
+
+
+  /**
+   * @brief SolveDaemon::run
+   * Accepts the connections until `stop' is called, then closes
+   * all of them and removes the socket.
+   */
+  void
+  SolveDaemon::run() throw(runtime_error)
+  {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if (socketName_.empty() || socketName_.size() >= sizeof(address.sun_path))
+    {
+      throw runtime_error("Invalid socket name `" + socketName_ + "'");
+    }
+    socketName_.copy(address.sun_path, socketName_.size());
+
+    const int socket(::socket(AF_UNIX, SOCK_STREAM, 0));
+    if (socket < 0)
+    {
+      throw runtime_error("Couldn't create the socket");
+    }
+
+    ::unlink(socketName_.c_str());
+
+    if (
+      ::bind(
+        socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)
+      ) != 0 ||
+      ::listen(socket, Config::Cli::ListenBacklog) != 0
+    )
+    {
+      ::close(socket);
+
+      throw runtime_error("Couldn't listen on `" + socketName_ + "'");
+    }
+
+    socket_ = socket;
+
+    while (!isStopping_)
+    {
+      const int connection(::accept(socket, nullptr, nullptr));
+      if (connection < 0)
+      {
+        if (isStopping_)
+        {
+          break;
+        }
+
+        if (errno == EINTR || errno == ECONNABORTED)
+        {
+          continue;
+        }
+
+        stop();
+
+        break;
+      }
+
+      {
+        const lock_guard<mutex> lock(mutex_);
+        connections_.insert(connection);
+      }
+
+      thread(&SolveDaemon::serve, this, connection).detach();
+    }
+
+    //Wake up the connections and wait for them to finish
+    {
+      unique_lock<mutex> lock(mutex_);
+
+      for (const int connection : connections_)
+      {
+        ::shutdown(connection, SHUT_RDWR);
+      }
+
+      finishCondition_.wait(lock, [this]() { return connections_.empty(); });
+    }
+
+    socket_ = -1;
+    ::close(socket);
+    ::unlink(socketName_.c_str());
+  }
+
+
+  /**
+   * @brief SolveDaemon::stop
+   * Makes `run' return. Can be called from the signal handler.
+   */
+  void
+  SolveDaemon::stop()
+  {
+    isStopping_ = true;
+
+    const int socket(socket_);
+    if (socket >= 0)
+    {
+      ::shutdown(socket, SHUT_RDWR);
+    }
+  }
+
+
+  /**
+   * @brief SolveDaemon::serve
+   * Serves the connection until it is closed by either side.
+   * @param connection
+   */
+  void
+  SolveDaemon::serve(int connection)
+  {
+    try
+    {
+      Workspace workspace;
+      size_t requestsCount(0);
+
+      vector<char> buffer(Config::ProgramIO::JsonChunkSize);
+
+      while (!isStopping_)
+      {
+        const ssize_t count(::read(connection, buffer.data(), buffer.size()));
+        if (count < 0 && errno == EINTR)
+        {
+          continue;
+        }
+
+        if (count <= 0)
+        {
+          break;
+        }
+
+        if (
+          workspace.input.size() + size_t(count) > Config::Cli::MaxInputSize
+        )
+        {
+          ProgramIO::writeSolutionError(
+            workspace.output, std::to_string(requestsCount + 1),
+            "The request is too large"
+          );
+          writeAll(connection, workspace.output.str());
+
+          break;
+        }
+
+        workspace.input.append(buffer.data(), size_t(count));
+
+        //NOTE: All the requests received so far are answered at once
+        const bool isValid(solveRequests(workspace, requestsCount));
+
+        if (!writeAll(connection, workspace.output.str()) || !isValid)
+        {
+          break;
+        }
+
+        workspace.output.str(string());
+      }
+    }
+    catch (const std::exception&)
+    {
+      //NOTE: The connection is dropped, e.g. if it is out of memory
+    }
+
+    {
+      const lock_guard<mutex> lock(mutex_);
+      connections_.erase(connection);
+      ::close(connection);
+    }
+
+    finishCondition_.notify_all();
+  }
+
+
+  /**
+   * @brief SolveDaemon::solveRequests
+   * Solves all the complete requests received and drops them.
+   * @param workspace
+   * @param requestsCount Requests count of the connection.
+   * @return `false' if the request is malformed, so the connection
+   * cannot be continued.
+   */
+  bool
+  SolveDaemon::solveRequests(Workspace& workspace, size_t& requestsCount)
+  {
+    const string& input(workspace.input);
+
+    while (true)
+    {
+      const size_t headerEnd(input.find('\n', workspace.inputOffset));
+      if (headerEnd == string::npos)
+      {
+        if (
+          input.size() - workspace.inputOffset >
+          Config::Cli::MaxRequestHeaderSize
+        )
+        {
+          ProgramIO::writeSolutionError(
+            workspace.output, std::to_string(requestsCount + 1),
+            "Malformed request header"
+          );
+
+          return false;
+        }
+
+        break;
+      }
+
+      bool isBinary(false);
+      uint64_t size(0);
+      string name;
+
+      if (
+        !parseRequestHeader(
+          input.substr(
+            workspace.inputOffset, headerEnd - workspace.inputOffset
+          ),
+          isBinary, size, name
+        )
+      )
+      {
+        ProgramIO::writeSolutionError(
+          workspace.output, std::to_string(requestsCount + 1),
+          "Malformed request header"
+        );
+
+        return false;
+      }
+
+      if (input.size() - (headerEnd + 1) < size)
+      {
+        break;
+      }
+
+      ++requestsCount;
+      if (name.empty())
+      {
+        name = std::to_string(requestsCount);
+      }
+
+      const char* first(input.data() + headerEnd + 1);
+      const char* last(first + size);
+
+      try
+      {
+        Field field(Field::Real);
+        if (field_)
+        {
+          field = *field_;
+        }
+        else if (isBinary)
+        {
+          field = BinaryProgram(first, last).field();
+        }
+        else
+        {
+          field =
+            ProgramIO::readJsonField(first, last).get_value_or(Field::Real);
+        }
+
+        switch (field)
+        {
+          case Field::Rational:
+            solve<rational_t>(workspace, isBinary, first, last, name);
+            break;
+
+          default:
+            solve<real_t>(workspace, isBinary, first, last, name);
+        }
+      }
+      catch (const std::exception& ex)
+      {
+        ProgramIO::writeSolutionError(workspace.output, name, ex.what());
+      }
+
+      workspace.inputOffset = headerEnd + 1 + size;
+    }
+
+    //Drop the requests that are done
+    workspace.input.erase(0, workspace.inputOffset);
+    workspace.inputOffset = 0;
+
+    return true;
+  }
+
+
+  template<>
+  SolutionCache<real_t>&
+  SolveDaemon::solutionCache<real_t>()
+  {
+    return realSolutionCache_;
+  }
+
+
+  template<>
+  SolutionCache<rational_t>&
+  SolveDaemon::solutionCache<rational_t>()
+  {
+    return rationalSolutionCache_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SolveDaemon::solve
+   * Reads and solves the single program w/ the solver of the connection.
+   * @param workspace
+   * @param isBinary
+   * @param first
+   * @param last
+   * @param name
+   */
+  void
+  SolveDaemon::solve(
+    Workspace& workspace, bool isBinary, const char* first, const char* last,
+    const string& name
+  )
+  {
+    optional<ImportedProgram<T>> program;
+
+    if (isBinary)
+    {
+      const size_t size(last - first);
+      workspace.image.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+      std::memcpy(workspace.image.data(), first, size);
+
+      const char* imageFirst(
+        reinterpret_cast<const char*>(workspace.image.data())
+      );
+      const BinaryProgram binaryProgram(imageFirst, imageFirst + size);
+
+      program = ProgramIO::makeImportedProgram<T>(
+        binaryProgram.view<T>().linearProgramData(), name
+      );
+    }
+    else
+    {
+      program = JsonReader<T>().read(first, last);
+    }
+
+    SimplexSolver<T>& solver(workspace.solver<T>());
+    solver.setLinearProgramData(program->linearProgramData);
+    solver.setBasisCache(basisCache_);
+
+    const auto result(solutionCache<T>().solve(solver));
+
+    SolutionWriter<T>(areNamesWritten_).write(
+      workspace.output, name, *program, result.first, result.second
+    );
+  }
+}
+#endif // _WIN32
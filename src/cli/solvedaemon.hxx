@@ -0,0 +1,125 @@
+﻿#pragma once
+
+#ifndef SOLVEDAEMON_HXX
+#define SOLVEDAEMON_HXX
+
+
+#include <cstddef>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "boost/optional.hpp"
+
+#include "../lp/basiscache.hxx"
+#include "../lp/solutioncache.hxx"
+#include "../math/numerictypes.hxx"
+
+
+//NOTE: The daemon listens on the UNIX-domain socket, so it is POSIX-only
+#ifndef _WIN32
+namespace Cli
+{
+  using boost::optional;
+  using LinearProgramming::BasisCache;
+  using LinearProgramming::SolutionCache;
+  using NumericTypes::Field;
+  using std::atomic;
+  using std::condition_variable;
+  using std::mutex;
+  using std::runtime_error;
+  using std::set;
+  using std::shared_ptr;
+  using std::size_t;
+  using std::string;
+
+
+  /**
+   * @brief The SolveDaemon class
+   * Long-lived solver listening on the UNIX-domain socket. Each request
+   * is the header line followed by the program:
+   *   <format> <size> [<name>]\n<size bytes>
+   * where `format' is `json' or `lpb' (see `BinaryHeader'). Each response
+   * is the solution line of `SolutionWriter' (or `writeSolutionError'),
+   * named after the request (its 1-based index in the connection
+   * by default).
+   * Requests can be pipelined, the responses come in the same order.
+   * Every connection is served by its own thread, which keeps the solvers
+   * and the buffers for the whole connection, the solution cache
+   * (and the basis cache, if any) is shared by all of them.
+   */
+  class SolveDaemon
+  {
+    public:
+      SolveDaemon(
+        const string& socketName,
+        const optional<Field>& field = optional<Field>(),
+        bool areNamesWritten = false,
+        const string& cacheDirectoryName = string(),
+        bool isWarmStarted = false
+      );
+
+      SolveDaemon(const SolveDaemon&) = delete;
+
+      SolveDaemon& operator =(const SolveDaemon&) = delete;
+
+      ~SolveDaemon();
+
+      void run() throw(runtime_error);
+
+      void stop();
+
+
+    private:
+      struct Workspace;
+
+
+      string socketName_;
+
+      optional<Field> field_;
+
+      bool areNamesWritten_;
+
+      SolutionCache<NumericTypes::real_t> realSolutionCache_;
+
+      SolutionCache<NumericTypes::rational_t> rationalSolutionCache_;
+
+      //Shared by both fields (see `BasisCache'), none if it is null
+      shared_ptr<BasisCache> basisCache_;
+
+      atomic<int> socket_;
+
+      atomic<bool> isStopping_;
+
+      //Guards everything below
+      mutex mutex_;
+
+      condition_variable finishCondition_;
+
+      set<int> connections_;
+
+
+      void serve(int connection);
+
+      bool solveRequests(Workspace& workspace, size_t& requestsCount);
+
+      template<typename T>
+      SolutionCache<T>& solutionCache();
+
+      template<typename T>
+      void solve(
+        Workspace& workspace, bool isBinary, const char* first,
+        const char* last, const string& name
+      );
+  };
+}
+#endif // _WIN32
+
+
+#endif // SOLVEDAEMON_HXX
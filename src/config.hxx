@@ -7,16 +7,24 @@
 #include <cstdint>
 #include <utility>
 
-#include <QColor>
+//NOTE: The solver core is built w/o Qt, the application settings
+//are only visible to the Qt targets
+#ifdef QT_CORE_LIB
 #include <QLocale>
-#include <QMap>
 #include <QString>
+#endif // QT_CORE_LIB
+
+#ifdef QT_GUI_LIB
+#include <QColor>
+#include <QMap>
+#endif // QT_GUI_LIB
 
 #include "math/numerictypes.hxx"
 
 
 namespace Config
 {
+#ifdef QT_CORE_LIB
   namespace App
   {
     const QString Name = "Linear Programming";
@@ -40,7 +48,7 @@ namespace Config
 
 
     constexpr int ProgramModelsCount = 3;
-    constexpr int SimplexModelsCount = 3;
+    constexpr int SimplexModelsCount = 4;
 
     constexpr int MinConstraints = 1;
     constexpr int MaxConstraints = 16;
@@ -52,9 +60,13 @@ namespace Config
 
     const QString DefaultDocumentTitle = "Untitled";
 
+    //NOTE: Count of the plots of the graphical method kept in memory
+    constexpr int PlotDataCacheCapacity = 16;
+
     constexpr qreal SelectedPenWidth = 2.5;
     constexpr int FontSize = 9;
 
+#ifdef QT_GUI_LIB
     constexpr int ColorMapResolution = 40;
     constexpr int ColorMapLevelsCount = 80;
     constexpr uint8_t ColorMapAlpha = 95;
@@ -109,7 +121,9 @@ namespace Config
       make_pair(0.80, QColor( 48, 228, 188, ColorMapAlpha)),
       make_pair(0.90, QColor( 96, 255, 184, ColorMapAlpha))
     };
+#endif // QT_GUI_LIB
   }
+#endif // QT_CORE_LIB
 
 
   namespace LinearProgramming
@@ -118,6 +132,42 @@ namespace Config
     //NOTE: The average number of iterations is 2M + N
     //NOTE: The maximal number of iterations is Binomial[N + M, N]
     constexpr uint32_t MaxSimplexIterations = 601080390;
+
+    //NOTE: Count of the recent bases `CycleDetector' compares the new
+    //one against, and the count of the degenerate pivots in a row
+    //after which Bland's rule is used even w/o the repeated basis
+    constexpr uint16_t CycleHistoryLength = 16;
+    constexpr uint32_t MaxDegeneratePivots = 64;
+
+    //NOTE: Lower bounds of the variables are shifted by [1; 2) / Scale
+    //by `DegeneracyStrategy::Perturbation' (w/ the same seed every time)
+    constexpr uint32_t PerturbationScale = 1 << 16;
+    constexpr uint32_t PerturbationSeed = 1337;
+
+    //NOTE: Count of programs solved side by side by `PackedSimplexSolver',
+    //keep it a multiple of the SIMD register width (in doubles)
+    constexpr uint16_t PackedSimplexLanesCount = 16;
+    //NOTE: Sizes (M * N) of the real programs `PackedSimplexSolver' packs,
+    //the rest are solved one by one. Speedup of the packing measured w/
+    //`Test::benchmarkPackedSimplexSolver' (SSE2): 0.75 for 4x8, 0.87
+    //for 8x16, 0.98 for 16x32, 1.04-1.13 for 32x64, 0.95-1.10 for 64x128,
+    //0.4 for 128x256; 0.65 for the rational programs of any size
+    constexpr uint32_t MinPackedSimplexCoeffsCount = 32 * 64;
+    constexpr uint32_t MaxPackedSimplexCoeffsCount = 64 * 128;
+
+    //NOTE: Count of solutions `SolutionCache' keeps in memory
+    constexpr uint32_t SolutionCacheCapacity = 256;
+    //NOTE: Bump this when the hashed form of the programs or the layout
+    //of the cached solutions' files changes
+    constexpr uint32_t SolutionCacheFormatVersion = 1;
+
+    //NOTE: Count of the program structures `BasisCache' keeps the bases of
+    constexpr uint32_t BasisCacheCapacity = 64;
+
+    //NOTE: Count of the pricing rounds `ColumnGenerator' makes at most,
+    //and of the rounds a column may stay free before it is removed
+    constexpr uint32_t MaxColumnGenerationRounds = 10000;
+    constexpr uint32_t ColumnIdleRoundsLimit = 32;
   }
 
 
@@ -137,6 +187,58 @@ namespace Config
   }
 
 
+  namespace ProgramIO
+  {
+    //NOTE: Bounds and RHS values whose magnitude reaches this value
+    //are treated as infinite (the common MPS/LP files convention)
+    constexpr double Infinity = 1E30;
+
+    //NOTE: Width of the value fields of the fixed MPS format
+    constexpr int FixedMpsValueWidth = 12;
+
+    //NOTE: Width of the name fields of the fixed MPS format
+    constexpr int FixedMpsNameWidth = 8;
+
+    //NOTE: Bump this when the layout of the binary format changes
+    constexpr uint32_t BinaryFormatVersion = 1;
+    //NOTE: Arrays of the binary format start at multiples of this value
+    constexpr uint32_t BinaryAlignment = 64;
+
+    //NOTE: Bump this when the JSON schema changes incompatibly
+    constexpr int JsonFormatVersion = 2;
+
+    //NOTE: Size of the chunks JSON and compressed streams are read by
+    constexpr uint32_t JsonChunkSize = 1 << 16;
+    constexpr uint32_t CompressedChunkSize = 1 << 16;
+
+    //NOTE: zlib compression level of the written files (1..9)
+    constexpr int CompressionLevel = 6;
+  }
+
+
+  namespace Utils
+  {
+    //NOTE: Times the task is given to the worker processes before
+    //the crash or the timeout of its worker is reported
+    constexpr uint16_t MaxTaskAttempts = 2;
+  }
+
+
+  namespace Cli
+  {
+    //NOTE: Limits of the requests to the solve daemon
+    constexpr uint32_t MaxRequestHeaderSize = 1024;
+    constexpr uint64_t MaxRequestSize = uint64_t(1) << 28;
+
+    //NOTE: Bytes of the unanswered requests the connection may buffer,
+    //it is dropped once the client sends more
+    constexpr uint64_t MaxInputSize = MaxRequestHeaderSize + MaxRequestSize;
+
+    //NOTE: Connections waiting to be accepted by the solve daemon
+    constexpr int ListenBacklog = 64;
+  }
+
+
   namespace TableModelUtils
   {
     constexpr int RandSeed = 1337;
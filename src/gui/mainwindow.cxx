@@ -5,13 +5,18 @@
 #include <cmath>
 #include <cstddef>
 
+#include <fstream>
 #include <functional>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <QApplication>
 #include <QBrush>
 #include <QCloseEvent>
 #include <QDateTime>
@@ -47,15 +52,25 @@
 #include "stringtablemodel.hxx"
 #include "tablemodelcollection.hxx"
 #include "tablemodelutils.hxx"
+#include "../io/binarywriter.hxx"
+#include "../io/compressedstreambuffer.hxx"
+#include "../io/importedprogram.hxx"
+#include "../io/jsonwriter.hxx"
+#include "../io/mpswriter.hxx"
+#include "../io/parseerror.hxx"
+#include "../io/programfile.hxx"
 #include "../lp/simplexsolver.hxx"
 #include "../lp/simplexsolvercontroller.hxx"
 #include "../lp/graphicalsolver2d.hxx"
 #include "../lp/linearprogrammingutils.hxx"
 #include "../lp/linearprogramsolution.hxx"
 #include "../lp/plotdata2d.hxx"
+#include "../lp/solutioncache.hxx"
 #include "../lp/solutiontype.hxx"
+#include "../lp/solvertype.hxx"
 #include "../math/mathutils.hxx"
 #include "../misc/dataconvertors.hxx"
+#include "../misc/hasher.hxx"
 #include "../misc/utils.hxx"
 #include "../config.hxx"
 #include "../globaldefinitions.hxx"
@@ -76,8 +91,16 @@ namespace Gui
   using LinearProgramming::LinearProgramSolution;
   using LinearProgramming::MaybeIndex2D;
   using LinearProgramming::SimplexTableau;
+  using LinearProgramming::SolverType;
   using LinearProgrammingUtils::blerp;
   using LinearProgrammingUtils::perp;
+  using ProgramIO::BinaryWriter;
+  using ProgramIO::DeflatingStreamBuffer;
+  using ProgramIO::ImportedProgram;
+  using ProgramIO::JsonWriter;
+  using ProgramIO::MpsWriter;
+  using ProgramIO::ParseError;
+  using ProgramIO::ProgramFileFormat;
   using Utils::ResultType;
   using std::make_shared;
   using std::pair;
@@ -89,7 +112,9 @@ namespace Gui
 
 Gui::MainWindow::MainWindow(QWidget* parent) :
   QMainWindow(parent),
-  ui(new Ui::MainWindow)
+  ui(new Ui::MainWindow),
+  realPlotDataCache_(PlotDataCacheCapacity),
+  rationalPlotDataCache_(PlotDataCacheCapacity)
 {
   ui->setupUi(this);
 
@@ -234,10 +259,18 @@ Gui::MainWindow::dropEvent(QDropEvent* ev)
       const QFileInfo fileInfo(url.toLocalFile());
       if (fileInfo.isFile())
       {
-        const QString suffix(fileInfo.suffix());
+        const QString suffix(
+          QFileInfo(
+            isCompressedFile(fileInfo.fileName()) ?
+            fileInfo.completeBaseName() : fileInfo.fileName()
+          ).suffix()
+        );
         if (
           (suffix.compare(QStringLiteral("json"), Qt::CaseInsensitive) == 0) ||
-          (suffix.compare(QStringLiteral("txt"), Qt::CaseInsensitive) == 0)
+          (suffix.compare(QStringLiteral("txt"), Qt::CaseInsensitive) == 0) ||
+          (suffix.compare(QStringLiteral("mps"), Qt::CaseInsensitive) == 0) ||
+          (suffix.compare(QStringLiteral("lp"), Qt::CaseInsensitive) == 0) ||
+          (suffix.compare(QStringLiteral("lpb"), Qt::CaseInsensitive) == 0)
         )
         {
           openFile(fileInfo.filePath());
@@ -910,6 +943,14 @@ Gui::MainWindow::setupSimplexView()
   ui->simplex_simplexTableauTableView->setModel(
     simplexTableModels_[int(SimplexModel::Tableau)]
   );
+
+  simplexTableModels_[int(SimplexModel::Sensitivity)]->insertRow(0);
+  simplexTableModels_[int(SimplexModel::Sensitivity)]->insertColumn(0);
+  simplexTableModels_[int(SimplexModel::Sensitivity)]->setEditable(false);
+  simplexTableModels_[int(SimplexModel::Sensitivity)]->setSelectable(false);
+  ui->simplex_sensitivityTableView->setModel(
+    simplexTableModels_[int(SimplexModel::Sensitivity)]
+  );
 }
 
 
@@ -931,6 +972,7 @@ Gui::MainWindow::enableCurrentSolutionSimplexView(bool enabled)
 {
   ui->simplex_solutionVectorTableView->setEnabled(enabled);
   ui->simplex_objectiveValueTableView->setEnabled(enabled);
+  ui->simplex_sensitivityTableView->setEnabled(enabled);
 }
 
 
@@ -1150,6 +1192,35 @@ Gui::MainWindow::destroySimplexView()
 }
 
 
+template<typename T>
+void
+Gui::MainWindow::refreshSensitivityAnalysisView(
+  const optional<SensitivityAnalysis<T>>& sensitivityAnalysis
+)
+{
+  StringTableModel* const tableModel(
+    simplexTableModels_[int(SimplexModel::Sensitivity)]
+  );
+
+  if (sensitivityAnalysis)
+  {
+    tableModel->resize(
+      int(
+        (*sensitivityAnalysis).reducedCosts.rows() +
+        (*sensitivityAnalysis).shadowPrices.rows()
+      ),
+      3
+    );
+    TableModelUtils::fill<T>(tableModel, *sensitivityAnalysis);
+  }
+  else
+  {
+    tableModel->resize(1, 1);
+    tableModel->clear();
+  }
+}
+
+
 void
 Gui::MainWindow::assignTableModelsHeaders()
 {
@@ -1276,6 +1347,9 @@ Gui::MainWindow::setupNumericSolvers()
 {
   realSimplexSolver_ = make_shared<SimplexSolver<real_t>>();
   rationalSimplexSolver_ = make_shared<SimplexSolver<rational_t>>();
+
+  realSimplexSolver_->setSensitivityAnalysisEnabled(true);
+  rationalSimplexSolver_->setSensitivityAnalysisEnabled(true);
 }
 
 
@@ -1376,7 +1450,7 @@ Gui::MainWindow::solveSimplex()
     case Field::Real:
       {
         const pair<SolutionType, optional<LinearProgramSolution<real_t>>>
-        linearProgramSolution(realSimplexSolver_->solve());
+        linearProgramSolution(realSolutionCache_.solve(*realSimplexSolver_));
 
         if (linearProgramSolution.second)
         {
@@ -1396,6 +1470,10 @@ Gui::MainWindow::solveSimplex()
             )
           );
 
+          refreshSensitivityAnalysisView<real_t>(
+            (*linearProgramSolution.second).sensitivityAnalysis
+          );
+
           LOG(
             "Solution: x* == {0}\nF* == {1}",
             (*linearProgramSolution.second).extremePoint,
@@ -1418,7 +1496,9 @@ Gui::MainWindow::solveSimplex()
     case Field::Rational:
       {
         const pair<SolutionType, optional<LinearProgramSolution<rational_t>>>
-        linearProgramSolution(rationalSimplexSolver_->solve());
+        linearProgramSolution(
+          rationalSolutionCache_.solve(*rationalSimplexSolver_)
+        );
 
         if (linearProgramSolution.second)
         {
@@ -1438,6 +1518,10 @@ Gui::MainWindow::solveSimplex()
             )
           );
 
+          refreshSensitivityAnalysisView<rational_t>(
+            (*linearProgramSolution.second).sensitivityAnalysis
+          );
+
           LOG(
             "Solution: x* == {0}\nF* == {1}",
             (*linearProgramSolution.second).extremePoint,
@@ -1505,13 +1589,28 @@ Gui::MainWindow::solveGraphical()
           std::move(constrsRHS)
         );
 
-        GraphicalSolver2D<real_t> graphicalSolver2D(
-          std::move(linearProgramData)
+        const Digest key(
+          SolutionCache<real_t>::makeKey(
+            linearProgramData, SolverType::Graphical2D
+          )
         );
 
-        pair<SolutionType, optional<PlotData2D<real_t>>> plotData2D(
-          graphicalSolver2D.solve()
-        );
+        pair<SolutionType, optional<PlotData2D<real_t>>> plotData2D;
+
+        const auto* const cachedPlotData2D(realPlotDataCache_.find(key));
+        if (cachedPlotData2D != nullptr)
+        {
+          plotData2D = *cachedPlotData2D;
+        }
+        else
+        {
+          GraphicalSolver2D<real_t> graphicalSolver2D(
+            std::move(linearProgramData)
+          );
+
+          plotData2D = graphicalSolver2D.solve();
+          realPlotDataCache_.insert(key, plotData2D);
+        }
 
         if (plotData2D.second)
         {
@@ -1559,13 +1658,28 @@ Gui::MainWindow::solveGraphical()
           std::move(constrsRHS)
         );
 
-        GraphicalSolver2D<rational_t> graphicalSolver2D(
-          std::move(linearProgramData)
+        const Digest key(
+          SolutionCache<rational_t>::makeKey(
+            linearProgramData, SolverType::Graphical2D
+          )
         );
 
-        pair<SolutionType, optional<PlotData2D<rational_t>>> plotData2D(
-          graphicalSolver2D.solve()
-        );
+        pair<SolutionType, optional<PlotData2D<rational_t>>> plotData2D;
+
+        const auto* const cachedPlotData2D(rationalPlotDataCache_.find(key));
+        if (cachedPlotData2D != nullptr)
+        {
+          plotData2D = *cachedPlotData2D;
+        }
+        else
+        {
+          GraphicalSolver2D<rational_t> graphicalSolver2D(
+            std::move(linearProgramData)
+          );
+
+          plotData2D = graphicalSolver2D.solve();
+          rationalPlotDataCache_.insert(key, plotData2D);
+        }
 
         if (plotData2D.second)
         {
@@ -1761,149 +1875,271 @@ Gui::MainWindow::loadDataFromFile(const QString& filename)
 {
   if (!filename.isEmpty())
   {
-    QFile file(filename);
-    if (!file.open(QIODevice::ReadOnly))
-    {
-      qWarning() << "MainWindow::loadDataFromFile:"
-                    " couldn't open file at path" << filename;
+    return importDataFromFile(filename);
+  }
+  else
+  {
+    return ResultType::Nothing;
+  }
+}
 
-      return ResultType::Nothing;
-    }
-    else
-    {
-      const QByteArray byteArray(file.readAll());
-      if (byteArray.count() > 0)
-      {
-        const QJsonDocument jsonDocument(QJsonDocument::fromJson(byteArray));
-        TableModelCollection tableModels;
-        const ResultType res(tableModels.read(jsonDocument.object()));
 
-        file.flush(); // TODO: [1;0] Do we need this?
-        file.close();
+Utils::ResultType
+Gui::MainWindow::saveDataToFile(const QString& filename)
+{
+  if (!filename.isEmpty())
+  {
+    return exportDataToFile(filename);
+  }
+  else
+  {
+    return ResultType::Nothing;
+  }
+}
 
-        if (res == ResultType::Success)
-        {
-          if (tableModels.count() == ProgramModelsCount)
-          {
-            for (int i(0); i < ProgramModelsCount; ++i)
-            {
-              //Transfer contents...
-              (*programTableModels_[i]) = std::move(tableModels[i]);
-              //...and update ownerhsip
-              (*programTableModels_[i]).setParent(this);
-            }
-            assignTableModelsHeaders();
-
-            //Update `N'
-            ui->program_varsSpinBox->setValue(
-              programTableModels_[int(ProgramModel::Constrs)]->columnCount()
-            );
 
-            //Update `M'
-            ui->program_constrsSpinBox->setValue(
-              programTableModels_[int(ProgramModel::Constrs)]->rowCount()
-            );
+template<typename T>
+ProgramIO::ImportedProgram<T>
+Gui::MainWindow::readProgramFile(const QString& filename)
+throw(ProgramIO::ParseError)
+{
+  return ProgramIO::readProgramFile<T>(
+    QFile::encodeName(filename).toStdString()
+  );
+}
 
-            //Update `field_'
-            field_ = tableModels.field();
-            switch (field_)
-            {
-              case Field::Real:
-                ui->program_realRadioButton->setChecked(true);
-                break;
 
-              case Field::Rational:
-                ui->program_rationalRadioButton->setChecked(true);
-                break;
+Utils::ResultType
+Gui::MainWindow::importDataFromFile(const QString& filename)
+{
+  DenseIndex rows(0);
+  DenseIndex cols(0);
+  QVector<StringTableModel> items;
+  Field field(field_);
 
-              default:
-                qWarning() << "MainWindow::loadData: unknown value of `field_'";
-                return ResultType::Fail;
-            }
+  try
+  {
+    //Binary and JSON programs are stored in the specific field
+    field = ProgramIO::readProgramFileField(
+      QFile::encodeName(filename).toStdString()
+    ).get_value_or(field_);
 
-            return ResultType::Success;
-          }
-          else
+    switch (field)
+    {
+      case Field::Real:
+        {
+          const ImportedProgram<real_t> program(
+            readProgramFile<real_t>(filename)
+          );
+          rows = program.linearProgramData.constraintsCount();
+          cols = program.linearProgramData.variablesCount();
+          if (rows <= MaxConstraints && cols <= MaxVariables)
           {
-            return ResultType::Nothing;
+            items = TableModelUtils::makeTableModels<real_t>(
+              program.linearProgramData
+            );
           }
+
+          break;
         }
-        else
+
+      case Field::Rational:
         {
-          qWarning() << "MainWindow::loadData: couldn't correctly parse"
-                        " file contents: the file is either incompatible"
-                        " or invalid";
+          const ImportedProgram<rational_t> program(
+            readProgramFile<rational_t>(filename)
+          );
+          rows = program.linearProgramData.constraintsCount();
+          cols = program.linearProgramData.variablesCount();
+          if (rows <= MaxConstraints && cols <= MaxVariables)
+          {
+            items = TableModelUtils::makeTableModels<rational_t>(
+              program.linearProgramData
+            );
+          }
 
-          return res;
+          break;
         }
-      }
-      else
-      {
-        qWarning() << "MainWindow::loadData: couldn't read file contents:"
-                      " the file is empty";
 
-        return ResultType::Nothing;
-      }
+      default:
+        qWarning() << "MainWindow::importDataFromFile:"
+                      " unknown value of `field'";
+        return ResultType::Fail;
     }
   }
-  else
+  catch (const ParseError& pe)
   {
+    qWarning() << "MainWindow::importDataFromFile: couldn't read"
+                  " the program from file at path" << filename << ":" <<
+                  pe.what();
+
+    return ResultType::Fail;
+  }
+
+  //NOTE: The program view holds up to `MaxConstraints' x `MaxVariables'
+  //programs w/ (M <= N) only
+  if (
+    rows < MinConstraints || rows > MaxConstraints ||
+    cols < MinVariables || cols > MaxVariables || rows > cols
+  )
+  {
+    qWarning() << "MainWindow::importDataFromFile: the standard form"
+                  " program size" << rows << "x" << cols << "is out of"
+                  " the supported range";
+
     return ResultType::Nothing;
   }
+
+  TableModelCollection tableModels(items, field);
+
+  return setProgramTableModels(tableModels);
+}
+
+
+template<typename T>
+void
+Gui::MainWindow::writeProgramFile(std::ostream& stream, const QString& filename)
+throw(std::runtime_error)
+{
+  const LinearProgramData<T> linearProgramData(
+    TableModelUtils::makeLinearProgramData<T>(
+      programTableModels_[int(ProgramModel::ObjFunc)],
+      programTableModels_[int(ProgramModel::Constrs)],
+      programTableModels_[int(ProgramModel::RHS)]
+    )
+  );
+
+  if (isBinaryFile(filename))
+  {
+    BinaryWriter<T>().write(stream, linearProgramData);
+  }
+  else if (isMpsFile(filename))
+  {
+    MpsWriter<T>().write(
+      stream, linearProgramData,
+      QFileInfo(filename).baseName().toStdString()
+    );
+  }
+  else
+  {
+    JsonWriter<T>().write(stream, linearProgramData);
+  }
 }
 
 
 Utils::ResultType
-Gui::MainWindow::saveDataToFile(const QString& filename)
+Gui::MainWindow::exportDataToFile(const QString& filename)
 {
-  if (!filename.isEmpty())
+  if (
+    isCompressedFile(filename) && (isBinaryFile(filename) || isLpFile(filename))
+  )
+  {
+    qWarning() << "MainWindow::exportDataToFile: compressed binary and LP"
+                  " files are not supported";
+
+    return ResultType::Nothing;
+  }
+
+  std::ofstream file(
+    QFile::encodeName(filename).constData(),
+    std::ios::out | std::ios::binary
+  );
+  if (!file)
   {
-    QFile file(filename);
-    if (!file.open(QIODevice::WriteOnly))
+    qWarning() << "MainWindow::exportDataToFile: couldn't open file"
+                  " at path" << filename;
+
+    return ResultType::Nothing;
+  }
+
+  //The compressor is put between the writer and the file if needed
+  std::unique_ptr<DeflatingStreamBuffer> compressor;
+  std::ostream stream(file.rdbuf());
+
+  try
+  {
+    if (isCompressedFile(filename))
+    {
+      compressor.reset(new DeflatingStreamBuffer(file.rdbuf()));
+      stream.rdbuf(compressor.get());
+    }
+
+    switch (field_)
     {
-      qWarning() << "MainWindow::saveDataToFile: couldn't open file"
-                    " at path" << filename;
+      case Field::Real:
+        writeProgramFile<real_t>(stream, filename);
+        break;
 
-      return ResultType::Nothing;
+      case Field::Rational:
+        writeProgramFile<rational_t>(stream, filename);
+        break;
+
+      default:
+        qWarning() << "MainWindow::exportDataToFile:"
+                      " unknown value of `field_'";
+        return ResultType::Fail;
     }
-    else
+  }
+  catch (const std::runtime_error& re)
+  {
+    qWarning() << "MainWindow::exportDataToFile: couldn't write"
+                  " the program:" << re.what();
+
+    return ResultType::Fail;
+  }
+
+  if (compressor && !compressor->finish())
+  {
+    stream.setstate(std::ios::badbit);
+  }
+  stream.flush();
+  file.flush();
+
+  return (stream && file ? ResultType::Success : ResultType::Fail);
+}
+
+
+Utils::ResultType
+Gui::MainWindow::setProgramTableModels(TableModelCollection& tableModels)
+{
+  if (tableModels.count() == ProgramModelsCount)
+  {
+    for (int i(0); i < ProgramModelsCount; ++i)
     {
-      QJsonObject jsonObject;
-      //TODO: [0;0] Use pointers here.
-      TableModelCollection tableModels(
-        QVector<StringTableModel>{
-          (*programTableModels_[int(ProgramModel::ObjFunc)]),
-          (*programTableModels_[int(ProgramModel::Constrs)]),
-          (*programTableModels_[int(ProgramModel::RHS)])
-        },
-        field_
-      );
-      const ResultType res(tableModels.write(jsonObject));
+      //Transfer contents...
+      (*programTableModels_[i]) = std::move(tableModels[i]);
+      //...and update ownerhsip
+      (*programTableModels_[i]).setParent(this);
+    }
+    assignTableModelsHeaders();
 
-      if (res == ResultType::Success)
-      {
-        const QJsonDocument jsonDocument(jsonObject);
+    //Update `N'
+    ui->program_varsSpinBox->setValue(
+      programTableModels_[int(ProgramModel::Constrs)]->columnCount()
+    );
 
-        const quint64 bytesCount(
-          file.write(jsonDocument.toJson(QJsonDocument::Indented))
-        );
-        file.flush(); // TODO: [1;0] Do we need this?
-        file.close();
+    //Update `M'
+    ui->program_constrsSpinBox->setValue(
+      programTableModels_[int(ProgramModel::Constrs)]->rowCount()
+    );
 
-        if (bytesCount == quint64 (-1))
-        {
-          return ResultType::Fail;
-        }
-        else
-        {
-          return ResultType::Success;
-        }
-      }
-      else
-      {
-        return res;
-      }
+    //Update `field_'
+    field_ = tableModels.field();
+    switch (field_)
+    {
+      case Field::Real:
+        ui->program_realRadioButton->setChecked(true);
+        break;
+
+      case Field::Rational:
+        ui->program_rationalRadioButton->setChecked(true);
+        break;
+
+      default:
+        qWarning() << "MainWindow::loadData: unknown value of `field_'";
+        return ResultType::Fail;
     }
+
+    return ResultType::Success;
   }
   else
   {
@@ -1912,6 +2148,52 @@ Gui::MainWindow::saveDataToFile(const QString& filename)
 }
 
 
+bool
+Gui::MainWindow::isCompressedFile(const QString& filename)
+{
+  return ProgramIO::isCompressedFile(
+    QFile::encodeName(filename).toStdString()
+  );
+}
+
+
+bool
+Gui::MainWindow::isJsonFile(const QString& filename)
+{
+  return (programFileFormat(filename) == ProgramFileFormat::Json);
+}
+
+
+bool
+Gui::MainWindow::isMpsFile(const QString& filename)
+{
+  return (programFileFormat(filename) == ProgramFileFormat::Mps);
+}
+
+
+bool
+Gui::MainWindow::isLpFile(const QString& filename)
+{
+  return (programFileFormat(filename) == ProgramFileFormat::Lp);
+}
+
+
+bool
+Gui::MainWindow::isBinaryFile(const QString& filename)
+{
+  return (programFileFormat(filename) == ProgramFileFormat::Binary);
+}
+
+
+ProgramIO::ProgramFileFormat
+Gui::MainWindow::programFileFormat(const QString& filename)
+{
+  return ProgramIO::programFileFormat(
+    QFile::encodeName(filename).toStdString()
+  );
+}
+
+
 void
 Gui::MainWindow::loadSettings()
 {
@@ -2447,7 +2729,11 @@ Gui::MainWindow::on_action_Open_triggered()
       QStringLiteral("Open Linear Program"),
       QStandardPaths::writableLocation(QStandardPaths::DocumentsLocation) +
         "/linearProgram.json",
-      QStringLiteral("JSON file (*.json);;Plain text document (*.txt)"),
+      QStringLiteral(
+        "JSON file (*.json);;Plain text document (*.txt);;"
+        "MPS file (*.mps);;CPLEX LP file (*.lp);;Binary program (*.lpb);;"
+        "Compressed file (*.json.gz *.mps.gz *.lp.gz)"
+      ),
       nullptr,
       QFileDialog::DontUseNativeDialog
     )
@@ -2471,7 +2757,11 @@ Gui::MainWindow::on_action_Save_as_triggered()
         QString("/linearProgram@%1.json").arg(
           QDateTime::currentDateTime().toString(QStringLiteral("dMMMyy_h-m-s"))
         ),
-      QStringLiteral("JSON file (*.json);;Plain text document (*.txt)"),
+      QStringLiteral(
+        "JSON file (*.json);;Plain text document (*.txt);;"
+        "MPS file (*.mps);;Binary program (*.lpb);;"
+        "Compressed JSON file (*.json.gz);;Compressed MPS file (*.mps.gz)"
+      ),
       nullptr,
       QFileDialog::DontUseNativeDialog
     )
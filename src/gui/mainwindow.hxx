@@ -7,6 +7,8 @@
 #include <cstdint>
 
 #include <memory>
+#include <ostream>
+#include <stdexcept>
 
 #include <QCloseEvent>
 #include <QDragEnterEvent>
@@ -19,28 +21,46 @@
 #include <QWheelEvent>
 #include <QWidget>
 
+#include "boost/optional.hpp"
 #include "qcustomplot/qcustomplot.h"
 
 #include "numericstyleditemdelegate.hxx"
 #include "stringtablemodel.hxx"
+#include "tablemodelcollection.hxx"
+#include "../io/importedprogram.hxx"
+#include "../io/parseerror.hxx"
+#include "../io/programfile.hxx"
 #include "../lp/simplexsolver.hxx"
 #include "../lp/simplexsolvercontroller.hxx"
 #include "../lp/plotdata2d.hxx"
+#include "../lp/sensitivityanalysis.hxx"
+#include "../lp/solutioncache.hxx"
 #include "../lp/solutiontype.hxx"
 #include "../math/numerictypes.hxx"
+#include "../misc/hasher.hxx"
+#include "../misc/lrucache.hxx"
 #include "../misc/utils.hxx"
 
 
 namespace Gui
 {
+  using boost::optional;
   using LinearProgramming::SimplexSolver;
   using LinearProgramming::SimplexSolverController;
   using LinearProgramming::PlotData2D;
+  using LinearProgramming::SensitivityAnalysis;
+  using LinearProgramming::SolutionCache;
   using LinearProgramming::SolutionType;
+  using ProgramIO::ImportedProgram;
+  using ProgramIO::ParseError;
   using NumericTypes::Field;
   using NumericTypes::rational_t;
   using NumericTypes::real_t;
+  using Utils::Digest;
+  using Utils::DigestHash;
+  using Utils::LruCache;
   using Utils::ResultType;
+  using std::pair;
   using std::shared_ptr;
 
 
@@ -141,7 +161,8 @@ namespace Gui
       {
         Solution = 0,
         ObjectiveValue = 1,
-        Tableau = 2
+        Tableau = 2,
+        Sensitivity = 3
       };
 
 
@@ -152,6 +173,12 @@ namespace Gui
       };
 
 
+      template<typename T>
+      using PlotDataCache = LruCache<
+        Digest, pair<SolutionType, optional<PlotData2D<T>>>, DigestHash
+      >;
+
+
       Ui::MainWindow* ui = 0;
 
       Field field_ = Field::Real;
@@ -174,6 +201,13 @@ namespace Gui
       SimplexSolverController<real_t> realSimplexSolverController_;
       SimplexSolverController<rational_t> rationalSimplexSolverController_;
 
+      //NOTE: Solving the unchanged program again only takes a lookup
+      SolutionCache<real_t> realSolutionCache_;
+      SolutionCache<rational_t> rationalSolutionCache_;
+
+      PlotDataCache<real_t> realPlotDataCache_;
+      PlotDataCache<rational_t> rationalPlotDataCache_;
+
 
       void setupDefaults();
       void setupSignals();
@@ -197,6 +231,11 @@ namespace Gui
       void refreshSimplexView();
       void destroySimplexView();
 
+      template<typename T = real_t>
+      void refreshSensitivityAnalysisView(
+        const optional<SensitivityAnalysis<T>>& sensitivityAnalysis
+      );
+
       void assignTableModelsHeaders();
       void convertTableModelsContents();
       void toggleTableViewsDelegates();
@@ -222,6 +261,29 @@ namespace Gui
       ResultType loadDataFromFile(const QString& fileName);
       ResultType saveDataToFile(const QString& fileName);
 
+      template<typename T = real_t>
+      ImportedProgram<T> readProgramFile(const QString& fileName)
+      throw(ParseError);
+
+      template<typename T = real_t>
+      void writeProgramFile(std::ostream& stream, const QString& fileName)
+      throw(std::runtime_error);
+
+      ResultType importDataFromFile(const QString& fileName);
+      ResultType exportDataToFile(const QString& fileName);
+
+      ResultType setProgramTableModels(TableModelCollection& tableModels);
+
+      static ProgramIO::ProgramFileFormat programFileFormat(
+        const QString& fileName
+      );
+
+      static bool isCompressedFile(const QString& fileName);
+      static bool isJsonFile(const QString& fileName);
+      static bool isMpsFile(const QString& fileName);
+      static bool isLpFile(const QString& fileName);
+      static bool isBinaryFile(const QString& fileName);
+
       void loadSettings();
       void saveSettings();
   };
@@ -10,10 +10,14 @@
 #include <QTableWidget>
 #include <QString>
 #include <QVariant>
+#include <QVector>
 
+#include "boost/optional.hpp"
 #include "eigen3/Eigen/Core"
 
 #include "stringtablemodel.hxx"
+#include "../lp/linearprogramdata.hxx"
+#include "../lp/sensitivityanalysis.hxx"
 #include "../lp/simplextableau.hxx"
 #include "../math/mathutils.hxx"
 #include "../math/numerictypes.hxx"
@@ -22,11 +26,14 @@
 
 namespace TableModelUtils
 {
+  using boost::optional;
   using DataConvertors::numericCast;
   using Eigen::DenseIndex;
   using Eigen::Dynamic;
   using Eigen::Matrix;
   using Gui::StringTableModel;
+  using LinearProgramming::LinearProgramData;
+  using LinearProgramming::SensitivityAnalysis;
   using LinearProgramming::SimplexTableau;
   using NumericTypes::rational_t;
   using NumericTypes::real_t;
@@ -152,6 +159,90 @@ namespace TableModelUtils
   }
 
 
+  template<typename T = real_t>
+  /**
+   * @brief fill
+   * Fills the rows `c[j]' and then `β[i]' w/ the reduced cost `d[j]'
+   * (the dual value `y[i]') and the limits of the coefficient.
+   * @param tableModel
+   * @param sensitivityAnalysis
+   * @return
+   */
+  bool
+  fill(
+    StringTableModel* tableModel,
+    const SensitivityAnalysis<T>& sensitivityAnalysis
+  ) throw(invalid_argument)
+  {
+    if (tableModel == nullptr)
+    {
+      throw invalid_argument("`tableModel' == `nullptr'");
+    }
+
+    const DenseIndex varsCount(sensitivityAnalysis.reducedCosts.rows());
+    const DenseIndex rowsCount(sensitivityAnalysis.shadowPrices.rows());
+
+    if (
+      tableModel->rowCount() != varsCount + rowsCount ||
+      tableModel->columnCount() != 3
+    )
+    {
+      throw invalid_argument("tableModel->rowCount() != (N + M)"
+                             " || tableModel->columnCount() != 3");
+    }
+
+    const auto fillRow = [tableModel](
+      DenseIndex row, const QString& header, const T& value,
+      const optional<T>& lowerLimit, const optional<T>& upperLimit
+    )
+    {
+      tableModel->setHeaderData(row, Qt::Vertical, header);
+
+      tableModel->setData(
+        tableModel->index(row, 0), numericCast<QString, T>(value)
+      );
+      tableModel->setData(
+        tableModel->index(row, 1),
+        lowerLimit ?
+        numericCast<QString, T>(*lowerLimit) : QStringLiteral("-∞")
+      );
+      tableModel->setData(
+        tableModel->index(row, 2),
+        upperLimit ?
+        numericCast<QString, T>(*upperLimit) : QStringLiteral("+∞")
+      );
+    };
+
+    for (DenseIndex j(0); j < varsCount; ++j)
+    {
+      fillRow(
+        j,
+        QStringLiteral("c") + QString::number(j + 1),
+        sensitivityAnalysis.reducedCosts(j),
+        sensitivityAnalysis.objectiveLowerLimits.at(j),
+        sensitivityAnalysis.objectiveUpperLimits.at(j)
+      );
+    }
+
+    for (DenseIndex i(0); i < rowsCount; ++i)
+    {
+      fillRow(
+        varsCount + i,
+        QStringLiteral("β") + QString::number(i + 1),
+        sensitivityAnalysis.shadowPrices(i),
+        sensitivityAnalysis.rhsLowerLimits.at(i),
+        sensitivityAnalysis.rhsUpperLimits.at(i)
+      );
+    }
+
+    tableModel->setHeaderData(0, Qt::Horizontal, QStringLiteral("d / y"));
+    tableModel->setHeaderData(1, Qt::Horizontal, QStringLiteral("Lower"));
+    tableModel->setHeaderData(2, Qt::Horizontal, QStringLiteral("Upper"));
+
+    return true;
+  }
+
+
   template<typename R, typename T>
   bool
   convert(StringTableModel* tableModel) throw(invalid_argument)
@@ -309,6 +400,56 @@ namespace TableModelUtils
 
     return mat;
   }
+
+
+  template<typename T = real_t>
+  /**
+   * @brief makeTableModels
+   * @param linearProgramData
+   * @return Objective function, constraints and RHS table models
+   * (in that order) filled w/ the contents of `linearProgramData'.
+   */
+  QVector<StringTableModel>
+  makeTableModels(const LinearProgramData<T>& linearProgramData)
+  {
+    const int rows(int(linearProgramData.constraintsCount()));
+    const int cols(int(linearProgramData.variablesCount()));
+
+    QVector<StringTableModel> tableModels{
+      StringTableModel(1, cols),
+      StringTableModel(rows, cols),
+      StringTableModel(rows, 1)
+    };
+
+    fill<T>(&tableModels[0], linearProgramData.objectiveFunctionCoeffs);
+    fill<T>(&tableModels[1], linearProgramData.constraintsCoeffs);
+    fill<T>(&tableModels[2], linearProgramData.constraintsRHS);
+
+    return tableModels;
+  }
+
+
+  template<typename T = real_t>
+  /**
+   * @brief makeLinearProgramData
+   * @param objFuncModel
+   * @param constrsModel
+   * @param rhsModel
+   * @return
+   */
+  LinearProgramData<T>
+  makeLinearProgramData(
+    StringTableModel* objFuncModel,
+    StringTableModel* constrsModel,
+    StringTableModel* rhsModel
+  ) throw(invalid_argument)
+  {
+    return LinearProgramData<T>(
+      makeRowVector<T>(objFuncModel),
+      makeMatrix<T>(constrsModel),
+      makeColumnVector<T>(rhsModel)
+    );
+  }
 }
 
 
@@ -0,0 +1,151 @@
+﻿#pragma once
+
+#ifndef BINARYFORMAT_HXX
+#define BINARYFORMAT_HXX
+
+
+#include <cstdint>
+
+#include "parseerror.hxx"
+#include "../math/numerictypes.hxx"
+#include "../misc/utils.hxx"
+
+
+namespace ProgramIO
+{
+  using NumericTypes::Field;
+  using Utils::AlwaysFalse;
+
+
+  /**
+   * @brief The BinaryLayout enum
+   * Storage of the constraints matrix: `Dense' is the column-major
+   * array, `CSC' is the compressed sparse column one.
+   */
+  enum struct BinaryLayout : uint32_t
+  {
+    Dense = 0,
+    CSC = 1
+  };
+
+
+  /**
+   * @brief The BinaryHeader struct
+   * Leading block of the binary program file. All the integers have
+   * the native byte order, `byteOrderMark' is used to detect a foreign
+   * one. Offsets are from the beginning of the file and are multiples
+   * of `Config::ProgramIO::BinaryAlignment'.
+   * The arrays are:
+   *   objective: `cols' scalars (the `c' row vector);
+   *   rhs: `rows' scalars (the `b' column vector);
+   *   values: `rows' * `cols' scalars for `BinaryLayout::Dense',
+   *     `nonZeros' scalars for `BinaryLayout::CSC';
+   *   outerIndices: `cols' + 1 int32s, `BinaryLayout::CSC' only;
+   *   innerIndices: `nonZeros' int32s, `BinaryLayout::CSC' only.
+   */
+  struct BinaryHeader
+  {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint32_t field;
+    uint32_t layout;
+    uint32_t scalarSize;
+    uint32_t reserved;
+    uint64_t rows;
+    uint64_t cols;
+    uint64_t nonZeros;
+    uint64_t objectiveOffset;
+    uint64_t rhsOffset;
+    uint64_t valuesOffset;
+    uint64_t outerIndicesOffset;
+    uint64_t innerIndicesOffset;
+    uint64_t fileSize;
+    uint64_t padding[3];
+  };
+
+
+  static_assert(
+    sizeof(BinaryHeader) == 128,
+    "ProgramIO::BinaryHeader: unexpected padding"
+  );
+
+
+  constexpr char BinaryMagic[8] = {'L', 'P', 'B', 'I', 'N', '\r', '\n', '\x1A'};
+
+  constexpr uint32_t BinaryByteOrderMark = 0x01020304;
+
+
+  template<typename T>
+  /**
+   * @brief The BinaryScalar struct
+   * Describes how the scalars of type `T' are stored and read back
+   * (see `read'). Only the types
+   * w/ the fixed-size trivially copyable representation are supported.
+   */
+  struct BinaryScalar
+  {
+    static_assert(
+      AlwaysFalse<T>::value,
+      "ProgramIO::BinaryScalar<T>: "
+      "You can only use one of the specified template specializations!"
+    );
+  };
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  using NumericTypes::rational_t;
+  using NumericTypes::real_t;
+
+
+  template<>
+  struct BinaryScalar<real_t>
+  {
+    static constexpr Field field = Field::Real;
+
+
+    static real_t read(const real_t& value)
+    {
+      return value;
+    }
+  };
+
+
+  template<>
+  /**
+   * NOTE: Rationals are stored as is, i.e. as the (numerator,
+   * denominator) pairs of `integer_t'.
+   */
+  struct BinaryScalar<rational_t>
+  {
+    static constexpr Field field = Field::Rational;
+
+
+    /**
+     * @brief read
+     * The stored pair is not trusted: the denominator must be positive,
+     * the fraction is brought to the lowest terms.
+     * @param value
+     * @return
+     */
+    static rational_t read(const rational_t& value) throw(ParseError)
+    {
+      if (value.denominator() <= 0)
+      {
+        throw ParseError("Corrupted rational number");
+      }
+
+      return rational_t(value.numerator(), value.denominator());
+    }
+  };
+
+
+  static_assert(
+    sizeof(rational_t) == 2 * sizeof(NumericTypes::integer_t),
+    "ProgramIO::BinaryScalar<rational_t>: unexpected layout"
+  );
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // BINARYFORMAT_HXX
@@ -0,0 +1,192 @@
+﻿#include "binaryprogram.hxx"
+
+#include <cstdint>
+#include <cstring>
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "binaryformat.hxx"
+#include "mappedfile.hxx"
+#include "parseerror.hxx"
+#include "../config.hxx"
+
+
+namespace ProgramIO
+{
+  using std::runtime_error;
+  using std::string;
+
+
+  /**
+   * @brief BinaryProgram::BinaryProgram
+   * Maps the file and checks its header.
+   * @param fileName
+   */
+  BinaryProgram::BinaryProgram(const string& fileName) throw(ParseError)
+  try :
+    file_(new MappedFile(fileName))
+  {
+    data_ = file_->begin();
+    size_ = file_->size();
+
+    readHeader();
+  }
+  catch (const ParseError&)
+  {
+    throw;
+  }
+  catch (const runtime_error& re)
+  {
+    throw ParseError(re.what());
+  }
+
+
+  /**
+   * @brief BinaryProgram::BinaryProgram
+   * Checks the header of the image in memory. The arrays of the image
+   * must be aligned as in the mapped file (see
+   * `Config::ProgramIO::BinaryAlignment').
+   * @param first
+   * @param last
+   */
+  BinaryProgram::BinaryProgram(const char* first, const char* last)
+  throw(ParseError) :
+    data_(first),
+    size_(last - first)
+  {
+    readHeader();
+  }
+
+
+  Field
+  BinaryProgram::field() const
+  {
+    return Field(header_.field);
+  }
+
+
+  BinaryLayout
+  BinaryProgram::layout() const
+  {
+    return BinaryLayout(header_.layout);
+  }
+
+
+  DenseIndex
+  BinaryProgram::constraintsCount() const
+  {
+    return DenseIndex(header_.rows);
+  }
+
+
+  DenseIndex
+  BinaryProgram::variablesCount() const
+  {
+    return DenseIndex(header_.cols);
+  }
+
+
+  void
+  BinaryProgram::readHeader() throw(ParseError)
+  {
+    if (size_ < sizeof(header_))
+    {
+      throw ParseError("The file is too short to be a binary program");
+    }
+
+    std::memcpy(&header_, data_, sizeof(header_));
+
+    validate();
+  }
+
+
+  /**
+   * @brief BinaryProgram::validate
+   * Checks that the header is consistent and that all the arrays
+   * lie inside of the file. Takes O(1) time, the contents of the sparse
+   * index arrays are checked on conversion only.
+   */
+  void
+  BinaryProgram::validate() const throw(ParseError)
+  {
+    if (std::memcmp(header_.magic, BinaryMagic, sizeof(BinaryMagic)) != 0)
+    {
+      throw ParseError("The file is not a binary program");
+    }
+
+    if (header_.byteOrderMark != BinaryByteOrderMark)
+    {
+      throw ParseError("The file has the foreign byte order");
+    }
+
+    if (header_.version != Config::ProgramIO::BinaryFormatVersion)
+    {
+      throw ParseError(
+        "Unsupported binary format version " + std::to_string(header_.version)
+      );
+    }
+
+    if (
+      header_.field != uint32_t(Field::Real) &&
+      header_.field != uint32_t(Field::Rational)
+    )
+    {
+      throw ParseError("Unknown field tag");
+    }
+
+    if (
+      header_.layout != uint32_t(BinaryLayout::Dense) &&
+      header_.layout != uint32_t(BinaryLayout::CSC)
+    )
+    {
+      throw ParseError("Unknown matrix layout");
+    }
+
+    const uint64_t maxDimension(std::numeric_limits<int32_t>::max());
+    if (
+      header_.rows == 0 || header_.cols == 0 ||
+      header_.rows >= maxDimension || header_.cols >= maxDimension ||
+      header_.nonZeros > header_.rows * header_.cols ||
+      header_.scalarSize == 0 || header_.scalarSize > 64 ||
+      header_.fileSize != size_
+    )
+    {
+      throw ParseError("Corrupted header");
+    }
+
+    const uint64_t alignment(Config::ProgramIO::BinaryAlignment);
+    const auto check([this, alignment](uint64_t offset, uint64_t size)
+    {
+      if (
+        offset % alignment != 0 || offset < sizeof(header_) ||
+        offset > header_.fileSize || size > header_.fileSize - offset
+      )
+      {
+        throw ParseError("Array lies outside of the file");
+      }
+    });
+
+    check(header_.objectiveOffset, header_.scalarSize * header_.cols);
+    check(header_.rhsOffset, header_.scalarSize * header_.rows);
+
+    if (layout() == BinaryLayout::Dense)
+    {
+      if (header_.nonZeros != header_.rows * header_.cols)
+      {
+        throw ParseError("Corrupted header");
+      }
+
+      check(header_.valuesOffset, header_.scalarSize * header_.nonZeros);
+    }
+    else
+    {
+      check(header_.valuesOffset, header_.scalarSize * header_.nonZeros);
+      check(
+        header_.outerIndicesOffset, sizeof(int32_t) * (header_.cols + 1)
+      );
+      check(header_.innerIndicesOffset, sizeof(int32_t) * header_.nonZeros);
+    }
+  }
+}
@@ -0,0 +1,85 @@
+﻿#pragma once
+
+#ifndef BINARYPROGRAM_HXX
+#define BINARYPROGRAM_HXX
+
+
+#include <cstddef>
+
+#include <memory>
+#include <string>
+
+#include "eigen3/Eigen/Core"
+
+#include "binaryformat.hxx"
+#include "binaryprogramview.hxx"
+#include "mappedfile.hxx"
+#include "parseerror.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using Eigen::DenseIndex;
+  using NumericTypes::Field;
+  using NumericTypes::real_t;
+  using std::size_t;
+  using std::string;
+  using std::unique_ptr;
+
+
+  /**
+   * @brief The BinaryProgram class
+   * Program file in the binary format, mapped into memory.
+   * Opening it only maps the file and checks the header, the pages
+   * are read when the views returned by `view' are accessed.
+   * The mapping is read-only, so the same file can be shared
+   * between processes.
+   * The program can also be read from the image in memory, which is
+   * not copied and must outlive the object and its views.
+   */
+  class BinaryProgram
+  {
+    public:
+      explicit BinaryProgram(const string& fileName) throw(ParseError);
+
+      BinaryProgram(const char* first, const char* last) throw(ParseError);
+
+      BinaryProgram(const BinaryProgram& other) = delete;
+
+      const BinaryProgram& operator =(const BinaryProgram& other) = delete;
+
+      Field field() const;
+
+      BinaryLayout layout() const;
+
+      DenseIndex constraintsCount() const;
+
+      DenseIndex variablesCount() const;
+
+      template<typename T = real_t>
+      BinaryProgramView<T> view() const throw(ParseError);
+
+
+    private:
+      //NOTE: `nullptr' for the images in memory
+      unique_ptr<MappedFile> file_;
+
+      const char* data_ = nullptr;
+
+      size_t size_ = 0;
+
+      BinaryHeader header_;
+
+
+      void readHeader() throw(ParseError);
+
+      void validate() const throw(ParseError);
+  };
+}
+
+
+#include "binaryprogram.txx"
+
+
+#endif // BINARYPROGRAM_HXX
@@ -0,0 +1,37 @@
+﻿#pragma once
+
+#ifndef BINARYPROGRAM_TXX
+#define BINARYPROGRAM_TXX
+
+
+#include "binaryprogram.hxx"
+
+#include "binaryformat.hxx"
+#include "binaryprogramview.hxx"
+#include "parseerror.hxx"
+
+
+namespace ProgramIO
+{
+  template<typename T>
+  /**
+   * @brief BinaryProgram::view
+   * @return View of the program, `T' must match the field of the file.
+   */
+  BinaryProgramView<T>
+  BinaryProgram::view() const throw(ParseError)
+  {
+    if (
+      field() != BinaryScalar<T>::field ||
+      header_.scalarSize != sizeof(T)
+    )
+    {
+      throw ParseError("The program is stored in the other field");
+    }
+
+    return BinaryProgramView<T>(header_, data_);
+  }
+}
+
+
+#endif // BINARYPROGRAM_TXX
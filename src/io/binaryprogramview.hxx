@@ -0,0 +1,80 @@
+﻿#pragma once
+
+#ifndef BINARYPROGRAMVIEW_HXX
+#define BINARYPROGRAMVIEW_HXX
+
+
+#include <cstdint>
+
+#include <stdexcept>
+
+#include "eigen3/Eigen/Core"
+#include "eigen3/Eigen/SparseCore"
+
+#include "binaryformat.hxx"
+#include "parseerror.hxx"
+#include "../lp/linearprogramdata.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using Eigen::ColMajor;
+  using Eigen::Dynamic;
+  using Eigen::Map;
+  using Eigen::MappedSparseMatrix;
+  using Eigen::Matrix;
+  using LinearProgramming::LinearProgramData;
+  using NumericTypes::real_t;
+  using std::logic_error;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The BinaryProgramView class
+   * Zero-copy view of the program stored in the mapped binary file.
+   * The view does not own the memory, so it must not outlive
+   * the `BinaryProgram' it was obtained from. The scalars are not
+   * checked by the views, only by `linearProgramData'.
+   */
+  class BinaryProgramView
+  {
+    public:
+      BinaryProgramView(const BinaryHeader& header, const char* data);
+
+      BinaryLayout layout() const;
+
+      Map<const Matrix<T, 1, Dynamic>> objectiveFunctionCoeffs() const;
+
+      Map<const Matrix<T, Dynamic, Dynamic>> constraintsCoeffs() const
+      throw(logic_error);
+
+      const MappedSparseMatrix<T, ColMajor, int32_t>
+      sparseConstraintsCoeffs() const throw(logic_error);
+
+      Map<const Matrix<T, Dynamic, 1>> constraintsRHS() const;
+
+      LinearProgramData<T> linearProgramData() const throw(ParseError);
+
+
+    private:
+      BinaryHeader header_;
+
+      const char* data_;
+
+
+      template<typename R>
+      const R* array(uint64_t offset) const;
+
+      template<int Rows, int Cols>
+      Matrix<T, Rows, Cols>
+      copy(const Map<const Matrix<T, Rows, Cols>>& view) const
+      throw(ParseError);
+  };
+}
+
+
+#include "binaryprogramview.txx"
+
+
+#endif // BINARYPROGRAMVIEW_HXX
@@ -0,0 +1,210 @@
+﻿#pragma once
+
+#ifndef BINARYPROGRAMVIEW_TXX
+#define BINARYPROGRAMVIEW_TXX
+
+
+#include "binaryprogramview.hxx"
+
+#include <cstdint>
+
+#include <stdexcept>
+
+#include "eigen3/Eigen/Core"
+#include "eigen3/Eigen/SparseCore"
+
+#include "binaryformat.hxx"
+#include "parseerror.hxx"
+#include "../lp/linearprogramdata.hxx"
+
+
+namespace ProgramIO
+{
+  using Eigen::ColMajor;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Map;
+  using Eigen::MappedSparseMatrix;
+  using Eigen::Matrix;
+  using LinearProgramming::LinearProgramData;
+  using std::logic_error;
+
+
+  template<typename T>
+  /**
+   * @brief BinaryProgramView<T>::BinaryProgramView
+   * @param header Validated header of the file.
+   * @param data Beginning of the mapped file.
+   */
+  BinaryProgramView<T>::BinaryProgramView(
+    const BinaryHeader& header, const char* data
+  ) :
+    header_(header),
+    data_(data)
+  { }
+
+
+  template<typename T>
+  BinaryLayout
+  BinaryProgramView<T>::layout() const
+  {
+    return BinaryLayout(header_.layout);
+  }
+
+
+  template<typename T>
+  Map<const Matrix<T, 1, Dynamic>>
+  BinaryProgramView<T>::objectiveFunctionCoeffs() const
+  {
+    return Map<const Matrix<T, 1, Dynamic>>(
+      array<T>(header_.objectiveOffset), 1, DenseIndex(header_.cols)
+    );
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BinaryProgramView<T>::constraintsCoeffs
+   * @return View of the dense constraints matrix.
+   * Available for `BinaryLayout::Dense' only.
+   */
+  Map<const Matrix<T, Dynamic, Dynamic>>
+  BinaryProgramView<T>::constraintsCoeffs() const throw(logic_error)
+  {
+    if (layout() != BinaryLayout::Dense)
+    {
+      throw logic_error("The constraints matrix is not dense");
+    }
+
+    return Map<const Matrix<T, Dynamic, Dynamic>>(
+      array<T>(header_.valuesOffset),
+      DenseIndex(header_.rows), DenseIndex(header_.cols)
+    );
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BinaryProgramView<T>::sparseConstraintsCoeffs
+   * @return View of the compressed constraints matrix.
+   * Available for `BinaryLayout::CSC' only.
+   * NOTE: `MappedSparseMatrix' wants the mutable pointers, but
+   * the returned view is const and the mapping is read-only.
+   */
+  const MappedSparseMatrix<T, ColMajor, int32_t>
+  BinaryProgramView<T>::sparseConstraintsCoeffs() const throw(logic_error)
+  {
+    if (layout() != BinaryLayout::CSC)
+    {
+      throw logic_error("The constraints matrix is not compressed");
+    }
+
+    return MappedSparseMatrix<T, ColMajor, int32_t>(
+      int32_t(header_.rows), int32_t(header_.cols), int32_t(header_.nonZeros),
+      const_cast<int32_t*>(array<int32_t>(header_.outerIndicesOffset)),
+      const_cast<int32_t*>(array<int32_t>(header_.innerIndicesOffset)),
+      const_cast<T*>(array<T>(header_.valuesOffset))
+    );
+  }
+
+
+  template<typename T>
+  Map<const Matrix<T, Dynamic, 1>>
+  BinaryProgramView<T>::constraintsRHS() const
+  {
+    return Map<const Matrix<T, Dynamic, 1>>(
+      array<T>(header_.rhsOffset), DenseIndex(header_.rows), 1
+    );
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BinaryProgramView<T>::linearProgramData
+   * Copies the program into the (dense) storage used by the solvers.
+   * The scalars (see `BinaryScalar::read') and the sparse indices
+   * are checked here, as the views do not do that.
+   * @return
+   */
+  LinearProgramData<T>
+  BinaryProgramView<T>::linearProgramData() const throw(ParseError)
+  {
+    const DenseIndex rows(header_.rows);
+    const DenseIndex cols(header_.cols);
+
+    if (layout() == BinaryLayout::Dense)
+    {
+      return LinearProgramData<T>(
+        copy(objectiveFunctionCoeffs()), copy(constraintsCoeffs()),
+        copy(constraintsRHS())
+      );
+    }
+
+    const int32_t* const outer(array<int32_t>(header_.outerIndicesOffset));
+    const int32_t* const inner(array<int32_t>(header_.innerIndicesOffset));
+    const T* const values(array<T>(header_.valuesOffset));
+
+    Matrix<T, Dynamic, Dynamic> coeffs(
+      Matrix<T, Dynamic, Dynamic>::Zero(rows, cols)
+    );
+
+    for (DenseIndex j(0); j < cols; ++j)
+    {
+      if (
+        outer[j] < 0 || outer[j] > outer[j + 1] ||
+        uint64_t(outer[j + 1]) > header_.nonZeros
+      )
+      {
+        throw ParseError("Corrupted column pointers");
+      }
+
+      for (int32_t k(outer[j]); k < outer[j + 1]; ++k)
+      {
+        if (inner[k] < 0 || inner[k] >= rows)
+        {
+          throw ParseError("Corrupted row indices");
+        }
+
+        coeffs(inner[k], j) = BinaryScalar<T>::read(values[k]);
+      }
+    }
+
+    return LinearProgramData<T>(
+      copy(objectiveFunctionCoeffs()), coeffs, copy(constraintsRHS())
+    );
+  }
+
+
+  template<typename T>
+  template<typename R>
+  const R*
+  BinaryProgramView<T>::array(uint64_t offset) const
+  {
+    return reinterpret_cast<const R*>(data_ + offset);
+  }
+
+
+  template<typename T>
+  template<int Rows, int Cols>
+  /**
+   * @brief BinaryProgramView<T>::copy
+   * @param view
+   * @return Copy of `view' w/ every scalar checked by `BinaryScalar::read'.
+   */
+  Matrix<T, Rows, Cols>
+  BinaryProgramView<T>::copy(const Map<const Matrix<T, Rows, Cols>>& view) const
+  throw(ParseError)
+  {
+    Matrix<T, Rows, Cols> ret(view.rows(), view.cols());
+
+    for (DenseIndex k(0); k < view.size(); ++k)
+    {
+      ret(k) = BinaryScalar<T>::read(view(k));
+    }
+
+    return ret;
+  }
+}
+
+
+#endif // BINARYPROGRAMVIEW_TXX
@@ -0,0 +1,47 @@
+﻿#pragma once
+
+#ifndef BINARYWRITER_HXX
+#define BINARYWRITER_HXX
+
+
+#include <ostream>
+#include <stdexcept>
+
+#include "binaryformat.hxx"
+#include "../lp/linearprogramdata.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using LinearProgramming::LinearProgramData;
+  using NumericTypes::real_t;
+  using std::ostream;
+  using std::runtime_error;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The BinaryWriter class
+   * Writes the program in the binary format (see `BinaryHeader').
+   */
+  class BinaryWriter
+  {
+    public:
+      explicit BinaryWriter(BinaryLayout layout = BinaryLayout::Dense);
+
+      void write(
+        ostream& stream, const LinearProgramData<T>& linearProgramData
+      ) const throw(runtime_error);
+
+
+    private:
+      BinaryLayout layout_;
+  };
+}
+
+
+#include "binarywriter.txx"
+
+
+#endif // BINARYWRITER_HXX
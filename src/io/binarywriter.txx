@@ -0,0 +1,197 @@
+﻿#pragma once
+
+#ifndef BINARYWRITER_TXX
+#define BINARYWRITER_TXX
+
+
+#include "binarywriter.hxx"
+
+#include <cstdint>
+#include <cstring>
+
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include "eigen3/Eigen/Core"
+
+#include "binaryformat.hxx"
+#include "../config.hxx"
+#include "../lp/linearprogramdata.hxx"
+
+
+namespace ProgramIO
+{
+  using Eigen::DenseIndex;
+  using LinearProgramming::LinearProgramData;
+  using std::ostream;
+  using std::runtime_error;
+  using std::vector;
+
+
+  namespace Detail
+  {
+    inline uint64_t
+    alignOffset(uint64_t offset)
+    {
+      const uint64_t alignment(Config::ProgramIO::BinaryAlignment);
+
+      return ((offset + alignment - 1) / alignment) * alignment;
+    }
+
+
+    inline void
+    writePadding(ostream& stream, uint64_t from, uint64_t to)
+    {
+      static const char Zeros[Config::ProgramIO::BinaryAlignment] = { };
+
+      stream.write(Zeros, std::streamsize(to - from));
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BinaryWriter<T>::BinaryWriter
+   * @param layout
+   */
+  BinaryWriter<T>::BinaryWriter(BinaryLayout layout) :
+    layout_(layout)
+  { }
+
+
+  template<typename T>
+  /**
+   * @brief BinaryWriter<T>::write
+   * @param stream Stream opened in the binary mode.
+   * @param linearProgramData
+   */
+  void
+  BinaryWriter<T>::write(
+    ostream& stream, const LinearProgramData<T>& linearProgramData
+  ) const throw(runtime_error)
+  {
+    const DenseIndex rows(linearProgramData.constraintsCount());
+    const DenseIndex cols(linearProgramData.variablesCount());
+
+    if (
+      rows >= std::numeric_limits<int32_t>::max() ||
+      cols >= std::numeric_limits<int32_t>::max()
+    )
+    {
+      throw runtime_error("The program is too large for the binary format");
+    }
+
+    //Compress the constraints matrix column by column
+    vector<int32_t> outerIndices;
+    vector<int32_t> innerIndices;
+    vector<T> values;
+    if (layout_ == BinaryLayout::CSC)
+    {
+      outerIndices.reserve(cols + 1);
+      outerIndices.push_back(0);
+
+      for (DenseIndex j(0); j < cols; ++j)
+      {
+        for (DenseIndex i(0); i < rows; ++i)
+        {
+          if (linearProgramData.constraintsCoeffs(i, j) != T(0))
+          {
+            innerIndices.push_back(int32_t(i));
+            values.push_back(linearProgramData.constraintsCoeffs(i, j));
+          }
+        }
+
+        if (values.size() >= size_t(std::numeric_limits<int32_t>::max()))
+        {
+          throw runtime_error(
+            "The program is too large for the binary format"
+          );
+        }
+
+        outerIndices.push_back(int32_t(values.size()));
+      }
+    }
+
+    const uint64_t scalarSize(sizeof(T));
+    const uint64_t nonZeros(
+      layout_ == BinaryLayout::CSC ? values.size() : uint64_t(rows * cols)
+    );
+
+    BinaryHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, BinaryMagic, sizeof(header.magic));
+    header.version = Config::ProgramIO::BinaryFormatVersion;
+    header.byteOrderMark = BinaryByteOrderMark;
+    header.field = uint32_t(BinaryScalar<T>::field);
+    header.layout = uint32_t(layout_);
+    header.scalarSize = uint32_t(scalarSize);
+    header.rows = uint64_t(rows);
+    header.cols = uint64_t(cols);
+    header.nonZeros = nonZeros;
+
+    uint64_t offset(Detail::alignOffset(sizeof(header)));
+    header.objectiveOffset = offset;
+    offset = Detail::alignOffset(offset + scalarSize * cols);
+    header.rhsOffset = offset;
+    offset = Detail::alignOffset(offset + scalarSize * rows);
+    header.valuesOffset = offset;
+    offset += scalarSize * nonZeros;
+    if (layout_ == BinaryLayout::CSC)
+    {
+      offset = Detail::alignOffset(offset);
+      header.outerIndicesOffset = offset;
+      offset = Detail::alignOffset(offset + sizeof(int32_t) * (cols + 1));
+      header.innerIndicesOffset = offset;
+      offset += sizeof(int32_t) * nonZeros;
+    }
+    header.fileSize = offset;
+
+    //NOTE: Eigen matrices are column-major, so the dense arrays
+    //are written as is
+    uint64_t position(0);
+    const auto put([&stream, &position](const void* data, uint64_t size)
+    {
+      stream.write(static_cast<const char*>(data), std::streamsize(size));
+      position += size;
+    });
+    const auto padTo([&stream, &position](uint64_t to)
+    {
+      Detail::writePadding(stream, position, to);
+      position = to;
+    });
+
+    put(&header, sizeof(header));
+
+    padTo(header.objectiveOffset);
+    put(linearProgramData.objectiveFunctionCoeffs.data(), scalarSize * cols);
+
+    padTo(header.rhsOffset);
+    put(linearProgramData.constraintsRHS.data(), scalarSize * rows);
+
+    padTo(header.valuesOffset);
+    if (layout_ == BinaryLayout::CSC)
+    {
+      put(values.data(), scalarSize * nonZeros);
+
+      padTo(header.outerIndicesOffset);
+      put(outerIndices.data(), sizeof(int32_t) * outerIndices.size());
+
+      padTo(header.innerIndicesOffset);
+      put(innerIndices.data(), sizeof(int32_t) * nonZeros);
+    }
+    else
+    {
+      put(linearProgramData.constraintsCoeffs.data(), scalarSize * nonZeros);
+    }
+
+    if (!stream)
+    {
+      throw runtime_error("Couldn't write the program");
+    }
+  }
+}
+
+
+#endif // BINARYWRITER_TXX
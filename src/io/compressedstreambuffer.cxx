@@ -0,0 +1,236 @@
+﻿#include "compressedstreambuffer.hxx"
+
+#include <cstddef>
+
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+
+#include <zlib.h>
+
+#include "parseerror.hxx"
+#include "../config.hxx"
+
+
+namespace ProgramIO
+{
+  using std::runtime_error;
+  using std::size_t;
+  using std::streambuf;
+  using std::streamsize;
+  using std::string;
+
+
+  /**
+   * @brief InflatingStreamBuffer::InflatingStreamBuffer
+   * @param source Buffer of the compressed data.
+   */
+  InflatingStreamBuffer::InflatingStreamBuffer(streambuf* source)
+  throw(runtime_error) :
+    source_(source),
+    zStream_(),
+    input_(Config::ProgramIO::CompressedChunkSize),
+    output_(Config::ProgramIO::CompressedChunkSize)
+  {
+    //NOTE: (MAX_WBITS + 32) enables the gzip/zlib header auto-detection
+    if (inflateInit2(&zStream_, MAX_WBITS + 32) != Z_OK)
+    {
+      throw runtime_error("Couldn't initialize the decompressor");
+    }
+
+    setg(output_.data(), output_.data(), output_.data());
+  }
+
+
+  InflatingStreamBuffer::~InflatingStreamBuffer()
+  {
+    inflateEnd(&zStream_);
+  }
+
+
+  /**
+   * @brief InflatingStreamBuffer::underflow
+   * Decompresses the next chunk into the get area.
+   * @return
+   */
+  InflatingStreamBuffer::int_type
+  InflatingStreamBuffer::underflow()
+  {
+    if (gptr() < egptr())
+    {
+      return traits_type::to_int_type(*gptr());
+    }
+
+    while (!isFinished_)
+    {
+      if (zStream_.avail_in == 0)
+      {
+        const streamsize count(source_->sgetn(input_.data(), input_.size()));
+        if (count <= 0)
+        {
+          throw ParseError("Unexpected end of the compressed data");
+        }
+
+        zStream_.next_in = reinterpret_cast<Bytef*>(input_.data());
+        zStream_.avail_in = uInt(count);
+      }
+
+      zStream_.next_out = reinterpret_cast<Bytef*>(output_.data());
+      zStream_.avail_out = uInt(output_.size());
+
+      const int result(inflate(&zStream_, Z_NO_FLUSH));
+      if (result == Z_STREAM_END)
+      {
+        //Either the end of data or the next gzip member
+        if (
+          zStream_.avail_in == 0 &&
+          traits_type::eq_int_type(source_->sgetc(), traits_type::eof())
+        )
+        {
+          isFinished_ = true;
+        }
+        else
+        {
+          inflateReset(&zStream_);
+        }
+      }
+      else if (result != Z_OK && result != Z_BUF_ERROR)
+      {
+        throw ParseError(
+          string("Corrupted compressed data: ") +
+          (zStream_.msg != nullptr ? zStream_.msg : "unknown error")
+        );
+      }
+
+      const size_t count(output_.size() - zStream_.avail_out);
+      if (count > 0)
+      {
+        setg(output_.data(), output_.data(), output_.data() + count);
+
+        return traits_type::to_int_type(*gptr());
+      }
+    }
+
+    return traits_type::eof();
+  }
+
+
+  /**
+   * @brief DeflatingStreamBuffer::DeflatingStreamBuffer
+   * @param sink Buffer to write the compressed data to.
+   */
+  DeflatingStreamBuffer::DeflatingStreamBuffer(streambuf* sink)
+  throw(runtime_error) :
+    sink_(sink),
+    zStream_(),
+    input_(Config::ProgramIO::CompressedChunkSize),
+    output_(Config::ProgramIO::CompressedChunkSize)
+  {
+    //NOTE: (MAX_WBITS + 16) makes zlib write the gzip header and trailer
+    if (
+      deflateInit2(
+        &zStream_, Config::ProgramIO::CompressionLevel, Z_DEFLATED,
+        MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY
+      ) != Z_OK
+    )
+    {
+      throw runtime_error("Couldn't initialize the compressor");
+    }
+
+    setp(input_.data(), input_.data() + input_.size());
+  }
+
+
+  DeflatingStreamBuffer::~DeflatingStreamBuffer()
+  {
+    finish();
+    deflateEnd(&zStream_);
+  }
+
+
+  /**
+   * @brief DeflatingStreamBuffer::finish
+   * Compresses the rest of the data and writes the gzip trailer.
+   * Nothing can be written after that.
+   * @return `false' if the data couldn't be written.
+   */
+  bool
+  DeflatingStreamBuffer::finish()
+  {
+    if (isFinished_)
+    {
+      return true;
+    }
+
+    const bool isDeflated(deflateInput(Z_FINISH));
+    isFinished_ = true;
+
+    return (isDeflated && sink_->pubsync() != -1);
+  }
+
+
+  DeflatingStreamBuffer::int_type
+  DeflatingStreamBuffer::overflow(int_type c)
+  {
+    if (isFinished_ || !deflateInput(Z_NO_FLUSH))
+    {
+      return traits_type::eof();
+    }
+
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+
+    return traits_type::not_eof(c);
+  }
+
+
+  int
+  DeflatingStreamBuffer::sync()
+  {
+    if (isFinished_)
+    {
+      return 0;
+    }
+
+    return (deflateInput(Z_SYNC_FLUSH) ? sink_->pubsync() : -1);
+  }
+
+
+  /**
+   * @brief DeflatingStreamBuffer::deflateInput
+   * Compresses the put area and writes the result to the sink.
+   * @param flush
+   * @return `false' on error.
+   */
+  bool
+  DeflatingStreamBuffer::deflateInput(int flush)
+  {
+    zStream_.next_in = reinterpret_cast<Bytef*>(pbase());
+    zStream_.avail_in = uInt(pptr() - pbase());
+
+    do
+    {
+      zStream_.next_out = reinterpret_cast<Bytef*>(output_.data());
+      zStream_.avail_out = uInt(output_.size());
+
+      if (deflate(&zStream_, flush) == Z_STREAM_ERROR)
+      {
+        return false;
+      }
+
+      const streamsize count(output_.size() - zStream_.avail_out);
+      if (count > 0 && sink_->sputn(output_.data(), count) != count)
+      {
+        return false;
+      }
+    }
+    while (zStream_.avail_out == 0);
+
+    setp(input_.data(), input_.data() + input_.size());
+
+    return true;
+  }
+}
@@ -0,0 +1,104 @@
+﻿#pragma once
+
+#ifndef COMPRESSEDSTREAMBUFFER_HXX
+#define COMPRESSEDSTREAMBUFFER_HXX
+
+
+#include <stdexcept>
+#include <streambuf>
+#include <vector>
+
+#include <zlib.h>
+
+#include "parseerror.hxx"
+
+
+namespace ProgramIO
+{
+  using std::runtime_error;
+  using std::streambuf;
+  using std::vector;
+
+
+  /**
+   * @brief The InflatingStreamBuffer class
+   * Input stream buffer that decompresses the gzip or zlib data read
+   * from the underlying buffer on the fly, one chunk at a time.
+   * Concatenated gzip members are read as the single stream.
+   * NOTE: `ParseError' is thrown from `underflow' on the corrupted
+   * data, so the stream using this buffer should have `badbit'
+   * in its exceptions mask.
+   */
+  class InflatingStreamBuffer :
+    public streambuf
+  {
+    public:
+      explicit InflatingStreamBuffer(streambuf* source) throw(runtime_error);
+
+      InflatingStreamBuffer(const InflatingStreamBuffer&) = delete;
+      InflatingStreamBuffer& operator =(const InflatingStreamBuffer&) = delete;
+
+      ~InflatingStreamBuffer();
+
+
+    protected:
+      virtual int_type underflow() override;
+
+
+    private:
+      streambuf* source_;
+
+      z_stream zStream_;
+
+      vector<char> input_;
+
+      vector<char> output_;
+
+      bool isFinished_ = false;
+  };
+
+
+  /**
+   * @brief The DeflatingStreamBuffer class
+   * Output stream buffer that writes the gzip-compressed data
+   * to the underlying buffer. The gzip trailer is written by `finish'
+   * (or by the destructor, w/o reporting errors).
+   */
+  class DeflatingStreamBuffer :
+    public streambuf
+  {
+    public:
+      explicit DeflatingStreamBuffer(streambuf* sink) throw(runtime_error);
+
+      DeflatingStreamBuffer(const DeflatingStreamBuffer&) = delete;
+      DeflatingStreamBuffer& operator =(const DeflatingStreamBuffer&) = delete;
+
+      ~DeflatingStreamBuffer();
+
+      bool finish();
+
+
+    protected:
+      virtual int_type overflow(int_type c) override;
+
+      virtual int sync() override;
+
+
+    private:
+      streambuf* sink_;
+
+      z_stream zStream_;
+
+      vector<char> input_;
+
+      vector<char> output_;
+
+      bool isFinished_ = false;
+
+
+      bool deflateInput(int flush);
+  };
+}
+
+
+#endif // COMPRESSEDSTREAMBUFFER_HXX
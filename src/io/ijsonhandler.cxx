@@ -0,0 +1,5 @@
+﻿#include "ijsonhandler.hxx"
+
+
+ProgramIO::IJsonHandler::~IJsonHandler()
+{ }
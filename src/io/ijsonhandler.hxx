@@ -0,0 +1,43 @@
+﻿#pragma once
+
+#ifndef IJSONHANDLER_HXX
+#define IJSONHANDLER_HXX
+
+
+#include <string>
+
+
+namespace ProgramIO
+{
+  using std::string;
+
+
+  /**
+   * @brief The IJsonHandler class
+   * Receives the events of `JsonParser'. Every callback returns
+   * `false' to stop the parsing.
+   */
+  class IJsonHandler
+  {
+    public:
+      virtual bool startObject() = 0;
+      virtual bool endObject() = 0;
+
+      virtual bool startArray() = 0;
+      virtual bool endArray() = 0;
+
+      virtual bool key(const string& name) = 0;
+
+      virtual bool stringValue(const string& value) = 0;
+      virtual bool numberValue(const char* first, const char* last) = 0;
+      virtual bool booleanValue(bool value) = 0;
+      virtual bool nullValue() = 0;
+
+
+    protected:
+      ~IJsonHandler();
+  };
+}
+
+
+#endif // IJSONHANDLER_HXX
@@ -0,0 +1,82 @@
+﻿#pragma once
+
+#ifndef IMPORTEDPROGRAM_HXX
+#define IMPORTEDPROGRAM_HXX
+
+
+#include <string>
+#include <vector>
+
+#include "eigen3/Eigen/Core"
+
+#include "../lp/columnmapping.hxx"
+#include "../lp/linearprogramdata.hxx"
+#include "../lp/optimizationgoaltype.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using LinearProgramming::ColumnMapping;
+  using LinearProgramming::LinearProgramData;
+  using LinearProgramming::OptimizationGoalType;
+  using NumericTypes::real_t;
+  using std::string;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The ImportedProgram struct
+   * The standard form (min (c, x): αx = β, x >= 0) of the program
+   * read from a file, along w/ everything needed to map its solution
+   * back to the original variables and objective.
+   */
+  struct ImportedProgram
+  {
+    Matrix<T, Dynamic, 1> originalPoint(const Matrix<T, Dynamic, 1>& x) const;
+
+    T originalValue(const T& value) const;
+
+
+    LinearProgramData<T> linearProgramData;
+
+    /**
+     * @brief goalType
+     * The original optimization sense. `linearProgramData' is always
+     * the minimization program, (max F) is stored as (min -F).
+     */
+    OptimizationGoalType goalType = OptimizationGoalType::Minimize;
+
+    /**
+     * @brief objectiveOffset
+     * Constant term of the standard form objective function.
+     */
+    T objectiveOffset = T(0);
+
+    string name;
+
+    vector<string> rowNames;
+
+    vector<string> columnNames;
+
+    vector<string> variableNames;
+
+    vector<ColumnMapping<T>> columnMappings;
+  };
+
+
+  template<typename T = real_t>
+  ImportedProgram<T> makeImportedProgram(
+    LinearProgramData<T>&& linearProgramData, const string& name = string()
+  );
+}
+
+
+#include "importedprogram.txx"
+
+
+#endif // IMPORTEDPROGRAM_HXX
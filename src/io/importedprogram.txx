@@ -0,0 +1,127 @@
+﻿#pragma once
+
+#ifndef IMPORTEDPROGRAM_TXX
+#define IMPORTEDPROGRAM_TXX
+
+
+#include "importedprogram.hxx"
+
+#include <string>
+#include <utility>
+
+#include "eigen3/Eigen/Core"
+#include "fmt/format.h"
+
+#include "../lp/linearprogramdata.hxx"
+#include "../lp/optimizationgoaltype.hxx"
+
+
+namespace ProgramIO
+{
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using fmt::format;
+  using LinearProgramming::LinearProgramData;
+  using LinearProgramming::OptimizationGoalType;
+  using std::string;
+
+
+  template<typename T>
+  /**
+   * @brief ImportedProgram<T>::originalPoint
+   * Maps the point `x' of the standard form program
+   * to the values of the original variables.
+   * @param x
+   * @return
+   */
+  Matrix<T, Dynamic, 1>
+  ImportedProgram<T>::originalPoint(const Matrix<T, Dynamic, 1>& x) const
+  {
+    Matrix<T, Dynamic, 1> ret(columnMappings.size(), 1);
+
+    for (DenseIndex j(0); j < ret.rows(); ++j)
+    {
+      const ColumnMapping<T>& mapping(columnMappings[j]);
+
+      ret(j) = mapping.offset;
+      if (mapping.positive >= 0)
+      {
+        ret(j) += x(mapping.positive);
+      }
+      if (mapping.negative >= 0)
+      {
+        ret(j) -= x(mapping.negative);
+      }
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ImportedProgram<T>::originalValue
+   * Maps the objective value of the standard form program
+   * to the value of the original objective function.
+   * @param value
+   * @return
+   */
+  T
+  ImportedProgram<T>::originalValue(const T& value) const
+  {
+    switch (goalType)
+    {
+      case OptimizationGoalType::Maximize:
+        return ((value + objectiveOffset) * T(-1));
+
+      case OptimizationGoalType::Minimize:
+        return (value + objectiveOffset);
+
+      default:
+        return value;
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief makeImportedProgram
+   * Wraps the standard form program, so its variables
+   * are the original ones.
+   * @param linearProgramData
+   * @param name
+   * @return
+   */
+  ImportedProgram<T>
+  makeImportedProgram(
+    LinearProgramData<T>&& linearProgramData, const string& name
+  )
+  {
+    ImportedProgram<T> ret;
+
+    ret.name = name;
+
+    for (DenseIndex i(0); i < linearProgramData.constraintsCount(); ++i)
+    {
+      ret.rowNames.push_back(format("R{}", i + 1));
+    }
+
+    for (DenseIndex j(0); j < linearProgramData.variablesCount(); ++j)
+    {
+      ret.columnNames.push_back(format("X{}", j + 1));
+
+      ColumnMapping<T> mapping;
+      mapping.positive = j;
+      ret.columnMappings.push_back(mapping);
+    }
+
+    ret.variableNames = ret.columnNames;
+    ret.linearProgramData = std::move(linearProgramData);
+
+    return ret;
+  }
+}
+
+
+#endif // IMPORTEDPROGRAM_TXX
@@ -0,0 +1,658 @@
+﻿#include "jsonparser.hxx"
+
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "ijsonhandler.hxx"
+#include "parseerror.hxx"
+#include "../config.hxx"
+
+
+namespace ProgramIO
+{
+  using std::istream;
+  using std::size_t;
+  using std::string;
+  using std::vector;
+
+
+  /**
+   * @brief JsonParser::JsonParser
+   * @param handler
+   */
+  JsonParser::JsonParser(IJsonHandler& handler) :
+    handler_(handler)
+  { }
+
+
+  /**
+   * @brief JsonParser::parse
+   * Parses the single JSON value from the characters range [first; last).
+   * @param first
+   * @param last
+   * @return `false' if the handler has stopped the parsing,
+   * `true' otherwise.
+   */
+  bool
+  JsonParser::parse(const char* first, const char* last) throw(ParseError)
+  {
+    reset();
+    it_ = first;
+    end_ = last;
+    isFinal_ = true;
+    skipByteOrderMark();
+
+    //Errors reported by the handler get the current line number
+    try
+    {
+      return (parseSome() != Status::Stopped);
+    }
+    catch (const ParseError& pe)
+    {
+      if (pe.line() == 0)
+      {
+        throw error(pe.what());
+      }
+
+      throw;
+    }
+  }
+
+
+  /**
+   * @brief JsonParser::parse
+   * Parses the single JSON value read from `stream' by chunks of
+   * `Config::ProgramIO::JsonChunkSize' bytes. Only the token cut by
+   * the end of the chunk is carried over to the next one.
+   * @param stream
+   * @return `false' if the handler has stopped the parsing,
+   * `true' otherwise.
+   */
+  bool
+  JsonParser::parse(istream& stream) throw(ParseError)
+  {
+    reset();
+
+    vector<char> chunk(Config::ProgramIO::JsonChunkSize);
+    size_t carried(0);
+    bool isFirst(true);
+
+    try
+    {
+      while (true)
+      {
+        //The token doesn't fit into the chunk
+        if (carried == chunk.size())
+        {
+          chunk.resize(chunk.size() * 2);
+        }
+
+        stream.read(chunk.data() + carried, chunk.size() - carried);
+        if (stream.bad())
+        {
+          throw ParseError("Couldn't read the stream");
+        }
+
+        it_ = chunk.data();
+        end_ = it_ + carried + size_t(stream.gcount());
+        isFinal_ = !stream;
+
+        if (isFirst)
+        {
+          skipByteOrderMark();
+          isFirst = false;
+        }
+
+        switch (parseSome())
+        {
+          case Status::Finished:
+            return true;
+
+          case Status::Stopped:
+            return false;
+
+          default:
+            break;
+        }
+
+        carried = size_t(end_ - it_);
+        std::memmove(chunk.data(), it_, carried);
+      }
+    }
+    catch (const ParseError& pe)
+    {
+      if (pe.line() == 0)
+      {
+        throw error(pe.what());
+      }
+
+      throw;
+    }
+  }
+
+
+  void
+  JsonParser::reset()
+  {
+    state_ = State::Value;
+    lineNumber_ = 1;
+    stack_.clear();
+  }
+
+
+  void
+  JsonParser::skipByteOrderMark()
+  {
+    if (end_ - it_ >= 3 && std::memcmp(it_, "\xEF\xBB\xBF", 3) == 0)
+    {
+      it_ += 3;
+    }
+  }
+
+
+  /**
+   * @brief JsonParser::parseSome
+   * Parses the tokens of [it_; end_) until the document or the chunk
+   * ends. The incomplete token at the end of the chunk is left unread.
+   * @return
+   */
+  JsonParser::Status
+  JsonParser::parseSome() throw(ParseError)
+  {
+    while (true)
+    {
+      skipWhitespace();
+
+      if (state_ == State::AfterValue && stack_.empty())
+      {
+        if (it_ != end_)
+        {
+          throw error("Unexpected characters after the document");
+        }
+
+        return (isFinal_ ? Status::Finished : Status::Incomplete);
+      }
+
+      if (it_ == end_)
+      {
+        if (isFinal_)
+        {
+          throw error("Unexpected end of the document");
+        }
+
+        return Status::Incomplete;
+      }
+
+      const char* const tokenFirst(it_);
+      const char c(*it_);
+      bool proceed(true);
+
+      try
+      {
+        switch (state_)
+        {
+          case State::Value:
+          case State::ValueOrEnd:
+            if (state_ == State::ValueOrEnd && c == ']')
+            {
+              ++it_;
+              stack_.pop_back();
+              proceed = handler_.endArray();
+              state_ = State::AfterValue;
+            }
+            else if (c == '{')
+            {
+              ++it_;
+              stack_.push_back('{');
+              proceed = handler_.startObject();
+              state_ = State::KeyOrEnd;
+            }
+            else if (c == '[')
+            {
+              ++it_;
+              stack_.push_back('[');
+              proceed = handler_.startArray();
+              state_ = State::ValueOrEnd;
+            }
+            else if (c == '"')
+            {
+              readString();
+              proceed = handler_.stringValue(buffer_);
+              state_ = State::AfterValue;
+            }
+            else if (c == '-' || std::isdigit(static_cast<unsigned char>(c)))
+            {
+              const char* numFirst(nullptr);
+              const char* numLast(nullptr);
+              readNumber(numFirst, numLast);
+              proceed = handler_.numberValue(numFirst, numLast);
+              state_ = State::AfterValue;
+            }
+            else if (readLiteral("true"))
+            {
+              proceed = handler_.booleanValue(true);
+              state_ = State::AfterValue;
+            }
+            else if (readLiteral("false"))
+            {
+              proceed = handler_.booleanValue(false);
+              state_ = State::AfterValue;
+            }
+            else if (readLiteral("null"))
+            {
+              proceed = handler_.nullValue();
+              state_ = State::AfterValue;
+            }
+            else
+            {
+              throw error("Value expected");
+            }
+            break;
+
+          case State::KeyOrEnd:
+          case State::Key:
+            if (state_ == State::KeyOrEnd && c == '}')
+            {
+              ++it_;
+              stack_.pop_back();
+              proceed = handler_.endObject();
+              state_ = State::AfterValue;
+            }
+            else if (c == '"')
+            {
+              readString();
+              proceed = handler_.key(buffer_);
+              state_ = State::Colon;
+            }
+            else
+            {
+              throw error("Object key expected");
+            }
+            break;
+
+          case State::Colon:
+            if (c != ':')
+            {
+              throw error("`:' expected");
+            }
+            ++it_;
+            state_ = State::Value;
+            break;
+
+          case State::AfterValue:
+            if (c == ',')
+            {
+              ++it_;
+              state_ = (stack_.back() == '{' ? State::Key : State::Value);
+            }
+            else if (c == '}' && stack_.back() == '{')
+            {
+              ++it_;
+              stack_.pop_back();
+              proceed = handler_.endObject();
+            }
+            else if (c == ']' && stack_.back() == '[')
+            {
+              ++it_;
+              stack_.pop_back();
+              proceed = handler_.endArray();
+            }
+            else
+            {
+              throw error(
+                stack_.back() == '{' ?
+                "`,' or `}' expected" : "`,' or `]' expected"
+              );
+            }
+            break;
+
+          default:
+            break;
+        }
+      }
+      catch (const NeedMoreInput&)
+      {
+        //NOTE: The handler hasn't seen the token yet
+        it_ = tokenFirst;
+
+        return Status::Incomplete;
+      }
+
+      if (!proceed)
+      {
+        return Status::Stopped;
+      }
+    }
+  }
+
+
+  bool
+  JsonParser::isAtChunkEnd() const
+  {
+    return (it_ == end_ && !isFinal_);
+  }
+
+
+  void
+  JsonParser::skipWhitespace()
+  {
+    while (it_ != end_)
+    {
+      if (*it_ == '\n')
+      {
+        ++lineNumber_;
+      }
+      else if (*it_ != ' ' && *it_ != '\t' && *it_ != '\r')
+      {
+        break;
+      }
+
+      ++it_;
+    }
+  }
+
+
+  /**
+   * @brief JsonParser::readString
+   * Reads the string literal into `buffer_', decoding the escapes.
+   */
+  void
+  JsonParser::readString() throw(ParseError, NeedMoreInput)
+  {
+    buffer_.clear();
+    ++it_;
+
+    while (true)
+    {
+      //Copy the unescaped run at once
+      const char* run(it_);
+      while (
+        it_ != end_ && *it_ != '"' && *it_ != '\\' &&
+        static_cast<unsigned char>(*it_) >= 0x20
+      )
+      {
+        ++it_;
+      }
+      buffer_.append(run, it_);
+
+      if (isAtChunkEnd())
+      {
+        throw NeedMoreInput();
+      }
+
+      if (it_ == end_)
+      {
+        throw error("Unterminated string");
+      }
+
+      if (*it_ == '"')
+      {
+        ++it_;
+
+        return;
+      }
+
+      if (*it_ != '\\')
+      {
+        throw error("Control character in string");
+      }
+
+      ++it_;
+      if (isAtChunkEnd())
+      {
+        throw NeedMoreInput();
+      }
+
+      if (it_ == end_)
+      {
+        throw error("Unterminated string");
+      }
+
+      switch (*it_++)
+      {
+        case '"':
+          buffer_ += '"';
+          break;
+
+        case '\\':
+          buffer_ += '\\';
+          break;
+
+        case '/':
+          buffer_ += '/';
+          break;
+
+        case 'b':
+          buffer_ += '\b';
+          break;
+
+        case 'f':
+          buffer_ += '\f';
+          break;
+
+        case 'n':
+          buffer_ += '\n';
+          break;
+
+        case 'r':
+          buffer_ += '\r';
+          break;
+
+        case 't':
+          buffer_ += '\t';
+          break;
+
+        case 'u':
+          readCodePoint();
+          break;
+
+        default:
+          throw error("Invalid escape sequence");
+      }
+    }
+  }
+
+
+  /**
+   * @brief JsonParser::readCodePoint
+   * Decodes the `\uXXXX' escape (and the surrogate pair it may start)
+   * and appends the code point to `buffer_' as UTF-8.
+   */
+  void
+  JsonParser::readCodePoint() throw(ParseError, NeedMoreInput)
+  {
+    unsigned codePoint(readHexQuad());
+
+    if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+    {
+      if (end_ - it_ < 2 && !isFinal_)
+      {
+        throw NeedMoreInput();
+      }
+
+      if (end_ - it_ < 2 || it_[0] != '\\' || it_[1] != 'u')
+      {
+        throw error("Unpaired surrogate");
+      }
+      it_ += 2;
+
+      const unsigned low(readHexQuad());
+      if (low < 0xDC00 || low > 0xDFFF)
+      {
+        throw error("Unpaired surrogate");
+      }
+
+      codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+    }
+
+    if (codePoint < 0x80)
+    {
+      buffer_ += char(codePoint);
+    }
+    else if (codePoint < 0x800)
+    {
+      buffer_ += char(0xC0 | (codePoint >> 6));
+      buffer_ += char(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000)
+    {
+      buffer_ += char(0xE0 | (codePoint >> 12));
+      buffer_ += char(0x80 | ((codePoint >> 6) & 0x3F));
+      buffer_ += char(0x80 | (codePoint & 0x3F));
+    }
+    else
+    {
+      buffer_ += char(0xF0 | (codePoint >> 18));
+      buffer_ += char(0x80 | ((codePoint >> 12) & 0x3F));
+      buffer_ += char(0x80 | ((codePoint >> 6) & 0x3F));
+      buffer_ += char(0x80 | (codePoint & 0x3F));
+    }
+  }
+
+
+  unsigned
+  JsonParser::readHexQuad() throw(ParseError, NeedMoreInput)
+  {
+    if (end_ - it_ < 4)
+    {
+      if (!isFinal_)
+      {
+        throw NeedMoreInput();
+      }
+
+      throw error("Invalid `\\u' escape");
+    }
+
+    unsigned value(0);
+    for (int k(0); k < 4; ++k, ++it_)
+    {
+      const char c(*it_);
+      value <<= 4;
+
+      if (c >= '0' && c <= '9')
+      {
+        value |= unsigned(c - '0');
+      }
+      else if (c >= 'a' && c <= 'f')
+      {
+        value |= unsigned(c - 'a' + 10);
+      }
+      else if (c >= 'A' && c <= 'F')
+      {
+        value |= unsigned(c - 'A' + 10);
+      }
+      else
+      {
+        throw error("Invalid `\\u' escape");
+      }
+    }
+
+    return value;
+  }
+
+
+  /**
+   * @brief JsonParser::readNumber
+   * Checks the number syntax and returns its characters range.
+   * The number that reaches the end of the chunk may go on
+   * in the next one, so it is read again w/ the next chunk.
+   * @param first
+   * @param last
+   */
+  void
+  JsonParser::readNumber(const char*& first, const char*& last)
+  throw(ParseError, NeedMoreInput)
+  {
+    const auto skipDigits([this]() -> bool
+    {
+      const char* const start(it_);
+      while (it_ != end_ && std::isdigit(static_cast<unsigned char>(*it_)))
+      {
+        ++it_;
+      }
+
+      if (isAtChunkEnd())
+      {
+        throw NeedMoreInput();
+      }
+
+      return (it_ != start);
+    });
+
+    first = it_;
+
+    if (*it_ == '-')
+    {
+      ++it_;
+    }
+
+    if (!skipDigits())
+    {
+      throw error("Invalid number");
+    }
+
+    if (it_ != end_ && *it_ == '.')
+    {
+      ++it_;
+      if (!skipDigits())
+      {
+        throw error("Invalid number");
+      }
+    }
+
+    if (it_ != end_ && (*it_ == 'e' || *it_ == 'E'))
+    {
+      ++it_;
+      if (it_ != end_ && (*it_ == '+' || *it_ == '-'))
+      {
+        ++it_;
+      }
+      if (!skipDigits())
+      {
+        throw error("Invalid number");
+      }
+    }
+
+    last = it_;
+  }
+
+
+  bool
+  JsonParser::readLiteral(const char* literal) throw(NeedMoreInput)
+  {
+    const size_t length(std::strlen(literal));
+
+    if (
+      size_t(end_ - it_) >= length &&
+      std::memcmp(it_, literal, length) == 0
+    )
+    {
+      it_ += length;
+
+      return true;
+    }
+
+    //The literal may be cut by the end of the chunk
+    if (
+      !isFinal_ && size_t(end_ - it_) < length &&
+      std::memcmp(it_, literal, size_t(end_ - it_)) == 0
+    )
+    {
+      throw NeedMoreInput();
+    }
+
+    return false;
+  }
+
+
+  ParseError
+  JsonParser::error(const string& what) const
+  {
+    return ParseError(what, lineNumber_);
+  }
+}
@@ -0,0 +1,121 @@
+﻿#pragma once
+
+#ifndef JSONPARSER_HXX
+#define JSONPARSER_HXX
+
+
+#include <cstddef>
+
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "ijsonhandler.hxx"
+#include "parseerror.hxx"
+
+
+namespace ProgramIO
+{
+  using std::istream;
+  using std::size_t;
+  using std::string;
+  using std::vector;
+
+
+  /**
+   * @brief The JsonParser class
+   * Event-based (SAX-style) JSON parser. The document is never
+   * materialized: values are passed to the handler as soon as they
+   * are read, numbers are passed as the unparsed characters ranges.
+   * Nesting is tracked w/ the explicit stack, not by recursion,
+   * so the stream can be fed to the parser by chunks.
+   */
+  class JsonParser
+  {
+    public:
+      explicit JsonParser(IJsonHandler& handler);
+
+      bool parse(const char* first, const char* last) throw(ParseError);
+
+      bool parse(istream& stream) throw(ParseError);
+
+
+    private:
+      enum struct State : int
+      {
+        Value = 0,
+        ValueOrEnd = 1,
+        KeyOrEnd = 2,
+        Key = 3,
+        Colon = 4,
+        AfterValue = 5
+      };
+
+
+      enum struct Status : int
+      {
+        Finished = 0,
+        Stopped = 1,
+        Incomplete = 2
+      };
+
+
+      /**
+       * @brief The NeedMoreInput struct
+       * Thrown when the token is cut by the end of the chunk.
+       */
+      struct NeedMoreInput { };
+
+
+      IJsonHandler& handler_;
+
+      const char* it_ = nullptr;
+
+      const char* end_ = nullptr;
+
+      /**
+       * @brief isFinal_
+       * `false' while more chunks of the document may follow.
+       */
+      bool isFinal_ = true;
+
+      State state_ = State::Value;
+
+      size_t lineNumber_ = 1;
+
+      /**
+       * @brief stack_
+       * Opening brackets of the containers being parsed.
+       */
+      vector<char> stack_;
+
+      string buffer_;
+
+
+      void reset();
+
+      void skipByteOrderMark();
+
+      Status parseSome() throw(ParseError);
+
+      bool isAtChunkEnd() const;
+
+      void skipWhitespace();
+
+      void readString() throw(ParseError, NeedMoreInput);
+
+      void readCodePoint() throw(ParseError, NeedMoreInput);
+
+      unsigned readHexQuad() throw(ParseError, NeedMoreInput);
+
+      void readNumber(const char*& first, const char*& last)
+      throw(ParseError, NeedMoreInput);
+
+      bool readLiteral(const char* literal) throw(NeedMoreInput);
+
+      ParseError error(const string& what) const;
+  };
+}
+
+
+#endif // JSONPARSER_HXX
@@ -0,0 +1,192 @@
+﻿#include "jsonreader.hxx"
+
+#include <istream>
+#include <string>
+
+#include "boost/optional.hpp"
+
+#include "ijsonhandler.hxx"
+#include "jsonparser.hxx"
+#include "parseerror.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using NumericTypes::Field;
+  using std::istream;
+  using std::string;
+
+
+  namespace Detail
+  {
+    /**
+     * @brief The FieldPeeker class
+     * Stops the parsing as soon as the top-level `field' (v2)
+     * or `metadata' (v1) value is met.
+     */
+    class FieldPeeker :
+      public IJsonHandler
+    {
+      public:
+        optional<Field> field;
+
+
+        virtual bool startObject() override
+        {
+          ++depth_;
+
+          return true;
+        }
+
+        virtual bool endObject() override
+        {
+          --depth_;
+
+          return true;
+        }
+
+        virtual bool startArray() override
+        {
+          ++depth_;
+
+          return true;
+        }
+
+        virtual bool endArray() override
+        {
+          --depth_;
+
+          return true;
+        }
+
+        virtual bool key(const string& name) override
+        {
+          if (depth_ == 1)
+          {
+            key_ = name;
+          }
+
+          return true;
+        }
+
+        virtual bool stringValue(const string& value) override
+        {
+          if (depth_ == 1 && key_ == "field")
+          {
+            field = parseFieldName(value);
+
+            return false;
+          }
+
+          if (depth_ == 1 && key_ == "metadata")
+          {
+            field = parseLegacyMetadata(value);
+
+            return false;
+          }
+
+          return true;
+        }
+
+        virtual bool numberValue(const char*, const char*) override
+        {
+          return true;
+        }
+
+        virtual bool booleanValue(bool) override
+        {
+          return true;
+        }
+
+        virtual bool nullValue() override
+        {
+          return true;
+        }
+
+
+      private:
+        int depth_ = 0;
+
+        string key_;
+    };
+
+
+    optional<Field>
+    parseFieldName(const string& name)
+    {
+      optional<Field> ret;
+
+      if (name == "real")
+      {
+        ret = Field::Real;
+      }
+      else if (name == "rational")
+      {
+        ret = Field::Rational;
+      }
+
+      return ret;
+    }
+
+
+    /**
+     * @brief parseLegacyMetadata
+     * Parses the `1;<field>' metadata string of the v1 documents.
+     * @param metadata
+     * @return
+     */
+    optional<Field>
+    parseLegacyMetadata(const string& metadata)
+    {
+      optional<Field> ret;
+
+      if (metadata == "1;1")
+      {
+        ret = Field::Real;
+      }
+      else if (metadata == "1;2")
+      {
+        ret = Field::Rational;
+      }
+
+      return ret;
+    }
+  }
+
+
+  /**
+   * @brief readJsonField
+   * Reads the declared field of the JSON program w/o reading the whole
+   * document (as long as the field is declared before the data).
+   * @param first
+   * @param last
+   * @return (optional) The field, `none' if it is not declared.
+   */
+  optional<Field>
+  readJsonField(const char* first, const char* last) throw(ParseError)
+  {
+    Detail::FieldPeeker peeker;
+    JsonParser(peeker).parse(first, last);
+
+    return peeker.field;
+  }
+
+
+  /**
+   * @brief readJsonField
+   * Reads the declared field of the JSON program from `stream'
+   * (see the overload above).
+   * @param stream
+   * @return
+   */
+  optional<Field>
+  readJsonField(istream& stream) throw(ParseError)
+  {
+    Detail::FieldPeeker peeker;
+    JsonParser(peeker).parse(stream);
+
+    return peeker.field;
+  }
+}
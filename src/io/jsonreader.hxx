@@ -0,0 +1,185 @@
+﻿#pragma once
+
+#ifndef JSONREADER_HXX
+#define JSONREADER_HXX
+
+
+#include <cstddef>
+
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "ijsonhandler.hxx"
+#include "importedprogram.hxx"
+#include "parseerror.hxx"
+#include "standardformbuilder.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using NumericTypes::Field;
+  using NumericTypes::real_t;
+  using std::istream;
+  using std::size_t;
+  using std::string;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The JsonReader class
+   * Reads the linear program from the JSON document w/o building
+   * the DOM: the values are put into the program as they are parsed.
+   * Reads both the current (v2) schema:
+   *   {
+   *     "format": "linear-program", "version": 2,
+   *     "field": "real" | "rational", "sense": "minimize" | "maximize",
+   *     "rows": M, "cols": N,
+   *     "objective": [c1, ..., cN], "rhs": [b1, ..., bM],
+   *     "senses": ["<=" | ">=" | "=", ...],
+   *     "constraints": [[a11, ..., a1N], ...],
+   *     "triplets": [[i, j, aij], ...]
+   *   }
+   * (all the keys but "objective" and "rhs" are optional, the values
+   * are numbers or the "p/q" strings, indices are 0-based; w/o "rows"
+   * and "cols" the size of the program is the length of "rhs" and
+   * "objective", the rows of "constraints" must all be of the same length)
+   * and the legacy (v1) `TableModelCollection' one.
+   */
+  class JsonReader :
+    private IJsonHandler
+  {
+    public:
+      JsonReader() = default;
+
+      ImportedProgram<T> read(const char* first, const char* last)
+      throw(ParseError);
+
+      ImportedProgram<T> read(istream& stream) throw(ParseError);
+
+      ImportedProgram<T> readFile(const string& fileName) throw(ParseError);
+
+
+    private:
+      enum struct Key : int
+      {
+        Unknown = 0,
+        Format = 1,
+        Version = 2,
+        Field = 3,
+        Sense = 4,
+        Rows = 5,
+        Cols = 6,
+        Objective = 7,
+        RHS = 8,
+        Senses = 9,
+        Constraints = 10,
+        Triplets = 11,
+        Metadata = 12,
+        Items = 13
+      };
+
+
+      StandardFormBuilder<T> builder_;
+
+      optional<DenseIndex> rowsCount_;
+
+      optional<DenseIndex> colsCount_;
+
+      DenseIndex objectiveCount_ = 0;
+
+      DenseIndex rhsCount_ = 0;
+
+      optional<DenseIndex> constraintsRowLength_;
+
+      Key key_ = Key::Unknown;
+
+      int depth_ = 0;
+
+      DenseIndex index_ = 0;
+
+      DenseIndex subIndex_ = 0;
+
+      int tripletPos_ = 0;
+
+      DenseIndex tripletRow_ = 0;
+
+      DenseIndex tripletCol_ = 0;
+
+      T tripletValue_ = T(0);
+
+      string itemKey_;
+
+      DenseIndex itemIdx_ = 0;
+
+      DenseIndex itemRows_ = 0;
+
+      DenseIndex itemCols_ = 0;
+
+      vector<T> itemValues_;
+
+
+      void reset();
+
+      ImportedProgram<T> build() const throw(ParseError);
+
+      virtual bool startObject() override;
+      virtual bool endObject() override;
+
+      virtual bool startArray() override;
+      virtual bool endArray() override;
+
+      virtual bool key(const string& name) override;
+
+      virtual bool stringValue(const string& value) override;
+      virtual bool numberValue(const char* first, const char* last) override;
+      virtual bool booleanValue(bool value) override;
+      virtual bool nullValue() override;
+
+      bool putValue(const char* first, const char* last, bool isString)
+      throw(ParseError);
+
+      void putScalar(const char* first, const char* last, bool isString)
+      throw(ParseError);
+
+      void putItem() throw(ParseError);
+
+      void ensureRows(DenseIndex count) throw(ParseError);
+
+      void ensureCols(DenseIndex count) throw(ParseError);
+
+      T number(const char* first, const char* last) const throw(ParseError);
+
+      DenseIndex index(const char* first, const char* last) const
+      throw(ParseError);
+
+      static Key parseKey(const string& name);
+  };
+
+
+  optional<Field> readJsonField(const char* first, const char* last)
+  throw(ParseError);
+
+  optional<Field> readJsonField(istream& stream) throw(ParseError);
+
+
+  namespace Detail
+  {
+    optional<Field> parseFieldName(const string& name);
+
+    optional<Field> parseLegacyMetadata(const string& metadata);
+  }
+}
+
+
+#include "jsonreader.txx"
+
+
+#endif // JSONREADER_HXX
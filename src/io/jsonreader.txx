@@ -0,0 +1,754 @@
+﻿#pragma once
+
+#ifndef JSONREADER_TXX
+#define JSONREADER_TXX
+
+
+#include "jsonreader.hxx"
+
+#include <cstddef>
+
+#include <algorithm>
+#include <istream>
+#include <stdexcept>
+#include <string>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+#include "fmt/format.h"
+
+#include "importedprogram.hxx"
+#include "jsonparser.hxx"
+#include "mappedfile.hxx"
+#include "numericformat.hxx"
+#include "parseerror.hxx"
+#include "../lp/optimizationgoaltype.hxx"
+#include "../lp/rowsense.hxx"
+#include "../config.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using fmt::format;
+  using LinearProgramming::OptimizationGoalType;
+  using LinearProgramming::RowSense;
+  using std::invalid_argument;
+  using std::istream;
+  using std::runtime_error;
+  using std::size_t;
+  using std::string;
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::read
+   * Reads the whole program from the characters range [first; last).
+   * @param first
+   * @param last
+   * @return
+   */
+  ImportedProgram<T>
+  JsonReader<T>::read(const char* first, const char* last) throw(ParseError)
+  {
+    reset();
+
+    JsonParser(*this).parse(first, last);
+
+    return build();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::read
+   * Reads the whole program from `stream' chunk by chunk.
+   * @param stream
+   * @return
+   */
+  ImportedProgram<T>
+  JsonReader<T>::read(istream& stream) throw(ParseError)
+  {
+    reset();
+
+    JsonParser(*this).parse(stream);
+
+    return build();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::readFile
+   * Maps the file into memory and reads it (see `read').
+   * @param fileName
+   * @return
+   */
+  ImportedProgram<T>
+  JsonReader<T>::readFile(const string& fileName) throw(ParseError)
+  {
+    try
+    {
+      const MappedFile file(fileName);
+
+      return read(file.begin(), file.end());
+    }
+    catch (const ParseError&)
+    {
+      throw;
+    }
+    catch (const runtime_error& re)
+    {
+      throw ParseError(re.what());
+    }
+  }
+
+
+  template<typename T>
+  void
+  JsonReader<T>::reset()
+  {
+    builder_ = StandardFormBuilder<T>();
+    rowsCount_ = optional<DenseIndex>();
+    colsCount_ = optional<DenseIndex>();
+    objectiveCount_ = 0;
+    rhsCount_ = 0;
+    constraintsRowLength_ = optional<DenseIndex>();
+    key_ = Key::Unknown;
+    depth_ = 0;
+    index_ = 0;
+    subIndex_ = 0;
+    tripletPos_ = 0;
+    itemKey_.clear();
+    itemIdx_ = 0;
+    itemRows_ = 0;
+    itemCols_ = 0;
+    itemValues_.clear();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::build
+   * Builds the program read. W/o the declared `rows' and `cols',
+   * the indices beyond `rhs' and `objective' are rejected here,
+   * as they could be followed by these keys.
+   * @return
+   */
+  ImportedProgram<T>
+  JsonReader<T>::build() const throw(ParseError)
+  {
+    if (builder_.columnsCount() == 0)
+    {
+      throw ParseError("The program has no variables");
+    }
+
+    if (!rowsCount_ && builder_.rowsCount() > rhsCount_)
+    {
+      throw ParseError(
+        format(
+          "Row index {} is out of range, `rhs' has {} values",
+          builder_.rowsCount() - 1, rhsCount_
+        )
+      );
+    }
+
+    if (!colsCount_ && builder_.columnsCount() > objectiveCount_)
+    {
+      throw ParseError(
+        format(
+          "Column index {} is out of range, `objective' has {} values",
+          builder_.columnsCount() - 1, objectiveCount_
+        )
+      );
+    }
+
+    try
+    {
+      return builder_.build();
+    }
+    catch (const invalid_argument& ia)
+    {
+      throw ParseError(ia.what());
+    }
+  }
+
+
+  template<typename T>
+  bool
+  JsonReader<T>::startObject()
+  {
+    ++depth_;
+
+    if (depth_ == 3 && key_ == Key::Items)
+    {
+      itemKey_.clear();
+      itemRows_ = 0;
+      itemCols_ = 0;
+      itemValues_.clear();
+    }
+    else if (depth_ > 1 && key_ != Key::Unknown && key_ != Key::Items)
+    {
+      throw ParseError("Unexpected object");
+    }
+
+    return true;
+  }
+
+
+  template<typename T>
+  bool
+  JsonReader<T>::endObject()
+  {
+    if (depth_ == 3 && key_ == Key::Items)
+    {
+      putItem();
+      ++itemIdx_;
+    }
+
+    --depth_;
+
+    return true;
+  }
+
+
+  template<typename T>
+  bool
+  JsonReader<T>::startArray()
+  {
+    ++depth_;
+
+    if (depth_ == 1)
+    {
+      throw ParseError("Object expected");
+    }
+
+    if (depth_ == 2)
+    {
+      index_ = 0;
+    }
+    else if (depth_ == 3)
+    {
+      subIndex_ = 0;
+      tripletPos_ = 0;
+    }
+
+    return true;
+  }
+
+
+  template<typename T>
+  bool
+  JsonReader<T>::endArray()
+  {
+    if (depth_ == 3 && key_ == Key::Constraints)
+    {
+      if (constraintsRowLength_ && subIndex_ != *constraintsRowLength_)
+      {
+        throw ParseError(
+          format(
+            "Row #{} of `constraints' has {} values, {} expected",
+            index_, subIndex_, *constraintsRowLength_
+          )
+        );
+      }
+      constraintsRowLength_ = subIndex_;
+
+      ++index_;
+    }
+    else if (depth_ == 3 && key_ == Key::Triplets)
+    {
+      if (tripletPos_ != 3)
+      {
+        throw ParseError("Triplet `[row, col, value]' expected");
+      }
+
+      ensureRows(tripletRow_ + 1);
+      ensureCols(tripletCol_ + 1);
+      if (tripletValue_ != T(0))
+      {
+        builder_.addCoeff(tripletRow_, tripletCol_, tripletValue_);
+      }
+
+      ++index_;
+    }
+
+    --depth_;
+
+    return true;
+  }
+
+
+  template<typename T>
+  bool
+  JsonReader<T>::key(const string& name)
+  {
+    if (depth_ == 1)
+    {
+      key_ = parseKey(name);
+    }
+    else if (depth_ == 3 && key_ == Key::Items)
+    {
+      itemKey_ = name;
+    }
+
+    return true;
+  }
+
+
+  template<typename T>
+  bool
+  JsonReader<T>::stringValue(const string& value)
+  {
+    return putValue(value.data(), value.data() + value.size(), true);
+  }
+
+
+  template<typename T>
+  bool
+  JsonReader<T>::numberValue(const char* first, const char* last)
+  {
+    return putValue(first, last, false);
+  }
+
+
+  template<typename T>
+  bool
+  JsonReader<T>::booleanValue(bool value)
+  {
+    (void) value;
+
+    if (key_ != Key::Unknown)
+    {
+      throw ParseError("Unexpected boolean value");
+    }
+
+    return true;
+  }
+
+
+  template<typename T>
+  bool
+  JsonReader<T>::nullValue()
+  {
+    if (key_ != Key::Unknown)
+    {
+      throw ParseError("Unexpected `null' value");
+    }
+
+    return true;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::putValue
+   * Puts the scalar value into the program according to the current
+   * key and position. Values of the unknown keys are skipped.
+   * @param first
+   * @param last
+   * @param isString
+   * @return
+   */
+  bool
+  JsonReader<T>::putValue(const char* first, const char* last, bool isString)
+  throw(ParseError)
+  {
+    switch (key_)
+    {
+      case Key::Unknown:
+        break;
+
+      case Key::Objective:
+        if (depth_ != 2)
+        {
+          throw ParseError("Array of numbers expected for `objective'");
+        }
+        ensureCols(index_ + 1);
+        builder_.addObjectiveCoeff(index_, number(first, last));
+        ++index_;
+        objectiveCount_ = std::max(objectiveCount_, index_);
+        break;
+
+      case Key::RHS:
+        if (depth_ != 2)
+        {
+          throw ParseError("Array of numbers expected for `rhs'");
+        }
+        ensureRows(index_ + 1);
+        builder_.setRHS(index_, number(first, last));
+        ++index_;
+        rhsCount_ = std::max(rhsCount_, index_);
+        break;
+
+      case Key::Senses:
+      {
+        if (depth_ != 2 || !isString)
+        {
+          throw ParseError("Array of strings expected for `senses'");
+        }
+
+        const string sense(first, last);
+        ensureRows(index_ + 1);
+        if (sense == "<=" || sense == "L")
+        {
+          builder_.setSense(index_, RowSense::LessThanOrEqual);
+        }
+        else if (sense == ">=" || sense == "G")
+        {
+          builder_.setSense(index_, RowSense::GreaterThanOrEqual);
+        }
+        else if (sense == "=" || sense == "E")
+        {
+          builder_.setSense(index_, RowSense::Equal);
+        }
+        else
+        {
+          throw ParseError(format("Unknown constraint sense `{}'", sense));
+        }
+        ++index_;
+        break;
+      }
+
+      case Key::Constraints:
+      {
+        if (depth_ != 3)
+        {
+          throw ParseError("Array of rows expected for `constraints'");
+        }
+
+        const T value(number(first, last));
+        ensureRows(index_ + 1);
+        ensureCols(subIndex_ + 1);
+        if (value != T(0))
+        {
+          builder_.addCoeff(index_, subIndex_, value);
+        }
+        ++subIndex_;
+        break;
+      }
+
+      case Key::Triplets:
+        if (depth_ != 3)
+        {
+          throw ParseError("Array of triplets expected for `triplets'");
+        }
+
+        switch (tripletPos_++)
+        {
+          case 0:
+            tripletRow_ = index(first, last);
+            break;
+
+          case 1:
+            tripletCol_ = index(first, last);
+            break;
+
+          case 2:
+            tripletValue_ = number(first, last);
+            break;
+
+          default:
+            throw ParseError("Triplet `[row, col, value]' expected");
+        }
+        break;
+
+      case Key::Items:
+        if (depth_ == 3 && itemKey_ == "rows")
+        {
+          itemRows_ = index(first, last);
+        }
+        else if (depth_ == 3 && itemKey_ == "cols")
+        {
+          itemCols_ = index(first, last);
+        }
+        else if (depth_ == 4 && itemKey_ == "values")
+        {
+          itemValues_.push_back(number(first, last));
+        }
+        break;
+
+      default:
+        if (depth_ != 1)
+        {
+          throw ParseError("Scalar value expected");
+        }
+        putScalar(first, last, isString);
+        break;
+    }
+
+    return true;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::putScalar
+   * Handles the scalar top-level keys.
+   * @param first
+   * @param last
+   * @param isString
+   */
+  void
+  JsonReader<T>::putScalar(const char* first, const char* last, bool isString)
+  throw(ParseError)
+  {
+    const string value(first, last);
+
+    switch (key_)
+    {
+      case Key::Format:
+        if (!isString || value != "linear-program")
+        {
+          throw ParseError(format("Unknown document format `{}'", value));
+        }
+        break;
+
+      case Key::Version:
+      {
+        const DenseIndex version(index(first, last));
+        if (version < 1 || version > Config::ProgramIO::JsonFormatVersion)
+        {
+          throw ParseError(format("Unsupported format version {}", version));
+        }
+        break;
+      }
+
+      case Key::Field:
+        if (!isString || !Detail::parseFieldName(value))
+        {
+          throw ParseError(format("Unknown field `{}'", value));
+        }
+        break;
+
+      case Key::Sense:
+        if (value == "minimize" || value == "min")
+        {
+          builder_.setGoalType(OptimizationGoalType::Minimize);
+        }
+        else if (value == "maximize" || value == "max")
+        {
+          builder_.setGoalType(OptimizationGoalType::Maximize);
+        }
+        else
+        {
+          throw ParseError(format("Unknown optimization sense `{}'", value));
+        }
+        break;
+
+      case Key::Rows:
+        ensureRows(index(first, last));
+        rowsCount_ = builder_.rowsCount();
+        break;
+
+      case Key::Cols:
+        ensureCols(index(first, last));
+        colsCount_ = builder_.columnsCount();
+        break;
+
+      case Key::Metadata:
+        if (!isString || !Detail::parseLegacyMetadata(value))
+        {
+          throw ParseError(format("Unsupported metadata `{}'", value));
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::putItem
+   * Puts the legacy (v1) table into the program: item #0 is the
+   * objective function row, #1 is the constraints matrix and #2 is
+   * the RHS column, their values are stored row by row.
+   */
+  void
+  JsonReader<T>::putItem() throw(ParseError)
+  {
+    if (DenseIndex(itemValues_.size()) != itemRows_ * itemCols_)
+    {
+      throw ParseError(
+        format(
+          "Item #{}: {} values expected, got {}",
+          itemIdx_, itemRows_ * itemCols_, itemValues_.size()
+        )
+      );
+    }
+
+    switch (itemIdx_)
+    {
+      case 0:
+        ensureCols(itemCols_);
+        for (DenseIndex j(0); j < itemCols_; ++j)
+        {
+          builder_.addObjectiveCoeff(j, itemValues_[j]);
+        }
+        objectiveCount_ = std::max(objectiveCount_, itemCols_);
+        break;
+
+      case 1:
+        ensureRows(itemRows_);
+        ensureCols(itemCols_);
+        for (DenseIndex i(0); i < itemRows_; ++i)
+        {
+          for (DenseIndex j(0); j < itemCols_; ++j)
+          {
+            const T& value(itemValues_[i * itemCols_ + j]);
+            if (value != T(0))
+            {
+              builder_.addCoeff(i, j, value);
+            }
+          }
+        }
+        break;
+
+      case 2:
+        ensureRows(itemRows_);
+        for (DenseIndex i(0); i < itemRows_; ++i)
+        {
+          builder_.setRHS(i, itemValues_[i]);
+        }
+        rhsCount_ = std::max(rhsCount_, itemRows_);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::ensureRows
+   * Appends the equality constraints until there are at least `count'
+   * of them. The count declared by `rows' cannot be exceeded.
+   * @param count
+   */
+  void
+  JsonReader<T>::ensureRows(DenseIndex count) throw(ParseError)
+  {
+    if (rowsCount_ && count > *rowsCount_)
+    {
+      throw ParseError(format("Row index {} is out of range", count - 1));
+    }
+
+    while (builder_.rowsCount() < count)
+    {
+      builder_.addRow(
+        format("R{}", builder_.rowsCount() + 1), RowSense::Equal
+      );
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::ensureCols
+   * Appends the variables until there are at least `count' of them.
+   * The count declared by `cols' cannot be exceeded.
+   * @param count
+   */
+  void
+  JsonReader<T>::ensureCols(DenseIndex count) throw(ParseError)
+  {
+    if (colsCount_ && count > *colsCount_)
+    {
+      throw ParseError(format("Column index {} is out of range", count - 1));
+    }
+
+    while (builder_.columnsCount() < count)
+    {
+      builder_.addColumn(format("X{}", builder_.columnsCount() + 1));
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::number
+   * Parses the number or the numeric string (the empty one is zero).
+   * @param first
+   * @param last
+   * @return
+   */
+  T
+  JsonReader<T>::number(const char* first, const char* last) const
+  throw(ParseError)
+  {
+    T value(0);
+
+    if (first != last && !parseNumber<T>(first, last, value))
+    {
+      throw ParseError(
+        format("Invalid numeric value `{}'", string(first, last))
+      );
+    }
+
+    return value;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonReader<T>::index
+   * Parses the non-negative integer (row/column index or count).
+   * @param first
+   * @param last
+   * @return
+   */
+  DenseIndex
+  JsonReader<T>::index(const char* first, const char* last) const
+  throw(ParseError)
+  {
+    DenseIndex value(0);
+    bool isValid(first != last);
+
+    for (const char* it(first); isValid && it != last; ++it)
+    {
+      isValid = (
+        *it >= '0' && *it <= '9' &&
+        value <= (DenseIndex(1) << 40) //NOTE: Sanity limit
+      );
+      value = value * DenseIndex(10) + DenseIndex(*it - '0');
+    }
+
+    if (!isValid)
+    {
+      throw ParseError(
+        format("Invalid index or count `{}'", string(first, last))
+      );
+    }
+
+    return value;
+  }
+
+
+  template<typename T>
+  typename JsonReader<T>::Key
+  JsonReader<T>::parseKey(const string& name)
+  {
+    if (name == "format")      { return Key::Format; }
+    if (name == "version")     { return Key::Version; }
+    if (name == "field")       { return Key::Field; }
+    if (name == "sense")       { return Key::Sense; }
+    if (name == "rows")        { return Key::Rows; }
+    if (name == "cols")        { return Key::Cols; }
+    if (name == "objective")   { return Key::Objective; }
+    if (name == "rhs")         { return Key::RHS; }
+    if (name == "senses")      { return Key::Senses; }
+    if (name == "constraints") { return Key::Constraints; }
+    if (name == "triplets")    { return Key::Triplets; }
+    if (name == "metadata")    { return Key::Metadata; }
+    if (name == "items")       { return Key::Items; }
+
+    return Key::Unknown;
+  }
+}
+
+
+#endif // JSONREADER_TXX
@@ -0,0 +1,93 @@
+﻿#pragma once
+
+#ifndef JSONWRITER_HXX
+#define JSONWRITER_HXX
+
+
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include "../lp/linearprogramdata.hxx"
+#include "../math/numerictypes.hxx"
+#include "../misc/utils.hxx"
+
+
+namespace ProgramIO
+{
+  using LinearProgramming::LinearProgramData;
+  using NumericTypes::real_t;
+  using std::ostream;
+  using std::runtime_error;
+  using std::string;
+  using Utils::AlwaysFalse;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The JsonWriter class
+   * Writes the program in the v2 JSON schema (see `JsonReader').
+   * The constraints matrix is written as the `triplets' list
+   * if it is sparse enough, and row by row otherwise.
+   */
+  class JsonWriter
+  {
+    public:
+      JsonWriter() = default;
+
+      void write(
+        ostream& stream, const LinearProgramData<T>& linearProgramData
+      ) const throw(runtime_error);
+  };
+
+
+  namespace Detail
+  {
+    template<typename T = real_t>
+    /**
+     * @brief jsonFieldName
+     * @return Name of the field `T' for the `field' key.
+     */
+    const char*
+    jsonFieldName()
+    {
+      static_assert(
+        AlwaysFalse<T>::value,
+        "ProgramIO::Detail::jsonFieldName<T>: "
+        "You can only use one of the specified template specializations!"
+      );
+
+      return nullptr;
+    }
+
+
+    template<typename T = real_t>
+    /**
+     * @brief jsonValue
+     * Formats `value' as the JSON value `JsonReader<T>' gives back
+     * exactly.
+     * @param value
+     * @return
+     */
+    string
+    jsonValue(const T& value) throw(runtime_error)
+    {
+      static_assert(
+        AlwaysFalse<T>::value,
+        "ProgramIO::Detail::jsonValue<T>: "
+        "You can only use one of the specified template specializations!"
+      );
+
+      return string();
+    }
+
+
+    inline string jsonString(const string& value);
+  }
+}
+
+
+#include "jsonwriter.txx"
+
+
+#endif // JSONWRITER_HXX
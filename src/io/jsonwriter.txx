@@ -0,0 +1,248 @@
+﻿#pragma once
+
+#ifndef JSONWRITER_TXX
+#define JSONWRITER_TXX
+
+
+#include "jsonwriter.hxx"
+
+#include <cmath>
+
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include "eigen3/Eigen/Core"
+#include "fmt/format.h"
+
+#include "numericformat.hxx"
+#include "../config.hxx"
+#include "../lp/linearprogramdata.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using Eigen::DenseIndex;
+  using fmt::format;
+  using LinearProgramming::LinearProgramData;
+  using NumericTypes::integer_t;
+  using NumericTypes::rational_t;
+  using NumericTypes::real_t;
+  using std::ostream;
+  using std::runtime_error;
+  using std::string;
+
+
+  namespace Detail
+  {
+#ifndef LP_WITH_MULTIPRECISION
+    template<>
+    inline const char*
+    jsonFieldName<real_t>()
+    {
+      return "real";
+    }
+
+
+    template<>
+    inline const char*
+    jsonFieldName<rational_t>()
+    {
+      return "rational";
+    }
+
+
+    template<>
+    inline string
+    jsonValue<real_t>(const real_t& value) throw(runtime_error)
+    {
+      if (!std::isfinite(value))
+      {
+        throw runtime_error(
+          "Infinite and NaN values cannot be written in JSON"
+        );
+      }
+
+      return formatNumber<real_t>(value);
+    }
+
+
+    template<>
+    inline string
+    jsonValue<rational_t>(const rational_t& value) throw(runtime_error)
+    {
+      //NOTE: Fractions are not JSON numbers, so they are quoted
+      if (value.denominator() == integer_t(1))
+      {
+        return formatNumber<rational_t>(value);
+      }
+      else
+      {
+        return format("\"{}\"", formatNumber<rational_t>(value));
+      }
+    }
+#endif // LP_WITH_MULTIPRECISION
+
+
+    /**
+     * @brief jsonString
+     * Quotes and escapes `value' as the JSON string.
+     * @param value
+     * @return
+     */
+    inline string
+    jsonString(const string& value)
+    {
+      string ret("\"");
+      ret.reserve(value.size() + 2);
+
+      for (const char c : value)
+      {
+        switch (c)
+        {
+          case '"':
+            ret += "\\\"";
+            break;
+
+          case '\\':
+            ret += "\\\\";
+            break;
+
+          case '\n':
+            ret += "\\n";
+            break;
+
+          case '\r':
+            ret += "\\r";
+            break;
+
+          case '\t':
+            ret += "\\t";
+            break;
+
+          default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+              ret += format("\\u{:04x}", int(c));
+            }
+            else
+            {
+              ret += c;
+            }
+        }
+      }
+
+      return ret += '"';
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief JsonWriter<T>::write
+   * Writes `linearProgramData' (the minimization program w/ equality
+   * constraints) to `stream'.
+   * @param stream
+   * @param linearProgramData
+   */
+  void
+  JsonWriter<T>::write(
+    ostream& stream, const LinearProgramData<T>& linearProgramData
+  ) const throw(runtime_error)
+  {
+    const auto& objective(linearProgramData.objectiveFunctionCoeffs);
+    const auto& constraints(linearProgramData.constraintsCoeffs);
+    const auto& rhs(linearProgramData.constraintsRHS);
+
+    const DenseIndex rows(constraints.rows());
+    const DenseIndex cols(constraints.cols());
+
+    DenseIndex nonZeros(0);
+    for (DenseIndex j(0); j < cols; ++j)
+    {
+      for (DenseIndex i(0); i < rows; ++i)
+      {
+        if (constraints(i, j) != T(0))
+        {
+          ++nonZeros;
+        }
+      }
+    }
+
+    //NOTE: The triplet takes about three times the space of the value
+    const bool isSparse(nonZeros * 3 < rows * cols);
+
+    stream << "{\n"
+           << "  \"format\": \"linear-program\",\n"
+           << "  \"version\": " << Config::ProgramIO::JsonFormatVersion
+           << ",\n"
+           << "  \"field\": \"" << Detail::jsonFieldName<T>() << "\",\n"
+           << "  \"sense\": \"minimize\",\n"
+           << "  \"rows\": " << rows << ",\n"
+           << "  \"cols\": " << cols << ",\n";
+
+    stream << "  \"objective\": [";
+    for (DenseIndex j(0); j < cols; ++j)
+    {
+      stream << (j > 0 ? ", " : "") << Detail::jsonValue<T>(objective(j));
+    }
+    stream << "],\n";
+
+    stream << "  \"rhs\": [";
+    for (DenseIndex i(0); i < rows; ++i)
+    {
+      stream << (i > 0 ? ", " : "") << Detail::jsonValue<T>(rhs(i));
+    }
+    stream << "],\n";
+
+    if (isSparse)
+    {
+      stream << "  \"triplets\": [";
+
+      bool isFirst(true);
+      for (DenseIndex i(0); i < rows; ++i)
+      {
+        for (DenseIndex j(0); j < cols; ++j)
+        {
+          if (constraints(i, j) != T(0))
+          {
+            stream << (isFirst ? "\n" : ",\n")
+                   << "    [" << i << ", " << j << ", "
+                   << Detail::jsonValue<T>(constraints(i, j)) << "]";
+            isFirst = false;
+          }
+        }
+      }
+
+      stream << (isFirst ? "]\n" : "\n  ]\n");
+    }
+    else
+    {
+      stream << "  \"constraints\": [";
+
+      for (DenseIndex i(0); i < rows; ++i)
+      {
+        stream << (i > 0 ? ",\n" : "\n") << "    [";
+        for (DenseIndex j(0); j < cols; ++j)
+        {
+          stream << (j > 0 ? ", " : "")
+                 << Detail::jsonValue<T>(constraints(i, j));
+        }
+        stream << "]";
+      }
+
+      stream << (rows > 0 ? "\n  ]\n" : "]\n");
+    }
+
+    stream << "}\n";
+
+    if (!stream)
+    {
+      throw runtime_error("Couldn't write the program");
+    }
+  }
+}
+
+
+#endif // JSONWRITER_TXX
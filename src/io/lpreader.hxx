@@ -0,0 +1,153 @@
+﻿#pragma once
+
+#ifndef LPREADER_HXX
+#define LPREADER_HXX
+
+
+#include <cstddef>
+
+#include <string>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "importedprogram.hxx"
+#include "parseerror.hxx"
+#include "standardformbuilder.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using NumericTypes::real_t;
+  using std::size_t;
+  using std::string;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The LpReader class
+   * Reads the linear program in the CPLEX LP format. The input is
+   * tokenized in a single pass w/o copying, variable names are interned
+   * into the column indices as they are met.
+   * Supported sections: objective (`minimize'/`maximize'), `subject to',
+   * `bounds', `general' (ignored, the LP relaxation is read), `binary'
+   * (read as [0; 1] bounds) and `end'.
+   */
+  class LpReader
+  {
+    public:
+      LpReader() = default;
+
+      ImportedProgram<T> read(const char* first, const char* last)
+      throw(ParseError);
+
+      ImportedProgram<T> readFile(const string& fileName) throw(ParseError);
+
+
+    private:
+      enum struct TokenType : int
+      {
+        End = 0,
+        Identifier = 1,
+        Number = 2,
+        Plus = 3,
+        Minus = 4,
+        LessThanOrEqual = 5,
+        GreaterThanOrEqual = 6,
+        Equal = 7,
+        Colon = 8,
+        Other = 9
+      };
+
+
+      enum struct Section : int
+      {
+        None = 0,
+        Minimize = 1,
+        Maximize = 2,
+        Constraints = 3,
+        Bounds = 4,
+        Generals = 5,
+        Binaries = 6,
+        End = 7
+      };
+
+
+      struct Token
+      {
+        TokenType type;
+        const char* first;
+        const char* last;
+        size_t line;
+        bool isAtLineStart;
+      };
+
+
+      StandardFormBuilder<T> builder_;
+
+      const char* it_ = nullptr;
+
+      const char* end_ = nullptr;
+
+      size_t lineNumber_ = 1;
+
+      Token current_;
+
+      Token next_;
+
+      string name_;
+
+
+      void reset(const char* first, const char* last);
+
+      void advance();
+
+      Token lex();
+
+      void skipWhitespace(bool& isAtLineStart);
+
+      Section section();
+
+      void readObjective();
+
+      void readConstraints();
+
+      void readBounds();
+
+      void readBinaries();
+
+      void skipIdentifiers();
+
+      T readExpression(DenseIndex rowIdx);
+
+      T readNumber() throw(ParseError);
+
+      optional<T> readBoundValue(bool& isNegative) throw(ParseError);
+
+      void setBound(
+        DenseIndex colIdx, TokenType sense, bool isValueOnLeft,
+        const optional<T>& value, bool isNegative
+      );
+
+      DenseIndex column(const Token& token);
+
+      bool isSense(const Token& token) const;
+
+      bool isInfinity(const Token& token) const;
+
+      bool isLabel() const;
+
+      bool equals(const Token& token, const char* keyword) const;
+
+      ParseError error(const string& what) const;
+  };
+}
+
+
+#include "lpreader.txx"
+
+
+#endif // LPREADER_HXX
@@ -0,0 +1,944 @@
+﻿#pragma once
+
+#ifndef LPREADER_TXX
+#define LPREADER_TXX
+
+
+#include "lpreader.hxx"
+
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+
+#include <stdexcept>
+#include <string>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+#include "fmt/format.h"
+
+#include "importedprogram.hxx"
+#include "mappedfile.hxx"
+#include "numericformat.hxx"
+#include "parseerror.hxx"
+#include "../lp/optimizationgoaltype.hxx"
+#include "../lp/rowsense.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using fmt::format;
+  using LinearProgramming::OptimizationGoalType;
+  using LinearProgramming::RowSense;
+  using std::invalid_argument;
+  using std::runtime_error;
+  using std::size_t;
+  using std::string;
+
+
+  namespace Detail
+  {
+    inline bool
+    isNameChar(char c)
+    {
+      return (
+        std::isalnum(static_cast<unsigned char>(c)) ||
+        (c != '\0' && std::strchr("!\"#$%&()/,.;?@_`'{}|~", c) != nullptr)
+      );
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::read
+   * Reads the whole program from the characters range [first; last).
+   * @param first
+   * @param last
+   * @return
+   */
+  ImportedProgram<T>
+  LpReader<T>::read(const char* first, const char* last) throw(ParseError)
+  {
+    reset(first, last);
+
+    bool haveObjective(false);
+
+    while (current_.type != TokenType::End)
+    {
+      const Section sect(section());
+      if (sect == Section::None)
+      {
+        throw error("Section keyword expected");
+      }
+
+      //`subject to' and `such that' are two tokens long
+      const bool isTwoWords(
+        equals(current_, "subject") || equals(current_, "such")
+      );
+      advance();
+      if (isTwoWords)
+      {
+        advance();
+      }
+
+      switch (sect)
+      {
+        case Section::Minimize:
+        case Section::Maximize:
+          if (haveObjective)
+          {
+            throw error("Only one objective function is allowed");
+          }
+          haveObjective = true;
+
+          builder_.setGoalType(
+            sect == Section::Maximize ?
+            OptimizationGoalType::Maximize : OptimizationGoalType::Minimize
+          );
+          readObjective();
+          break;
+
+        case Section::Constraints:
+          readConstraints();
+          break;
+
+        case Section::Bounds:
+          readBounds();
+          break;
+
+        case Section::Generals:
+          skipIdentifiers();
+          break;
+
+        case Section::Binaries:
+          readBinaries();
+          break;
+
+        case Section::End:
+          if (current_.type != TokenType::End)
+          {
+            throw error("Unexpected input after `end'");
+          }
+          break;
+
+        default:
+          break;
+      }
+    }
+
+    if (!haveObjective)
+    {
+      throw error("No objective function section found");
+    }
+
+    try
+    {
+      return builder_.build();
+    }
+    catch (const invalid_argument& ia)
+    {
+      throw ParseError(ia.what());
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::readFile
+   * Maps the file into memory and reads it (see `read').
+   * @param fileName
+   * @return
+   */
+  ImportedProgram<T>
+  LpReader<T>::readFile(const string& fileName) throw(ParseError)
+  {
+    try
+    {
+      const MappedFile file(fileName);
+
+      return read(file.begin(), file.end());
+    }
+    catch (const ParseError&)
+    {
+      throw;
+    }
+    catch (const runtime_error& re)
+    {
+      throw ParseError(re.what());
+    }
+  }
+
+
+  template<typename T>
+  void
+  LpReader<T>::reset(const char* first, const char* last)
+  {
+    builder_ = StandardFormBuilder<T>();
+    it_ = first;
+    end_ = last;
+    lineNumber_ = 1;
+
+    next_ = lex();
+    next_.isAtLineStart = true;
+    advance();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::advance
+   * Moves to the next token, keeping one token of lookahead.
+   */
+  void
+  LpReader<T>::advance()
+  {
+    current_ = next_;
+    next_ = lex();
+  }
+
+
+  template<typename T>
+  typename LpReader<T>::Token
+  LpReader<T>::lex()
+  {
+    bool isAtLineStart(false);
+    skipWhitespace(isAtLineStart);
+
+    Token token{TokenType::End, it_, it_, lineNumber_, isAtLineStart};
+
+    if (it_ == end_)
+    {
+      return token;
+    }
+
+    const char c(*it_);
+
+    if (std::isdigit(static_cast<unsigned char>(c)) || c == '.')
+    {
+      while (
+        it_ != end_ &&
+        (std::isdigit(static_cast<unsigned char>(*it_)) || *it_ == '.')
+      )
+      {
+        ++it_;
+      }
+
+      //Consume the exponent only if it is well-formed
+      if (it_ != end_ && (*it_ == 'e' || *it_ == 'E'))
+      {
+        const char* exp(it_ + 1);
+        if (exp != end_ && (*exp == '+' || *exp == '-'))
+        {
+          ++exp;
+        }
+
+        if (exp != end_ && std::isdigit(static_cast<unsigned char>(*exp)))
+        {
+          it_ = exp;
+          while (it_ != end_ && std::isdigit(static_cast<unsigned char>(*it_)))
+          {
+            ++it_;
+          }
+        }
+      }
+
+      token.type = TokenType::Number;
+    }
+    else if (Detail::isNameChar(c))
+    {
+      while (it_ != end_ && Detail::isNameChar(*it_))
+      {
+        ++it_;
+      }
+
+      token.type = TokenType::Identifier;
+    }
+    else
+    {
+      ++it_;
+      const bool isFollowedByEqual(it_ != end_ && *it_ == '=');
+
+      switch (c)
+      {
+        case '+':
+          token.type = TokenType::Plus;
+          break;
+
+        case '-':
+          token.type = TokenType::Minus;
+          break;
+
+        case ':':
+          token.type = TokenType::Colon;
+          break;
+
+        case '<':
+          token.type = TokenType::LessThanOrEqual;
+          it_ += (isFollowedByEqual ? 1 : 0);
+          break;
+
+        case '>':
+          token.type = TokenType::GreaterThanOrEqual;
+          it_ += (isFollowedByEqual ? 1 : 0);
+          break;
+
+        case '=':
+          if (it_ != end_ && *it_ == '<')
+          {
+            token.type = TokenType::LessThanOrEqual;
+            ++it_;
+          }
+          else if (it_ != end_ && *it_ == '>')
+          {
+            token.type = TokenType::GreaterThanOrEqual;
+            ++it_;
+          }
+          else
+          {
+            token.type = TokenType::Equal;
+          }
+          break;
+
+        default:
+          token.type = TokenType::Other;
+          break;
+      }
+    }
+
+    token.last = it_;
+
+    return token;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::skipWhitespace
+   * Skips whitespace and `\' comments, counting the lines.
+   * @param isAtLineStart Set to `true' if a line break was skipped.
+   */
+  void
+  LpReader<T>::skipWhitespace(bool& isAtLineStart)
+  {
+    while (it_ != end_)
+    {
+      if (*it_ == '\n')
+      {
+        ++lineNumber_;
+        isAtLineStart = true;
+        ++it_;
+      }
+      else if (std::isspace(static_cast<unsigned char>(*it_)))
+      {
+        ++it_;
+      }
+      else if (*it_ == '\\')
+      {
+        while (it_ != end_ && *it_ != '\n')
+        {
+          ++it_;
+        }
+      }
+      else
+      {
+        break;
+      }
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::section
+   * @return Section started by the current token, `Section::None'
+   * if it is not a section keyword. Keywords are case-insensitive and
+   * have to start a line.
+   */
+  typename LpReader<T>::Section
+  LpReader<T>::section()
+  {
+    if (current_.type == TokenType::End)
+    {
+      return Section::End;
+    }
+
+    if (current_.type != TokenType::Identifier || !current_.isAtLineStart)
+    {
+      return Section::None;
+    }
+
+    if (
+      equals(current_, "minimize") || equals(current_, "minimise") ||
+      equals(current_, "minimum") || equals(current_, "min")
+    )
+    {
+      return Section::Minimize;
+    }
+
+    if (
+      equals(current_, "maximize") || equals(current_, "maximise") ||
+      equals(current_, "maximum") || equals(current_, "max")
+    )
+    {
+      return Section::Maximize;
+    }
+
+    if (
+      (equals(current_, "subject") && equals(next_, "to")) ||
+      (equals(current_, "such") && equals(next_, "that")) ||
+      equals(current_, "st") || equals(current_, "s.t.") ||
+      equals(current_, "st.")
+    )
+    {
+      return Section::Constraints;
+    }
+
+    if (equals(current_, "bounds") || equals(current_, "bound"))
+    {
+      return Section::Bounds;
+    }
+
+    if (
+      equals(current_, "general") || equals(current_, "generals") ||
+      equals(current_, "gen") || equals(current_, "integer") ||
+      equals(current_, "integers")
+    )
+    {
+      return Section::Generals;
+    }
+
+    if (
+      equals(current_, "binary") || equals(current_, "binaries") ||
+      equals(current_, "bin")
+    )
+    {
+      return Section::Binaries;
+    }
+
+    if (equals(current_, "end"))
+    {
+      return Section::End;
+    }
+
+    if (
+      equals(current_, "semi") || equals(current_, "semis") ||
+      equals(current_, "sos")
+    )
+    {
+      throw error(
+        "Unsupported section `" +
+        string(current_.first, current_.last) + "'"
+      );
+    }
+
+    return Section::None;
+  }
+
+
+  template<typename T>
+  void
+  LpReader<T>::readObjective()
+  {
+    //The objective function name is not used
+    if (isLabel())
+    {
+      advance();
+      advance();
+    }
+
+    const T constant(readExpression(-1));
+    builder_.setObjectiveOffset(constant);
+
+    if (section() == Section::None)
+    {
+      throw error("Unexpected token in the objective function");
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::readConstraints
+   * Reads the `[name:] expression sense [sign] number' constraints.
+   * Constant terms of the expression are moved to the right-hand side.
+   */
+  void
+  LpReader<T>::readConstraints()
+  {
+    while (section() == Section::None)
+    {
+      if (isLabel())
+      {
+        name_.assign(current_.first, current_.last);
+        if (builder_.rowIndex(name_))
+        {
+          throw error("Duplicate constraint name `" + name_ + "'");
+        }
+
+        advance();
+        advance();
+      }
+      else
+      {
+        name_ = format("c{}", builder_.rowsCount() + 1);
+      }
+
+      const DenseIndex rowIdx(builder_.addRow(name_, RowSense::Equal));
+      const T constant(readExpression(rowIdx));
+
+      switch (current_.type)
+      {
+        case TokenType::LessThanOrEqual:
+          builder_.setSense(rowIdx, RowSense::LessThanOrEqual);
+          break;
+
+        case TokenType::GreaterThanOrEqual:
+          builder_.setSense(rowIdx, RowSense::GreaterThanOrEqual);
+          break;
+
+        case TokenType::Equal:
+          builder_.setSense(rowIdx, RowSense::Equal);
+          break;
+
+        default:
+          throw error("Constraint sense (`<=', `>=' or `=') expected");
+      }
+      advance();
+
+      builder_.setRHS(rowIdx, readNumber() - constant);
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::readBounds
+   * Reads the `x <op> value', `value <op> x [<op> value]' and `x free'
+   * bounds, where the value may be infinite. Negative upper bound w/o
+   * the lower one makes the variable unbounded below, as in `MpsReader'.
+   */
+  void
+  LpReader<T>::readBounds()
+  {
+    while (section() == Section::None)
+    {
+      if (
+        current_.type == TokenType::Identifier &&
+        !(isInfinity(current_) && isSense(next_))
+      )
+      {
+        const DenseIndex colIdx(column(current_));
+        advance();
+
+        if (equals(current_, "free"))
+        {
+          builder_.setLowerBound(colIdx, optional<T>());
+          builder_.setUpperBound(colIdx, optional<T>());
+          advance();
+
+          continue;
+        }
+
+        const TokenType sense(current_.type);
+        advance();
+
+        bool isNegative(false);
+        const optional<T> value(readBoundValue(isNegative));
+        setBound(colIdx, sense, false, value, isNegative);
+      }
+      else
+      {
+        bool isNegative(false);
+        const optional<T> value(readBoundValue(isNegative));
+
+        const TokenType sense(current_.type);
+        advance();
+
+        if (current_.type != TokenType::Identifier)
+        {
+          throw error("Variable name expected");
+        }
+        const DenseIndex colIdx(column(current_));
+        advance();
+
+        setBound(colIdx, sense, true, value, isNegative);
+
+        //Double-sided bound
+        if (isSense(current_))
+        {
+          const TokenType rightSense(current_.type);
+          advance();
+
+          bool isRightNegative(false);
+          const optional<T> rightValue(readBoundValue(isRightNegative));
+          setBound(colIdx, rightSense, false, rightValue, isRightNegative);
+        }
+      }
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::setBound
+   * @param colIdx
+   * @param sense
+   * @param isValueOnLeft `true' for `value <op> x', `false' for
+   * `x <op> value'.
+   * @param value Bound value, `none' if infinite.
+   * @param isNegative Sign of the infinite value.
+   */
+  void
+  LpReader<T>::setBound(
+    DenseIndex colIdx, TokenType sense, bool isValueOnLeft,
+    const optional<T>& value, bool isNegative
+  )
+  {
+    //Bring to the `x <op> value' form
+    if (isValueOnLeft)
+    {
+      if (sense == TokenType::LessThanOrEqual)
+      {
+        sense = TokenType::GreaterThanOrEqual;
+      }
+      else if (sense == TokenType::GreaterThanOrEqual)
+      {
+        sense = TokenType::LessThanOrEqual;
+      }
+    }
+
+    switch (sense)
+    {
+      case TokenType::LessThanOrEqual:
+        if (!value && isNegative)
+        {
+          throw error("Upper bound can not be minus infinity");
+        }
+        //Negative upper bound w/o the lower one makes the variable
+        //unbounded below (the CPLEX convention)
+        if (value && *value < T(0) && !builder_.hasLowerBound(colIdx))
+        {
+          builder_.setLowerBound(colIdx, optional<T>());
+        }
+        builder_.setUpperBound(colIdx, value);
+        break;
+
+      case TokenType::GreaterThanOrEqual:
+        if (!value && !isNegative)
+        {
+          throw error("Lower bound can not be plus infinity");
+        }
+        builder_.setLowerBound(colIdx, value);
+        break;
+
+      case TokenType::Equal:
+        if (!value)
+        {
+          throw error("Variable can not be fixed at infinity");
+        }
+        builder_.setLowerBound(colIdx, value);
+        builder_.setUpperBound(colIdx, value);
+        break;
+
+      default:
+        throw error("Bound sense (`<=', `>=' or `=') expected");
+    }
+  }
+
+
+  template<typename T>
+  void
+  LpReader<T>::readBinaries()
+  {
+    while (section() == Section::None)
+    {
+      if (current_.type != TokenType::Identifier)
+      {
+        throw error("Variable name expected");
+      }
+
+      const DenseIndex colIdx(column(current_));
+      builder_.setLowerBound(colIdx, T(0));
+      builder_.setUpperBound(colIdx, T(1));
+
+      advance();
+    }
+  }
+
+
+  template<typename T>
+  void
+  LpReader<T>::skipIdentifiers()
+  {
+    while (section() == Section::None)
+    {
+      if (current_.type != TokenType::Identifier)
+      {
+        throw error("Variable name expected");
+      }
+
+      column(current_);
+      advance();
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::readExpression
+   * Reads the linear expression and adds its terms to the row `rowIdx'
+   * (to the objective function if `rowIdx' < 0). Stops at the first
+   * token that can not continue the expression.
+   * @param rowIdx
+   * @return Sum of the constant terms.
+   */
+  T
+  LpReader<T>::readExpression(DenseIndex rowIdx)
+  {
+    T constant(0);
+
+    while (
+      (current_.type == TokenType::Plus ||
+       current_.type == TokenType::Minus ||
+       current_.type == TokenType::Number ||
+       current_.type == TokenType::Identifier) &&
+      section() == Section::None
+    )
+    {
+      bool isNegative(false);
+      while (
+        current_.type == TokenType::Plus || current_.type == TokenType::Minus
+      )
+      {
+        isNegative ^= (current_.type == TokenType::Minus);
+        advance();
+      }
+
+      T coeff(1);
+      bool haveCoeff(false);
+      if (current_.type == TokenType::Number)
+      {
+        if (!parseNumber<T>(current_.first, current_.last, coeff))
+        {
+          throw error(
+            "Invalid number `" + string(current_.first, current_.last) + "'"
+          );
+        }
+        haveCoeff = true;
+        advance();
+      }
+
+      if (isNegative)
+      {
+        coeff = coeff * T(-1);
+      }
+
+      if (current_.type == TokenType::Identifier && section() == Section::None)
+      {
+        const DenseIndex colIdx(column(current_));
+        if (rowIdx < 0)
+        {
+          builder_.addObjectiveCoeff(colIdx, coeff);
+        }
+        else
+        {
+          builder_.addCoeff(rowIdx, colIdx, coeff);
+        }
+        advance();
+      }
+      else if (haveCoeff)
+      {
+        constant += coeff;
+      }
+      else
+      {
+        throw error("Term expected");
+      }
+    }
+
+    return constant;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::readNumber
+   * Reads the optionally signed finite number.
+   * @return
+   */
+  T
+  LpReader<T>::readNumber() throw(ParseError)
+  {
+    bool isNegative(false);
+    while (
+      current_.type == TokenType::Plus || current_.type == TokenType::Minus
+    )
+    {
+      isNegative ^= (current_.type == TokenType::Minus);
+      advance();
+    }
+
+    T value;
+    if (
+      current_.type != TokenType::Number ||
+      !parseNumber<T>(current_.first, current_.last, value)
+    )
+    {
+      throw error("Number expected");
+    }
+    advance();
+
+    return (isNegative ? value * T(-1) : value);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::readBoundValue
+   * Reads the optionally signed bound value.
+   * @param isNegative Set to `true' if the value has the minus sign.
+   * @return (optional) Bound value, `none' if the bound is infinite.
+   */
+  optional<T>
+  LpReader<T>::readBoundValue(bool& isNegative) throw(ParseError)
+  {
+    isNegative = false;
+    while (
+      current_.type == TokenType::Plus || current_.type == TokenType::Minus
+    )
+    {
+      isNegative ^= (current_.type == TokenType::Minus);
+      advance();
+    }
+
+    bool isInfiniteValue(false);
+    if (current_.type == TokenType::Identifier && isInfinity(current_))
+    {
+      isInfiniteValue = true;
+    }
+    else if (current_.type == TokenType::Number)
+    {
+      bool isNegativeInfinity(false);
+      isInfiniteValue =
+        isInfinite(current_.first, current_.last, isNegativeInfinity);
+    }
+    else
+    {
+      throw error("Bound value expected");
+    }
+
+    if (isInfiniteValue)
+    {
+      advance();
+
+      return optional<T>();
+    }
+
+    T value;
+    if (!parseNumber<T>(current_.first, current_.last, value))
+    {
+      throw error(
+        "Invalid number `" + string(current_.first, current_.last) + "'"
+      );
+    }
+    advance();
+
+    return optional<T>(isNegative ? value * T(-1) : value);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::column
+   * @param token
+   * @return Index of the variable named by `token', the new variable
+   * is added if there is no such one yet.
+   */
+  DenseIndex
+  LpReader<T>::column(const Token& token)
+  {
+    name_.assign(token.first, token.last);
+
+    const optional<DenseIndex> colIdx(builder_.columnIndex(name_));
+
+    return (colIdx ? *colIdx : builder_.addColumn(name_));
+  }
+
+
+  template<typename T>
+  bool
+  LpReader<T>::isSense(const Token& token) const
+  {
+    return (
+      token.type == TokenType::LessThanOrEqual ||
+      token.type == TokenType::GreaterThanOrEqual ||
+      token.type == TokenType::Equal
+    );
+  }
+
+
+  template<typename T>
+  bool
+  LpReader<T>::isInfinity(const Token& token) const
+  {
+    return (equals(token, "inf") || equals(token, "infinity"));
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::isLabel
+   * @return `true' if the current token is the row or objective name,
+   * i.e. it is followed by a colon.
+   */
+  bool
+  LpReader<T>::isLabel() const
+  {
+    return (
+      current_.type == TokenType::Identifier &&
+      next_.type == TokenType::Colon
+    );
+  }
+
+
+  template<typename T>
+  /**
+   * @brief LpReader<T>::equals
+   * @param token
+   * @param keyword Lowercase keyword.
+   * @return `true' if the token is equal to `keyword' ignoring case.
+   */
+  bool
+  LpReader<T>::equals(const Token& token, const char* keyword) const
+  {
+    if (token.type != TokenType::Identifier)
+    {
+      return false;
+    }
+
+    const char* it(token.first);
+    for (; it != token.last && *keyword != '\0'; ++it, ++keyword)
+    {
+      if (std::tolower(static_cast<unsigned char>(*it)) != *keyword)
+      {
+        return false;
+      }
+    }
+
+    return (it == token.last && *keyword == '\0');
+  }
+
+
+  template<typename T>
+  ParseError
+  LpReader<T>::error(const string& what) const
+  {
+    return ParseError(what, current_.line);
+  }
+}
+
+
+#endif // LPREADER_TXX
@@ -0,0 +1,115 @@
+﻿#include "mappedfile.hxx"
+
+#include <cstddef>
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+
+namespace ProgramIO
+{
+  using std::runtime_error;
+  using std::size_t;
+  using std::string;
+  using std::vector;
+
+
+  /**
+   * @brief MappedFile::MappedFile
+   * @param fileName
+   */
+  MappedFile::MappedFile(const string& fileName) throw(runtime_error)
+  {
+#ifndef _WIN32
+    const int fd(::open(fileName.c_str(), O_RDONLY));
+    if (fd < 0)
+    {
+      throw runtime_error("Couldn't open file `" + fileName + "'");
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0)
+    {
+      ::close(fd);
+
+      throw runtime_error("Couldn't stat file `" + fileName + "'");
+    }
+
+    size_ = size_t(info.st_size);
+
+    //NOTE: Empty files can not be mapped
+    if (size_ > 0)
+    {
+      void* const addr(::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0));
+      if (addr != MAP_FAILED)
+      {
+        ::madvise(addr, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(addr);
+        isMapped_ = true;
+      }
+    }
+
+    ::close(fd);
+
+    if (isMapped_ || size_ == 0)
+    {
+      return;
+    }
+#endif // _WIN32
+
+    //Fall back to the plain reading
+    std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+    if (!stream)
+    {
+      throw runtime_error("Couldn't open file `" + fileName + "'");
+    }
+
+    buffer_.assign(
+      std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()
+    );
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+  }
+
+
+  MappedFile::~MappedFile()
+  {
+#ifndef _WIN32
+    if (isMapped_)
+    {
+      ::munmap(const_cast<char*>(data_), size_);
+    }
+#endif // _WIN32
+  }
+
+
+  const char*
+  MappedFile::begin() const
+  {
+    return data_;
+  }
+
+
+  const char*
+  MappedFile::end() const
+  {
+    return data_ + size_;
+  }
+
+
+  size_t
+  MappedFile::size() const
+  {
+    return size_;
+  }
+}
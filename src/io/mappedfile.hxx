@@ -0,0 +1,58 @@
+﻿#pragma once
+
+#ifndef MAPPEDFILE_HXX
+#define MAPPEDFILE_HXX
+
+
+#include <cstddef>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace ProgramIO
+{
+  using std::runtime_error;
+  using std::size_t;
+  using std::string;
+  using std::vector;
+
+
+  /**
+   * @brief The MappedFile class
+   * Read-only view of the whole file contents. The file is mapped
+   * into memory where `mmap' is available and read into a buffer
+   * otherwise.
+   */
+  class MappedFile
+  {
+    public:
+      explicit MappedFile(const string& fileName) throw(runtime_error);
+
+      MappedFile(const MappedFile& other) = delete;
+
+      const MappedFile& operator =(const MappedFile& other) = delete;
+
+      ~MappedFile();
+
+      const char* begin() const;
+
+      const char* end() const;
+
+      size_t size() const;
+
+
+    private:
+      const char* data_ = nullptr;
+
+      size_t size_ = 0;
+
+      bool isMapped_ = false;
+
+      vector<char> buffer_;
+  };
+}
+
+
+#endif // MAPPEDFILE_HXX
@@ -0,0 +1,22 @@
+﻿#pragma once
+
+#ifndef MPSFORMAT_HXX
+#define MPSFORMAT_HXX
+
+
+namespace ProgramIO
+{
+  /**
+   * @brief The MpsFormat enum
+   * `Fixed' is the original column-oriented MPS layout where names
+   * may contain spaces, `Free' is the whitespace-delimited one.
+   */
+  enum struct MpsFormat : int
+  {
+    Fixed = 0,
+    Free = 1
+  };
+}
+
+
+#endif // MPSFORMAT_HXX
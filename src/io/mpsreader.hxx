@@ -0,0 +1,139 @@
+﻿#pragma once
+
+#ifndef MPSREADER_HXX
+#define MPSREADER_HXX
+
+
+#include <cstddef>
+
+#include <istream>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "importedprogram.hxx"
+#include "mpsformat.hxx"
+#include "parseerror.hxx"
+#include "standardformbuilder.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using NumericTypes::real_t;
+  using std::istream;
+  using std::pair;
+  using std::size_t;
+  using std::string;
+  using std::unordered_set;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The MpsReader class
+   * Reads the linear program in the fixed or free MPS format
+   * line by line, so only the current line and the non-zero
+   * coefficients are kept in memory until the standard form
+   * program is built.
+   * Supported sections: NAME, OBJSENSE, OBJNAME, ROWS, COLUMNS,
+   * RHS, RANGES, BOUNDS and ENDATA. Integrality markers are skipped.
+   */
+  class MpsReader
+  {
+    public:
+      explicit MpsReader(MpsFormat format = MpsFormat::Free);
+
+      ImportedProgram<T> read(istream& stream) throw(ParseError);
+
+
+    private:
+      enum struct Section : int
+      {
+        None = 0,
+        ObjSense = 1,
+        ObjName = 2,
+        Rows = 3,
+        Columns = 4,
+        RHS = 5,
+        Ranges = 6,
+        Bounds = 7,
+        EndData = 8
+      };
+
+
+      using Token = pair<const char*, const char*>;
+
+
+      MpsFormat format_;
+
+      StandardFormBuilder<T> builder_;
+
+      Section section_ = Section::None;
+
+      size_t lineNumber_ = 0;
+
+      vector<Token> tokens_;
+
+      string objectiveName_;
+
+      bool haveObjective_ = false;
+
+      unordered_set<string> freeRows_;
+
+      optional<string> rhsSetName_;
+
+      optional<string> rangesSetName_;
+
+      optional<string> boundsSetName_;
+
+      string currColName_;
+
+      DenseIndex currColIdx_ = -1;
+
+
+      void reset();
+
+      void tokenize(const string& line);
+
+      void tokenizeFixed(const string& line);
+
+      void readHeader(const string& line);
+
+      void readObjSense();
+
+      void readRows();
+
+      void readColumns();
+
+      void readRHS();
+
+      void readRanges();
+
+      void readBounds();
+
+      bool acceptSetName(optional<string>& setName, const string& name) const;
+
+      string token(size_t idx) const;
+
+      T number(size_t idx) const throw(ParseError);
+
+      optional<T> bound(size_t idx, bool isUpper) const throw(ParseError);
+
+      optional<DenseIndex> row(size_t idx) const throw(ParseError);
+
+      ParseError error(const string& what) const;
+  };
+}
+
+
+#include "mpsreader.txx"
+
+
+#endif // MPSREADER_HXX
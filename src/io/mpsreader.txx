@@ -0,0 +1,736 @@
+﻿#pragma once
+
+#ifndef MPSREADER_TXX
+#define MPSREADER_TXX
+
+
+#include "mpsreader.hxx"
+
+#include <cctype>
+#include <cstddef>
+
+#include <algorithm>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "boost/algorithm/string/case_conv.hpp"
+#include "boost/optional.hpp"
+
+#include "importedprogram.hxx"
+#include "numericformat.hxx"
+#include "parseerror.hxx"
+#include "../lp/optimizationgoaltype.hxx"
+#include "../lp/rowsense.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::algorithm::to_upper_copy;
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using LinearProgramming::OptimizationGoalType;
+  using LinearProgramming::RowSense;
+  using std::invalid_argument;
+  using std::istream;
+  using std::make_pair;
+  using std::size_t;
+  using std::string;
+
+
+  template<typename T>
+  /**
+   * @brief MpsReader<T>::MpsReader
+   * @param format
+   */
+  MpsReader<T>::MpsReader(MpsFormat format) :
+    format_(format)
+  { }
+
+
+  template<typename T>
+  /**
+   * @brief MpsReader<T>::read
+   * Reads the whole program from `stream' in one pass.
+   * RHS, RANGES and BOUNDS are converted to the standard form
+   * (see `StandardFormBuilder<T>::build'). Only the first
+   * RHS, RANGES and BOUNDS vectors are used, as usual.
+   * @param stream
+   * @return
+   */
+  ImportedProgram<T>
+  MpsReader<T>::read(istream& stream) throw(ParseError)
+  {
+    reset();
+
+    string line;
+    while (section_ != Section::EndData && std::getline(stream, line))
+    {
+      ++lineNumber_;
+
+      //Tolerate the DOS line endings
+      if (!line.empty() && line.back() == '\r')
+      {
+        line.pop_back();
+      }
+
+      //Skip comments and blank lines
+      if (
+        line.empty() || line[0] == '*' ||
+        std::all_of(
+          line.cbegin(), line.cend(),
+          [](char c) { return std::isspace(static_cast<unsigned char>(c)); }
+        )
+      )
+      {
+        continue;
+      }
+
+      //Section headers start at the first column, data lines do not
+      if (!std::isspace(static_cast<unsigned char>(line[0])))
+      {
+        readHeader(line);
+
+        continue;
+      }
+
+      tokenize(line);
+
+      switch (section_)
+      {
+        case Section::ObjSense:
+          readObjSense();
+          break;
+
+        case Section::ObjName:
+          objectiveName_ = token(0);
+          break;
+
+        case Section::Rows:
+          readRows();
+          break;
+
+        case Section::Columns:
+          readColumns();
+          break;
+
+        case Section::RHS:
+          readRHS();
+          break;
+
+        case Section::Ranges:
+          readRanges();
+          break;
+
+        case Section::Bounds:
+          readBounds();
+          break;
+
+        default:
+          throw error("Data line outside of any section");
+      }
+    }
+
+    if (section_ != Section::EndData)
+    {
+      throw error("Unexpected end of file, `ENDATA' expected");
+    }
+
+    if (!haveObjective_)
+    {
+      throw error("No objective function row (of type `N') found");
+    }
+
+    try
+    {
+      return builder_.build();
+    }
+    catch (const invalid_argument& ia)
+    {
+      throw ParseError(ia.what());
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsReader<T>::reset
+   * Resets the internal state of the object.
+   */
+  void
+  MpsReader<T>::reset()
+  {
+    builder_ = StandardFormBuilder<T>();
+    section_ = Section::None;
+    lineNumber_ = 0;
+    tokens_.clear();
+    objectiveName_.clear();
+    haveObjective_ = false;
+    freeRows_.clear();
+    rhsSetName_ = boost::none;
+    rangesSetName_ = boost::none;
+    boundsSetName_ = boost::none;
+    currColName_.clear();
+    currColIdx_ = -1;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsReader<T>::tokenize
+   * Splits the data line into fields. The tokens point into `line'.
+   * @param line
+   */
+  void
+  MpsReader<T>::tokenize(const string& line)
+  {
+    if (format_ == MpsFormat::Fixed)
+    {
+      tokenizeFixed(line);
+
+      return;
+    }
+
+    tokens_.clear();
+
+    const char* it(line.data());
+    const char* const end(line.data() + line.size());
+
+    while (it < end)
+    {
+      while (it < end && std::isspace(static_cast<unsigned char>(*it)))
+      {
+        ++it;
+      }
+
+      const char* const first(it);
+      while (it < end && !std::isspace(static_cast<unsigned char>(*it)))
+      {
+        ++it;
+      }
+
+      if (first < it)
+      {
+        tokens_.push_back(make_pair(first, it));
+      }
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsReader<T>::tokenizeFixed
+   * Slices the data line at the fixed MPS fields positions
+   * (2-3, 5-12, 15-22, 25-36, 40-47, 50-61) and trims the fields.
+   * The set name field is kept even when blank, so
+   * the RHS, RANGES and BOUNDS lines always have it.
+   * @param line
+   */
+  void
+  MpsReader<T>::tokenizeFixed(const string& line)
+  {
+    static const size_t FieldsBounds[6][2] = {
+      {1, 3}, {4, 12}, {14, 22}, {24, 36}, {39, 47}, {49, 61}
+    };
+
+    tokens_.clear();
+
+    Token fields[6];
+    for (size_t k(0); k < 6; ++k)
+    {
+      const size_t first(std::min(FieldsBounds[k][0], line.size()));
+      const size_t last(std::min(FieldsBounds[k][1], line.size()));
+
+      const char* begin(line.data() + first);
+      const char* end(line.data() + last);
+
+      while (begin < end && std::isspace(static_cast<unsigned char>(*begin)))
+      {
+        ++begin;
+      }
+      while (end > begin && std::isspace(static_cast<unsigned char>(end[-1])))
+      {
+        --end;
+      }
+
+      fields[k] = make_pair(begin, end);
+    }
+
+    size_t first(1);
+    size_t last(6);
+    switch (section_)
+    {
+      case Section::Rows:
+      case Section::Bounds:
+        first = 0;
+        break;
+
+      default:
+        break;
+    }
+
+    //Drop the trailing blank fields
+    while (last > first && fields[last - 1].first == fields[last - 1].second)
+    {
+      --last;
+    }
+
+    for (size_t k(first); k < last; ++k)
+    {
+      tokens_.push_back(fields[k]);
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsReader<T>::readHeader
+   * @param line
+   */
+  void
+  MpsReader<T>::readHeader(const string& line)
+  {
+    const MpsFormat format(format_);
+    format_ = MpsFormat::Free;
+    tokenize(line);
+    format_ = format;
+
+    const string name(to_upper_copy(token(0)));
+
+    if (name == "NAME")
+    {
+      const size_t pos(line.find_first_not_of(" \t", 4));
+      if (pos != string::npos)
+      {
+        builder_.setName(line.substr(pos));
+      }
+      section_ = Section::None;
+    }
+    else if (name == "OBJSENSE" || name == "OBJSENCE")
+    {
+      section_ = Section::ObjSense;
+      if (tokens_.size() > 1)
+      {
+        tokens_.erase(tokens_.begin());
+        readObjSense();
+      }
+    }
+    else if (name == "OBJNAME")
+    {
+      section_ = Section::ObjName;
+      if (tokens_.size() > 1)
+      {
+        objectiveName_ = token(1);
+      }
+    }
+    else if (name == "ROWS")
+    {
+      section_ = Section::Rows;
+    }
+    else if (name == "COLUMNS")
+    {
+      section_ = Section::Columns;
+    }
+    else if (name == "RHS")
+    {
+      section_ = Section::RHS;
+    }
+    else if (name == "RANGES")
+    {
+      section_ = Section::Ranges;
+    }
+    else if (name == "BOUNDS")
+    {
+      section_ = Section::Bounds;
+    }
+    else if (name == "ENDATA")
+    {
+      section_ = Section::EndData;
+    }
+    else
+    {
+      throw error("Unsupported section `" + token(0) + "'");
+    }
+  }
+
+
+  template<typename T>
+  void
+  MpsReader<T>::readObjSense()
+  {
+    const string sense(to_upper_copy(token(0)));
+
+    if (sense == "MAX" || sense == "MAXIMIZE" || sense == "MAXIMISE")
+    {
+      builder_.setGoalType(OptimizationGoalType::Maximize);
+    }
+    else if (sense == "MIN" || sense == "MINIMIZE" || sense == "MINIMISE")
+    {
+      builder_.setGoalType(OptimizationGoalType::Minimize);
+    }
+    else
+    {
+      throw error("Unknown objective sense `" + token(0) + "'");
+    }
+  }
+
+
+  template<typename T>
+  void
+  MpsReader<T>::readRows()
+  {
+    if (tokens_.size() < 2)
+    {
+      throw error("Row type and name expected");
+    }
+
+    const string type(to_upper_copy(token(0)));
+    const string name(token(1));
+
+    if (type == "N")
+    {
+      if (
+        !haveObjective_ && (objectiveName_.empty() || objectiveName_ == name)
+      )
+      {
+        objectiveName_ = name;
+        haveObjective_ = true;
+      }
+      else
+      {
+        freeRows_.insert(name);
+      }
+    }
+    else if (type == "E")
+    {
+      builder_.addRow(name, RowSense::Equal);
+    }
+    else if (type == "L")
+    {
+      builder_.addRow(name, RowSense::LessThanOrEqual);
+    }
+    else if (type == "G")
+    {
+      builder_.addRow(name, RowSense::GreaterThanOrEqual);
+    }
+    else
+    {
+      throw error("Unknown row type `" + token(0) + "'");
+    }
+  }
+
+
+  template<typename T>
+  void
+  MpsReader<T>::readColumns()
+  {
+    //Skip the integrality markers
+    if (tokens_.size() >= 2 && token(1) == "'MARKER'")
+    {
+      return;
+    }
+
+    if (tokens_.size() != 3 && tokens_.size() != 5)
+    {
+      throw error("Column name and 1 or 2 (row, value) pairs expected");
+    }
+
+    const string name(token(0));
+    if (currColIdx_ < 0 || name != currColName_)
+    {
+      const optional<DenseIndex> colIdx(builder_.columnIndex(name));
+      currColIdx_ = (colIdx ? *colIdx : builder_.addColumn(name));
+      currColName_ = name;
+    }
+
+    for (size_t k(1); k < tokens_.size(); k += 2)
+    {
+      const optional<DenseIndex> rowIdx(row(k));
+      if (rowIdx)
+      {
+        builder_.addCoeff(*rowIdx, currColIdx_, number(k + 1));
+      }
+      else
+      {
+        if (token(k) == objectiveName_)
+        {
+          builder_.addObjectiveCoeff(currColIdx_, number(k + 1));
+        }
+      }
+    }
+  }
+
+
+  template<typename T>
+  void
+  MpsReader<T>::readRHS()
+  {
+    if (tokens_.size() < 2 || tokens_.size() > 5)
+    {
+      throw error("1 or 2 (row, value) pairs expected");
+    }
+
+    //Odd count of fields means that the set name is present
+    size_t first(0);
+    if (tokens_.size() % 2 == 1)
+    {
+      if (!acceptSetName(rhsSetName_, token(0)))
+      {
+        return;
+      }
+      first = 1;
+    }
+
+    for (size_t k(first); k + 1 < tokens_.size(); k += 2)
+    {
+      const optional<DenseIndex> rowIdx(row(k));
+      if (rowIdx)
+      {
+        builder_.setRHS(*rowIdx, number(k + 1));
+      }
+      else
+      {
+        //RHS of the objective function row is its negated constant term
+        if (token(k) == objectiveName_)
+        {
+          builder_.setObjectiveOffset(number(k + 1) * T(-1));
+        }
+      }
+    }
+  }
+
+
+  template<typename T>
+  void
+  MpsReader<T>::readRanges()
+  {
+    if (tokens_.size() < 2 || tokens_.size() > 5)
+    {
+      throw error("1 or 2 (row, value) pairs expected");
+    }
+
+    size_t first(0);
+    if (tokens_.size() % 2 == 1)
+    {
+      if (!acceptSetName(rangesSetName_, token(0)))
+      {
+        return;
+      }
+      first = 1;
+    }
+
+    for (size_t k(first); k + 1 < tokens_.size(); k += 2)
+    {
+      const optional<DenseIndex> rowIdx(row(k));
+      if (rowIdx)
+      {
+        builder_.setRange(*rowIdx, number(k + 1));
+      }
+    }
+  }
+
+
+  template<typename T>
+  void
+  MpsReader<T>::readBounds()
+  {
+    if (tokens_.size() < 2)
+    {
+      throw error("Bound type and column name expected");
+    }
+
+    const string type(to_upper_copy(token(0)));
+    const bool haveValue(
+      type == "UP" || type == "LO" || type == "FX" ||
+      type == "UI" || type == "LI"
+    );
+
+    //Bound w/ the set name has one field more
+    const size_t fieldsCount(tokens_.size());
+    size_t colTokenIdx(1);
+    if (fieldsCount == (haveValue ? 4u : 3u))
+    {
+      if (!acceptSetName(boundsSetName_, token(1)))
+      {
+        return;
+      }
+      colTokenIdx = 2;
+    }
+    else
+    {
+      if (fieldsCount != (haveValue ? 3u : 2u) && type != "BV")
+      {
+        throw error("Wrong number of fields in the bound");
+      }
+    }
+
+    const string colName(token(colTokenIdx));
+    const optional<DenseIndex> colIdx(builder_.columnIndex(colName));
+    if (!colIdx)
+    {
+      throw error("Unknown column `" + colName + "'");
+    }
+
+    if (type == "UP" || type == "UI")
+    {
+      const optional<T> value(bound(colTokenIdx + 1, true));
+      //Negative upper bound w/o the lower one makes the variable
+      //unbounded below (the CPLEX convention)
+      if (value && *value < T(0) && !builder_.hasLowerBound(*colIdx))
+      {
+        builder_.setLowerBound(*colIdx, optional<T>());
+      }
+      builder_.setUpperBound(*colIdx, value);
+    }
+    else if (type == "LO" || type == "LI")
+    {
+      builder_.setLowerBound(*colIdx, bound(colTokenIdx + 1, false));
+    }
+    else if (type == "FX")
+    {
+      const T value(number(colTokenIdx + 1));
+      builder_.setLowerBound(*colIdx, value);
+      builder_.setUpperBound(*colIdx, value);
+    }
+    else if (type == "FR")
+    {
+      builder_.setLowerBound(*colIdx, optional<T>());
+      builder_.setUpperBound(*colIdx, optional<T>());
+    }
+    else if (type == "MI")
+    {
+      builder_.setLowerBound(*colIdx, optional<T>());
+    }
+    else if (type == "PL")
+    {
+      builder_.setUpperBound(*colIdx, optional<T>());
+    }
+    else if (type == "BV")
+    {
+      builder_.setLowerBound(*colIdx, T(0));
+      builder_.setUpperBound(*colIdx, T(1));
+    }
+    else
+    {
+      throw error("Unsupported bound type `" + token(0) + "'");
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsReader<T>::acceptSetName
+   * Remembers the first seen set name.
+   * @param setName
+   * @param name
+   * @return `true' if the line belongs to the first set.
+   */
+  bool
+  MpsReader<T>::acceptSetName(
+    optional<string>& setName, const string& name
+  ) const
+  {
+    if (!setName)
+    {
+      setName = name;
+    }
+
+    return (*setName == name);
+  }
+
+
+  template<typename T>
+  string
+  MpsReader<T>::token(size_t idx) const
+  {
+    if (idx >= tokens_.size())
+    {
+      throw error("Unexpected end of line");
+    }
+
+    return string(tokens_[idx].first, tokens_[idx].second);
+  }
+
+
+  template<typename T>
+  T
+  MpsReader<T>::number(size_t idx) const throw(ParseError)
+  {
+    if (idx >= tokens_.size())
+    {
+      throw error("Number expected");
+    }
+
+    T value;
+    if (!parseNumber<T>(tokens_[idx].first, tokens_[idx].second, value))
+    {
+      throw error("Invalid number `" + token(idx) + "'");
+    }
+
+    return value;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsReader<T>::bound
+   * @param idx
+   * @param isUpper
+   * @return (optional) Bound value, `none' if the bound is infinite.
+   */
+  optional<T>
+  MpsReader<T>::bound(size_t idx, bool isUpper) const throw(ParseError)
+  {
+    if (idx >= tokens_.size())
+    {
+      throw error("Bound value expected");
+    }
+
+    bool isNegative(false);
+    if (isInfinite(tokens_[idx].first, tokens_[idx].second, isNegative))
+    {
+      if (isNegative == isUpper)
+      {
+        throw error("Infinite bound has wrong sign");
+      }
+
+      return optional<T>();
+    }
+
+    return optional<T>(number(idx));
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsReader<T>::row
+   * @param idx
+   * @return (optional) Index of the constraint named by the token `idx',
+   * `none' for the objective function row and the free rows.
+   */
+  optional<DenseIndex>
+  MpsReader<T>::row(size_t idx) const throw(ParseError)
+  {
+    const string name(token(idx));
+    const optional<DenseIndex> rowIdx(builder_.rowIndex(name));
+
+    if (!rowIdx && name != objectiveName_ && freeRows_.count(name) == 0)
+    {
+      throw error("Unknown row `" + name + "'");
+    }
+
+    return rowIdx;
+  }
+
+
+  template<typename T>
+  ParseError
+  MpsReader<T>::error(const string& what) const
+  {
+    return ParseError(what, lineNumber_);
+  }
+}
+
+
+#endif // MPSREADER_TXX
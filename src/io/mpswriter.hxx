@@ -0,0 +1,73 @@
+﻿#pragma once
+
+#ifndef MPSWRITER_HXX
+#define MPSWRITER_HXX
+
+
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "mpsformat.hxx"
+#include "../lp/linearprogramdata.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using Eigen::DenseIndex;
+  using LinearProgramming::LinearProgramData;
+  using NumericTypes::real_t;
+  using std::ostream;
+  using std::string;
+  using std::unordered_set;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The MpsWriter class
+   * Writes the standard form program (min (c, x): αx = β, x >= 0)
+   * in the fixed or free MPS format. Rows and columns are written
+   * straight to the stream, zero coefficients are skipped.
+   */
+  class MpsWriter
+  {
+    public:
+      explicit MpsWriter(MpsFormat format = MpsFormat::Free);
+
+      void write(
+        ostream& stream, const LinearProgramData<T>& linearProgramData,
+        const string& name = string(),
+        const vector<string>& rowNames = vector<string>(),
+        const vector<string>& columnNames = vector<string>()
+      ) const;
+
+
+    private:
+      MpsFormat format_;
+
+
+      void writeLine(
+        ostream& stream, const string& type, const string& name,
+        const string& field0 = string(), const string& value0 = string(),
+        const string& field1 = string(), const string& value1 = string()
+      ) const;
+
+      vector<string> uniqueNames(
+        const vector<string>& names, DenseIndex count, const string& prefix,
+        unordered_set<string> takenNames
+      ) const;
+
+      bool isValidName(const string& name) const;
+
+      string value(const T& value) const;
+  };
+}
+
+
+#include "mpswriter.txx"
+
+
+#endif // MPSWRITER_HXX
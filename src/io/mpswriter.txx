@@ -0,0 +1,341 @@
+﻿#pragma once
+
+#ifndef MPSWRITER_TXX
+#define MPSWRITER_TXX
+
+
+#include "mpswriter.hxx"
+
+#include <cstddef>
+
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+
+#include "numericformat.hxx"
+#include "../config.hxx"
+#include "../lp/linearprogramdata.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using Eigen::DenseIndex;
+  using fmt::format;
+  using LinearProgramming::LinearProgramData;
+  using std::ostream;
+  using std::size_t;
+  using std::string;
+  using std::unordered_set;
+  using std::vector;
+
+
+  template<typename T>
+  /**
+   * @brief MpsWriter<T>::MpsWriter
+   * @param format
+   */
+  MpsWriter<T>::MpsWriter(MpsFormat format) :
+    format_(format)
+  { }
+
+
+  template<typename T>
+  /**
+   * @brief MpsWriter<T>::write
+   * Writes `linearProgramData' to `stream'. Rows and columns w/o
+   * a valid name in `rowNames' and `columnNames' (see `isValidName'),
+   * or w/ the name that is already taken, are named `R<i>' and `X<j>'
+   * (see `uniqueNames'), the objective function row is named `COST'.
+   * @param stream
+   * @param linearProgramData
+   * @param name
+   * @param rowNames
+   * @param columnNames
+   */
+  void
+  MpsWriter<T>::write(
+    ostream& stream, const LinearProgramData<T>& linearProgramData,
+    const string& name,
+    const vector<string>& rowNames,
+    const vector<string>& columnNames
+  ) const
+  {
+    const DenseIndex rows(linearProgramData.constraintsCount());
+    const DenseIndex cols(linearProgramData.variablesCount());
+
+    const string objectiveName("COST");
+
+    //NOTE: The objective function row shares the names w/ the constraints
+    const vector<string> uniqueRowNames(
+      uniqueNames(rowNames, rows, "R", {objectiveName})
+    );
+    const vector<string> uniqueColumnNames(
+      uniqueNames(columnNames, cols, "X", {})
+    );
+
+    const auto rowName([&uniqueRowNames](DenseIndex i) -> const string&
+    {
+      return uniqueRowNames[size_t(i)];
+    });
+
+    const auto columnName([&uniqueColumnNames](DenseIndex j) -> const string&
+    {
+      return uniqueColumnNames[size_t(j)];
+    });
+
+    stream << "NAME          " << (name.empty() ? "PROGRAM" : name) << '\n';
+
+    stream << "ROWS\n";
+    writeLine(stream, "N", objectiveName);
+    for (DenseIndex i(0); i < rows; ++i)
+    {
+      writeLine(stream, "E", rowName(i));
+    }
+
+    stream << "COLUMNS\n";
+    for (DenseIndex j(0); j < cols; ++j)
+    {
+      const string colName(columnName(j));
+
+      //NOTE: Entries are written in pairs, the pending one is kept here
+      string pendingRow;
+      string pendingValue;
+      bool isEmpty(true);
+
+      const auto put([&](const string& row, const T& coeff)
+      {
+        isEmpty = false;
+
+        if (pendingRow.empty())
+        {
+          pendingRow = row;
+          pendingValue = value(coeff);
+        }
+        else
+        {
+          writeLine(
+            stream, string(), colName,
+            pendingRow, pendingValue, row, value(coeff)
+          );
+          pendingRow.clear();
+        }
+      });
+
+      if (linearProgramData.objectiveFunctionCoeffs(j) != T(0))
+      {
+        put(objectiveName, linearProgramData.objectiveFunctionCoeffs(j));
+      }
+
+      for (DenseIndex i(0); i < rows; ++i)
+      {
+        if (linearProgramData.constraintsCoeffs(i, j) != T(0))
+        {
+          put(rowName(i), linearProgramData.constraintsCoeffs(i, j));
+        }
+      }
+
+      //Column must appear at least once to be defined
+      if (isEmpty)
+      {
+        put(objectiveName, T(0));
+      }
+
+      if (!pendingRow.empty())
+      {
+        writeLine(stream, string(), colName, pendingRow, pendingValue);
+      }
+    }
+
+    stream << "RHS\n";
+    string pendingRow;
+    string pendingValue;
+    for (DenseIndex i(0); i < rows; ++i)
+    {
+      if (linearProgramData.constraintsRHS(i) == T(0))
+      {
+        continue;
+      }
+
+      if (pendingRow.empty())
+      {
+        pendingRow = rowName(i);
+        pendingValue = value(linearProgramData.constraintsRHS(i));
+      }
+      else
+      {
+        writeLine(
+          stream, string(), "RHS", pendingRow, pendingValue,
+          rowName(i), value(linearProgramData.constraintsRHS(i))
+        );
+        pendingRow.clear();
+      }
+    }
+    if (!pendingRow.empty())
+    {
+      writeLine(stream, string(), "RHS", pendingRow, pendingValue);
+    }
+
+    stream << "ENDATA\n";
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsWriter<T>::writeLine
+   * Writes the data line, padding the fields to their fixed positions
+   * in the fixed format and separating them by spaces in the free one.
+   * @param stream
+   * @param type
+   * @param name
+   * @param field0
+   * @param value0
+   * @param field1
+   * @param value1
+   */
+  void
+  MpsWriter<T>::writeLine(
+    ostream& stream, const string& type, const string& name,
+    const string& field0, const string& value0,
+    const string& field1, const string& value1
+  ) const
+  {
+    if (format_ == MpsFormat::Fixed)
+    {
+      string line(format(" {:<2} {:<8}", type, name));
+
+      if (!field0.empty())
+      {
+        line += format("  {:<8}  {:>12}", field0, value0);
+      }
+
+      if (!field1.empty())
+      {
+        line += format("   {:<8}  {:>12}", field1, value1);
+      }
+
+      line.erase(line.find_last_not_of(' ') + 1);
+
+      stream << line << '\n';
+    }
+    else
+    {
+      stream << ' ';
+
+      if (!type.empty())
+      {
+        stream << type << ' ';
+      }
+
+      stream << name;
+
+      if (!field0.empty())
+      {
+        stream << ' ' << field0 << ' ' << value0;
+      }
+
+      if (!field1.empty())
+      {
+        stream << ' ' << field1 << ' ' << value1;
+      }
+
+      stream << '\n';
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsWriter<T>::uniqueNames
+   * Names `count' rows (or columns). The ones w/o a valid name
+   * in `names', or w/ the name that is in `takenNames' or is given
+   * to one of the previous ones, are named `<prefix><i>' (w/ the `_<k>'
+   * suffix if even that name is taken), so that the program written
+   * is read back as is.
+   * @param names
+   * @param count
+   * @param prefix
+   * @param takenNames
+   * @return
+   */
+  vector<string>
+  MpsWriter<T>::uniqueNames(
+    const vector<string>& names, DenseIndex count, const string& prefix,
+    unordered_set<string> takenNames
+  ) const
+  {
+    vector<string> ret;
+    ret.reserve(size_t(count));
+
+    for (DenseIndex i(0); i < count; ++i)
+    {
+      string name(
+        size_t(i) < names.size() && isValidName(names[size_t(i)]) ?
+        names[size_t(i)] : string()
+      );
+
+      if (name.empty() || takenNames.count(name) > 0)
+      {
+        name = format("{}{}", prefix, i + 1);
+
+        for (size_t k(1); takenNames.count(name) > 0; ++k)
+        {
+          name = format("{}{}_{}", prefix, i + 1, k);
+        }
+      }
+
+      takenNames.insert(name);
+      ret.push_back(std::move(name));
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsWriter<T>::isValidName
+   * @param name
+   * @return `true' if `name' can be written as is: it is non-empty,
+   * has no whitespace and, in the fixed format, fits the name field.
+   */
+  bool
+  MpsWriter<T>::isValidName(const string& name) const
+  {
+    const size_t width(Config::ProgramIO::FixedMpsNameWidth);
+
+    return (
+      !name.empty() && name.find_first_of(" \t") == string::npos &&
+      (format_ == MpsFormat::Free || name.size() <= width)
+    );
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MpsWriter<T>::value
+   * Formats the coefficient. Values that do not fit the fixed format
+   * field are rounded to the nearest decimal that does.
+   * @param value
+   * @return
+   */
+  string
+  MpsWriter<T>::value(const T& value) const
+  {
+    if (format_ == MpsFormat::Free)
+    {
+      return formatNumber<T>(value);
+    }
+
+    return formatRoundedNumber<T>(
+      value, Config::ProgramIO::FixedMpsValueWidth
+    );
+  }
+}
+
+
+#endif // MPSWRITER_TXX
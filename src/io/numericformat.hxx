@@ -0,0 +1,76 @@
+﻿#pragma once
+
+#ifndef NUMERICFORMAT_HXX
+#define NUMERICFORMAT_HXX
+
+
+#include <cstddef>
+
+#include <string>
+
+#include "../math/numerictypes.hxx"
+#include "../misc/utils.hxx"
+
+
+namespace ProgramIO
+{
+  using NumericTypes::real_t;
+  using std::size_t;
+  using std::string;
+  using Utils::AlwaysFalse;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief parseNumber
+   * Parses the characters range [first; last) w/o any allocations.
+   * Accepts the plain decimal notation (w/ optional exponent),
+   * the `p/q' fraction notation and the `inf'/`infinity' keywords.
+   * @param first
+   * @param last
+   * @param value
+   * @return `true' if the whole range was consumed, `false' otherwise.
+   */
+  bool
+  parseNumber(const char* first, const char* last, T& value)
+  {
+    static_assert(
+      AlwaysFalse<T>::value,
+      "ProgramIO::parseNumber<T>: "
+      "You can only use one of the specified template specializations!"
+    );
+
+    return false;
+  }
+
+
+  template<typename T = real_t>
+  /**
+   * @brief formatNumber
+   * Formats `value' so that `parseNumber<T>' gives back the same value.
+   * @param value
+   * @return
+   */
+  string
+  formatNumber(const T& value)
+  {
+    static_assert(
+      AlwaysFalse<T>::value,
+      "ProgramIO::formatNumber<T>: "
+      "You can only use one of the specified template specializations!"
+    );
+
+    return string();
+  }
+
+
+  template<typename T = real_t>
+  string
+  formatRoundedNumber(const T& value, size_t width);
+}
+
+
+#include "numericformat.txx"
+
+
+#endif // NUMERICFORMAT_HXX
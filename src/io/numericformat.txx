@@ -0,0 +1,404 @@
+﻿#pragma once
+
+#ifndef NUMERICFORMAT_TXX
+#define NUMERICFORMAT_TXX
+
+
+#include "numericformat.hxx"
+
+#include <cctype>
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "fmt/format.h"
+
+#include "../math/mathutils.hxx"
+#include "../math/numericlimits.hxx"
+#include "../math/numerictypes.hxx"
+#include "../config.hxx"
+
+
+namespace ProgramIO
+{
+  using fmt::format;
+  using MathUtils::isFinite;
+  using MathUtils::numericCast;
+  using MathUtils::rationalize;
+  using NumericTypes::integer_t;
+  using NumericTypes::rational_t;
+  using NumericTypes::real_t;
+  using std::pair;
+  using std::size_t;
+  using std::string;
+
+
+  namespace Detail
+  {
+    inline bool
+    isDigit(char c)
+    {
+      return (std::isdigit(static_cast<unsigned char>(c)) != 0);
+    }
+
+
+    /**
+     * @brief parseReal
+     * Parses [first; last) as a floating-point number using `strtod'.
+     * Tokens are short, so they are copied to the stack buffer to get
+     * the terminating zero that `strtod' requires.
+     * @param first
+     * @param last
+     * @param value
+     * @return
+     */
+    inline bool
+    parseReal(const char* first, const char* last, double& value)
+    {
+      constexpr std::ptrdiff_t BufferSize = 64;
+
+      if (first >= last || last - first >= BufferSize)
+      {
+        return false;
+      }
+
+      char buffer[BufferSize];
+      std::copy(first, last, buffer);
+      buffer[last - first] = '\0';
+
+      char* end(nullptr);
+      value = std::strtod(buffer, &end);
+
+      return (end == buffer + (last - first));
+    }
+
+
+    /**
+     * @brief appendDigit
+     * Computes (acc * 10 + digit) checking for overflow.
+     * @param acc
+     * @param digit
+     * @return `false' if the result does not fit into `integer_t'.
+     */
+    inline bool
+    appendDigit(integer_t& acc, int digit)
+    {
+      if (acc > (NumericLimits::max<integer_t>() - digit) / integer_t(10))
+      {
+        return false;
+      }
+
+      acc = acc * integer_t(10) + integer_t(digit);
+
+      return true;
+    }
+
+
+    /**
+     * @brief parseExactDecimal
+     * Parses [first; last) as the exact rational value of the decimal
+     * number `[+-]digits[.digits][(e|E)[+-]digits]'.
+     * @param first
+     * @param last
+     * @param value
+     * @return `false' if the syntax is wrong or the result overflows.
+     */
+    inline bool
+    parseExactDecimal(const char* first, const char* last, rational_t& value)
+    {
+      const char* it(first);
+
+      bool isNegative(false);
+      if (it < last && (*it == '+' || *it == '-'))
+      {
+        isNegative = (*it == '-');
+        ++it;
+      }
+
+      integer_t numerator(0);
+      int scale(0);
+      bool haveDigits(false);
+
+      for (; it < last && isDigit(*it); ++it)
+      {
+        haveDigits = true;
+        if (!appendDigit(numerator, *it - '0'))
+        {
+          return false;
+        }
+      }
+
+      if (it < last && *it == '.')
+      {
+        ++it;
+        for (; it < last && isDigit(*it); ++it)
+        {
+          haveDigits = true;
+          if (!appendDigit(numerator, *it - '0'))
+          {
+            return false;
+          }
+          --scale;
+        }
+      }
+
+      if (!haveDigits)
+      {
+        return false;
+      }
+
+      if (it < last && (*it == 'e' || *it == 'E'))
+      {
+        ++it;
+
+        bool isExponentNegative(false);
+        if (it < last && (*it == '+' || *it == '-'))
+        {
+          isExponentNegative = (*it == '-');
+          ++it;
+        }
+
+        if (it == last)
+        {
+          return false;
+        }
+
+        int exponent(0);
+        for (; it < last && isDigit(*it); ++it)
+        {
+          exponent = exponent * 10 + (*it - '0');
+          if (exponent > 64)
+          {
+            return false;
+          }
+        }
+
+        scale += (isExponentNegative ? -exponent : exponent);
+      }
+
+      if (it != last)
+      {
+        return false;
+      }
+
+      integer_t denominator(1);
+      for (; scale > 0; --scale)
+      {
+        if (!appendDigit(numerator, 0))
+        {
+          return false;
+        }
+      }
+      for (; scale < 0; ++scale)
+      {
+        if (!appendDigit(denominator, 0))
+        {
+          return false;
+        }
+      }
+
+      value = rational_t(isNegative ? -numerator : numerator, denominator);
+
+      return true;
+    }
+
+
+    /**
+     * @brief findSlash
+     * @param first
+     * @param last
+     * @return Position of the fraction slash or `last'.
+     */
+    inline const char*
+    findSlash(const char* first, const char* last)
+    {
+      return std::find(first, last, '/');
+    }
+  }
+
+
+  /**
+   * @brief isInfinite
+   * Checks if [first; last) denotes an infinite bound, i.e. it is one
+   * of the `inf'/`infinity' keywords or its magnitude reaches
+   * `Config::ProgramIO::Infinity'.
+   * @param first
+   * @param last
+   * @param isNegative Set to the sign of the value.
+   * @return
+   */
+  inline bool
+  isInfinite(const char* first, const char* last, bool& isNegative)
+  {
+    double value(0.);
+    if (Detail::findSlash(first, last) != last)
+    {
+      return false;
+    }
+
+    if (!Detail::parseReal(first, last, value))
+    {
+      return false;
+    }
+
+    isNegative = (value < 0.);
+
+    return (
+      !isFinite<real_t>(real_t(value)) ||
+      value >= Config::ProgramIO::Infinity ||
+      value <= -Config::ProgramIO::Infinity
+    );
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  template<>
+  inline bool
+  parseNumber<real_t>(const char* first, const char* last, real_t& value)
+  {
+    const char* const slash(Detail::findSlash(first, last));
+    if (slash == last)
+    {
+      return Detail::parseReal(first, last, value);
+    }
+    else
+    {
+      double numerator(0.), denominator(0.);
+      if (
+        Detail::parseReal(first, slash, numerator) &&
+        Detail::parseReal(slash + 1, last, denominator) &&
+        denominator != 0.
+      )
+      {
+        value = numerator / denominator;
+
+        return true;
+      }
+
+      return false;
+    }
+  }
+
+
+  template<>
+  inline bool
+  parseNumber<rational_t>(const char* first, const char* last, rational_t& value)
+  {
+    const char* const slash(Detail::findSlash(first, last));
+    if (slash != last)
+    {
+      rational_t numerator, denominator;
+      if (
+        Detail::parseExactDecimal(first, slash, numerator) &&
+        Detail::parseExactDecimal(slash + 1, last, denominator) &&
+        denominator != rational_t(0)
+      )
+      {
+        value = numerator / denominator;
+
+        return true;
+      }
+
+      return false;
+    }
+
+    if (Detail::parseExactDecimal(first, last, value))
+    {
+      return true;
+    }
+
+    //Too many digits for the exact value: approximate it
+    double approximation(0.);
+    if (
+      Detail::parseReal(first, last, approximation) &&
+      isFinite<real_t>(approximation)
+    )
+    {
+      const pair<integer_t, integer_t> rationalized(
+        rationalize<integer_t, real_t>(approximation)
+      );
+      value = rational_t(rationalized.first, rationalized.second);
+
+      return true;
+    }
+
+    return false;
+  }
+
+
+  template<>
+  inline string
+  formatNumber<real_t>(const real_t& value)
+  {
+    //15 significant digits give the "human" representation of most
+    //values, 17 digits are enough to round-trip any `double'
+    const string shortest(format("{:.15g}", value));
+
+    double parsed(0.);
+    if (
+      Detail::parseReal(
+        shortest.data(), shortest.data() + shortest.size(), parsed
+      ) && parsed == value
+    )
+    {
+      return shortest;
+    }
+
+    return format("{:.17g}", value);
+  }
+
+
+  template<>
+  inline string
+  formatNumber<rational_t>(const rational_t& value)
+  {
+    if (value.denominator() == integer_t(1))
+    {
+      return format("{}", value.numerator());
+    }
+    else
+    {
+      return format("{}/{}", value.numerator(), value.denominator());
+    }
+  }
+#endif // LP_WITH_MULTIPRECISION
+
+
+  template<typename T>
+  /**
+   * @brief formatRoundedNumber
+   * Formats `value' (see `formatNumber'), rounding it to the nearest
+   * decimal that fits `width' characters if it does not.
+   * @param value
+   * @param width
+   * @return The exact representation if no decimal fits.
+   */
+  string
+  formatRoundedNumber(const T& value, size_t width)
+  {
+    const string exact(formatNumber<T>(value));
+    if (exact.size() <= width)
+    {
+      return exact;
+    }
+
+    const real_t approx(numericCast<real_t, T>(value));
+    for (int precision(15); precision > 0; --precision)
+    {
+      const string rounded(format("{:.{}g}", approx, precision));
+
+      if (rounded.size() <= width)
+      {
+        return rounded;
+      }
+    }
+
+    return exact;
+  }
+}
+
+
+#endif // NUMERICFORMAT_TXX
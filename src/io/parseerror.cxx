@@ -0,0 +1,38 @@
+﻿#include "parseerror.hxx"
+
+#include <cstddef>
+
+#include <stdexcept>
+#include <string>
+
+
+namespace ProgramIO
+{
+  using std::runtime_error;
+  using std::size_t;
+  using std::string;
+
+
+  /**
+   * @brief ParseError::ParseError
+   * @param what Description of the error.
+   * @param line Number of the line where the error was found.
+   */
+  ParseError::ParseError(const string& what, size_t line) :
+    runtime_error(
+      (line > 0) ? ("line " + std::to_string(line) + ": " + what) : what
+    ),
+    line_(line)
+  { }
+
+
+  /**
+   * @brief ParseError::line
+   * @return Number of the offending line (1-based, 0 if unknown).
+   */
+  size_t
+  ParseError::line() const
+  {
+    return line_;
+  }
+}
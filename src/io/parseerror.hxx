@@ -0,0 +1,40 @@
+﻿#pragma once
+
+#ifndef PARSEERROR_HXX
+#define PARSEERROR_HXX
+
+
+#include <cstddef>
+
+#include <stdexcept>
+#include <string>
+
+
+namespace ProgramIO
+{
+  using std::runtime_error;
+  using std::size_t;
+  using std::string;
+
+
+  /**
+   * @brief The ParseError class
+   * Thrown by the program readers when the input is malformed.
+   * Keeps the number of the offending line (1-based, 0 if unknown).
+   */
+  class ParseError :
+    public runtime_error
+  {
+    public:
+      ParseError(const string& what, size_t line = 0);
+
+      size_t line() const;
+
+
+    private:
+      size_t line_;
+  };
+}
+
+
+#endif // PARSEERROR_HXX
@@ -0,0 +1,172 @@
+﻿#include "programfile.hxx"
+
+#include <cctype>
+
+#include <exception>
+#include <fstream>
+#include <istream>
+#include <string>
+
+#include "boost/optional.hpp"
+
+#include "binaryprogram.hxx"
+#include "compressedstreambuffer.hxx"
+#include "jsonreader.hxx"
+#include "mappedfile.hxx"
+#include "parseerror.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using NumericTypes::Field;
+  using std::string;
+
+
+  namespace
+  {
+    /**
+     * @brief lastPathComponent
+     * @param path
+     * @return The last component of `path'.
+     */
+    string
+    lastPathComponent(const string& path)
+    {
+      const string::size_type pos(path.find_last_of("/\\"));
+
+      return (pos == string::npos ? path : path.substr(pos + 1));
+    }
+
+
+    string
+    toLower(string str)
+    {
+      for (char& c : str)
+      {
+        c = char(std::tolower(static_cast<unsigned char>(c)));
+      }
+
+      return str;
+    }
+  }
+
+
+  namespace Detail
+  {
+    /**
+     * @brief programName
+     * @param fileName
+     * @return The file name w/o the directory and all the suffixes.
+     */
+    string
+    programName(const string& fileName)
+    {
+      const string name(lastPathComponent(fileName));
+
+      return name.substr(0, name.find('.'));
+    }
+  }
+
+
+  /**
+   * @brief programFileFormat
+   * Guesses the format by the file name suffix (ignoring the `.gz'
+   * one): `.mps', `.lp' and `.lpb' files are the MPS, the LP and
+   * the binary ones, everything else is read as JSON.
+   * @param fileName
+   * @return
+   */
+  ProgramFileFormat
+  programFileFormat(const string& fileName)
+  {
+    string name(toLower(lastPathComponent(fileName)));
+    if (isCompressedFile(name))
+    {
+      name.resize(name.size() - 3);
+    }
+
+    const string::size_type pos(name.rfind('.'));
+    const string suffix(pos == string::npos ? string() : name.substr(pos + 1));
+
+    if (suffix == "mps")
+    {
+      return ProgramFileFormat::Mps;
+    }
+    else if (suffix == "lp")
+    {
+      return ProgramFileFormat::Lp;
+    }
+    else if (suffix == "lpb")
+    {
+      return ProgramFileFormat::Binary;
+    }
+    else
+    {
+      return ProgramFileFormat::Json;
+    }
+  }
+
+
+  bool
+  isCompressedFile(const string& fileName)
+  {
+    const string name(toLower(lastPathComponent(fileName)));
+
+    return (name.size() > 3 && name.compare(name.size() - 3, 3, ".gz") == 0);
+  }
+
+
+  /**
+   * @brief readProgramFileField
+   * Reads the field declared in the binary or JSON program file
+   * w/o reading the whole program.
+   * @param fileName
+   * @return (optional) The field, `none' if the file doesn't declare it.
+   */
+  optional<Field>
+  readProgramFileField(const string& fileName) throw(ParseError)
+  {
+    optional<Field> field;
+    const ProgramFileFormat format(programFileFormat(fileName));
+
+    try
+    {
+      if (format == ProgramFileFormat::Binary && !isCompressedFile(fileName))
+      {
+        field = BinaryProgram(fileName).field();
+      }
+      else if (format == ProgramFileFormat::Json && !isCompressedFile(fileName))
+      {
+        const MappedFile file(fileName);
+
+        field = readJsonField(file.begin(), file.end());
+      }
+      else if (format == ProgramFileFormat::Json)
+      {
+        std::ifstream file(fileName, std::ios::in | std::ios::binary);
+        if (!file)
+        {
+          throw ParseError("Couldn't open file");
+        }
+
+        InflatingStreamBuffer buffer(file.rdbuf());
+        std::istream stream(&buffer);
+        stream.exceptions(std::ios::badbit);
+
+        field = readJsonField(stream);
+      }
+    }
+    catch (const ParseError&)
+    {
+      throw;
+    }
+    catch (const std::exception& e)
+    {
+      throw ParseError(e.what());
+    }
+
+    return field;
+  }
+}
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#ifndef PROGRAMFILE_HXX
+#define PROGRAMFILE_HXX
+
+
+#include <string>
+
+#include "boost/optional.hpp"
+
+#include "importedprogram.hxx"
+#include "parseerror.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using NumericTypes::Field;
+  using NumericTypes::real_t;
+  using std::string;
+
+
+  /**
+   * @brief The ProgramFileFormat enum
+   * Format of the program file, see `programFileFormat'.
+   */
+  enum struct ProgramFileFormat : int
+  {
+    Json = 0,
+    Mps = 1,
+    Lp = 2,
+    Binary = 3
+  };
+
+
+  ProgramFileFormat programFileFormat(const string& fileName);
+
+  bool isCompressedFile(const string& fileName);
+
+  optional<Field> readProgramFileField(const string& fileName)
+  throw(ParseError);
+
+
+  template<typename T = real_t>
+  ImportedProgram<T> readProgramFile(const string& fileName)
+  throw(ParseError);
+
+
+  namespace Detail
+  {
+    string programName(const string& fileName);
+  }
+}
+
+
+#include "programfile.txx"
+
+
+#endif // PROGRAMFILE_HXX
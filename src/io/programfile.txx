@@ -0,0 +1,136 @@
+﻿#pragma once
+
+#ifndef PROGRAMFILE_TXX
+#define PROGRAMFILE_TXX
+
+
+#include "programfile.hxx"
+
+#include <exception>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <string>
+
+#include "binaryprogram.hxx"
+#include "compressedstreambuffer.hxx"
+#include "importedprogram.hxx"
+#include "jsonreader.hxx"
+#include "lpreader.hxx"
+#include "mpsreader.hxx"
+#include "parseerror.hxx"
+
+
+namespace ProgramIO
+{
+  using std::string;
+
+
+  template<typename T>
+  /**
+   * @brief readProgramFile
+   * Reads the program from the file of any supported format
+   * (see `programFileFormat'). Compressed files are decompressed
+   * on the fly, except for the binary ones which are meant
+   * to be mapped into memory.
+   * @param fileName
+   * @return
+   */
+  ImportedProgram<T>
+  readProgramFile(const string& fileName) throw(ParseError)
+  {
+    const ProgramFileFormat format(programFileFormat(fileName));
+
+    try
+    {
+      if (!isCompressedFile(fileName))
+      {
+        switch (format)
+        {
+          case ProgramFileFormat::Lp:
+            return LpReader<T>().readFile(fileName);
+
+          case ProgramFileFormat::Binary:
+            {
+              const BinaryProgram binaryProgram(fileName);
+
+              return makeImportedProgram<T>(
+                binaryProgram.view<T>().linearProgramData(),
+                Detail::programName(fileName)
+              );
+            }
+
+          case ProgramFileFormat::Mps:
+            {
+              std::ifstream stream(fileName);
+              if (!stream)
+              {
+                throw ParseError("Couldn't open file");
+              }
+
+              return MpsReader<T>().read(stream);
+            }
+
+          default:
+            return JsonReader<T>().readFile(fileName);
+        }
+      }
+
+      if (format == ProgramFileFormat::Binary)
+      {
+        throw ParseError("Compressed binary programs are not supported");
+      }
+
+      std::ifstream file(fileName, std::ios::in | std::ios::binary);
+      if (!file)
+      {
+        throw ParseError("Couldn't open file");
+      }
+
+      //The data is decompressed chunk by chunk as the reader goes
+      InflatingStreamBuffer buffer(file.rdbuf());
+      std::istream stream(&buffer);
+      stream.exceptions(std::ios::badbit);
+
+      switch (format)
+      {
+        case ProgramFileFormat::Lp:
+          {
+            //NOTE: `LpReader' needs the whole text at once
+            const string text(
+              (std::istreambuf_iterator<char>(stream)),
+              std::istreambuf_iterator<char>()
+            );
+
+            return LpReader<T>().read(text.data(), text.data() + text.size());
+          }
+
+        case ProgramFileFormat::Mps:
+          {
+            ImportedProgram<T> ret(MpsReader<T>().read(stream));
+
+            //NOTE: The rest of the data (after `ENDATA') is read as well,
+            //so that the truncated or corrupted gzip trailer is detected
+            stream.ignore(std::numeric_limits<std::streamsize>::max());
+
+            return ret;
+          }
+
+        default:
+          return JsonReader<T>().read(stream);
+      }
+    }
+    catch (const ParseError&)
+    {
+      throw;
+    }
+    catch (const std::exception& e)
+    {
+      throw ParseError(e.what());
+    }
+  }
+}
+
+
+#endif // PROGRAMFILE_TXX
@@ -0,0 +1,58 @@
+﻿#include "solutionwriter.hxx"
+
+#include <ostream>
+#include <string>
+
+#include "jsonwriter.hxx"
+#include "../lp/solutiontype.hxx"
+
+
+namespace ProgramIO
+{
+  using LinearProgramming::SolutionType;
+  using std::ostream;
+  using std::string;
+
+
+  /**
+   * @brief writeSolutionError
+   * Writes the `{"name": ..., "status": "error", "error": ...}' line
+   * for the program that couldn't be read or solved.
+   * @param stream
+   * @param name
+   * @param what
+   */
+  void
+  writeSolutionError(ostream& stream, const string& name, const string& what)
+  {
+    stream << "{\"name\": " << Detail::jsonString(name)
+           << ", \"status\": \"error\", \"error\": "
+           << Detail::jsonString(what) << "}\n";
+  }
+
+
+  namespace Detail
+  {
+    const char*
+    solutionTypeName(SolutionType type)
+    {
+      switch (type)
+      {
+        case SolutionType::Optimal:
+          return "optimal";
+
+        case SolutionType::Unbounded:
+          return "unbounded";
+
+        case SolutionType::Infeasible:
+          return "infeasible";
+
+        case SolutionType::Incomplete:
+          return "incomplete";
+
+        default:
+          return "unknown";
+      }
+    }
+  }
+}
@@ -0,0 +1,93 @@
+﻿#pragma once
+
+#ifndef SOLUTIONWRITER_HXX
+#define SOLUTIONWRITER_HXX
+
+
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include "boost/optional.hpp"
+
+#include "importedprogram.hxx"
+#include "../lp/linearprogramsolution.hxx"
+#include "../lp/parametricsolution.hxx"
+#include "../lp/solutiontype.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using LinearProgramming::LinearProgramSolution;
+  using LinearProgramming::ParametricSolution;
+  using LinearProgramming::SolutionType;
+  using NumericTypes::real_t;
+  using std::ostream;
+  using std::runtime_error;
+  using std::string;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The SolutionWriter class
+   * Writes the solution of the imported program as the single-line
+   * JSON object:
+   *   {
+   *     "name": "...", "status": "optimal" | "unbounded" | ...,
+   *     "objective": F, "x": [x1, ..., xN], "variables": [...]
+   *   }
+   * The objective value and the point are given in terms of
+   * the original program (see `ImportedProgram'), `variables'
+   * (the original names) are written on request only.
+   * The parametric solution has the arrays of the breakpoints instead:
+   *   {
+   *     "name": "...", "status": ..., "tail": "optimal" | ...,
+   *     "parameter": [t0, ..., tK], "objective": [F0, ..., FK],
+   *     "x": [[x1, ..., xN], ...], "variables": [...]
+   *   }
+   */
+  class SolutionWriter
+  {
+    public:
+      explicit SolutionWriter(bool areNamesWritten = false);
+
+      void write(
+        ostream& stream, const string& name,
+        const ImportedProgram<T>& program, SolutionType type,
+        const optional<LinearProgramSolution<T>>& solution
+      ) const throw(runtime_error);
+
+      void write(
+        ostream& stream, const string& name,
+        const ImportedProgram<T>& program, SolutionType type,
+        const optional<ParametricSolution<T>>& solution
+      ) const throw(runtime_error);
+
+
+    private:
+      bool areNamesWritten_;
+
+
+      void writeNames(ostream& stream, const ImportedProgram<T>& program)
+      const;
+  };
+
+
+  void writeSolutionError(
+    ostream& stream, const string& name, const string& what
+  );
+
+
+  namespace Detail
+  {
+    const char* solutionTypeName(SolutionType type);
+  }
+}
+
+
+#include "solutionwriter.txx"
+
+
+#endif // SOLUTIONWRITER_HXX
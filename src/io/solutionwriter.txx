@@ -0,0 +1,187 @@
+﻿#pragma once
+
+#ifndef SOLUTIONWRITER_TXX
+#define SOLUTIONWRITER_TXX
+
+
+#include "solutionwriter.hxx"
+
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "importedprogram.hxx"
+#include "jsonwriter.hxx"
+#include "../lp/linearprogramsolution.hxx"
+#include "../lp/parametricsolution.hxx"
+#include "../lp/solutiontype.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using LinearProgramming::LinearProgramSolution;
+  using LinearProgramming::ParametricSolution;
+  using LinearProgramming::SolutionType;
+  using std::ostream;
+  using std::runtime_error;
+  using std::string;
+
+
+  template<typename T>
+  /**
+   * @brief SolutionWriter<T>::SolutionWriter
+   * @param areNamesWritten
+   */
+  SolutionWriter<T>::SolutionWriter(bool areNamesWritten) :
+    areNamesWritten_(areNamesWritten)
+  { }
+
+
+  template<typename T>
+  /**
+   * @brief SolutionWriter<T>::write
+   * @param stream
+   * @param name
+   * @param program
+   * @param type
+   * @param solution
+   */
+  void
+  SolutionWriter<T>::write(
+    ostream& stream, const string& name,
+    const ImportedProgram<T>& program, SolutionType type,
+    const optional<LinearProgramSolution<T>>& solution
+  ) const throw(runtime_error)
+  {
+    stream << "{\"name\": " << Detail::jsonString(name)
+           << ", \"status\": \"" << Detail::solutionTypeName(type) << "\"";
+
+    if (solution)
+    {
+      const Matrix<T, Dynamic, 1> x(
+        program.originalPoint(solution->extremePoint)
+      );
+
+      stream << ", \"objective\": "
+             << Detail::jsonValue<T>(
+                  program.originalValue(solution->extremeValue)
+                )
+             << ", \"x\": [";
+      for (DenseIndex j(0); j < x.size(); ++j)
+      {
+        stream << (j > 0 ? ", " : "") << Detail::jsonValue<T>(x(j));
+      }
+      stream << "]";
+
+      writeNames(stream, program);
+    }
+
+    stream << "}\n";
+
+    if (!stream)
+    {
+      throw runtime_error("Couldn't write the solution");
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SolutionWriter<T>::write
+   * Writes the breakpoints of the parametric solution
+   * (see `ParametricSolver<T>').
+   * @param stream
+   * @param name
+   * @param program
+   * @param type The type at the lower end of the range.
+   * @param solution
+   */
+  void
+  SolutionWriter<T>::write(
+    ostream& stream, const string& name,
+    const ImportedProgram<T>& program, SolutionType type,
+    const optional<ParametricSolution<T>>& solution
+  ) const throw(runtime_error)
+  {
+    stream << "{\"name\": " << Detail::jsonString(name)
+           << ", \"status\": \"" << Detail::solutionTypeName(type) << "\"";
+
+    if (solution)
+    {
+      const size_t breakpointsCount(solution->breakpoints.size());
+
+      stream << ", \"tail\": \""
+             << Detail::solutionTypeName(solution->tailType) << "\"";
+
+      stream << ", \"parameter\": [";
+      for (size_t k(0); k < breakpointsCount; ++k)
+      {
+        stream << (k > 0 ? ", " : "")
+               << Detail::jsonValue<T>(solution->breakpoints[k]);
+      }
+
+      stream << "], \"objective\": [";
+      for (size_t k(0); k < breakpointsCount; ++k)
+      {
+        stream << (k > 0 ? ", " : "")
+               << Detail::jsonValue<T>(
+                    program.originalValue(solution->extremeValues[k])
+                  );
+      }
+
+      stream << "], \"x\": [";
+      for (size_t k(0); k < breakpointsCount; ++k)
+      {
+        const Matrix<T, Dynamic, 1> x(
+          program.originalPoint(solution->extremePoints[k])
+        );
+
+        stream << (k > 0 ? ", [" : "[");
+        for (DenseIndex j(0); j < x.size(); ++j)
+        {
+          stream << (j > 0 ? ", " : "") << Detail::jsonValue<T>(x(j));
+        }
+        stream << "]";
+      }
+      stream << "]";
+
+      writeNames(stream, program);
+    }
+
+    stream << "}\n";
+
+    if (!stream)
+    {
+      throw runtime_error("Couldn't write the solution");
+    }
+  }
+
+
+  template<typename T>
+  void
+  SolutionWriter<T>::writeNames(
+    ostream& stream, const ImportedProgram<T>& program
+  ) const
+  {
+    if (areNamesWritten_)
+    {
+      stream << ", \"variables\": [";
+      for (size_t j(0); j < program.variableNames.size(); ++j)
+      {
+        stream << (j > 0 ? ", " : "")
+               << Detail::jsonString(program.variableNames[j]);
+      }
+      stream << "]";
+    }
+  }
+}
+
+
+#endif // SOLUTIONWRITER_TXX
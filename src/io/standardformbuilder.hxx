@@ -0,0 +1,142 @@
+﻿#pragma once
+
+#ifndef STANDARDFORMBUILDER_HXX
+#define STANDARDFORMBUILDER_HXX
+
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "importedprogram.hxx"
+#include "../lp/optimizationgoaltype.hxx"
+#include "../lp/rowsense.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using LinearProgramming::OptimizationGoalType;
+  using LinearProgramming::RowSense;
+  using NumericTypes::real_t;
+  using std::invalid_argument;
+  using std::string;
+  using std::unordered_map;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The StandardFormBuilder class
+   * Collects a general-form program (rows w/ sense and range,
+   * columns w/ lower and upper bounds) entry by entry, keeping only
+   * the non-zero coefficients, and converts it to the standard form
+   * accepted by the solvers.
+   */
+  class StandardFormBuilder
+  {
+    public:
+      StandardFormBuilder() = default;
+
+      void setName(const string& name);
+
+      void setGoalType(OptimizationGoalType goalType);
+
+      DenseIndex addRow(const string& name, RowSense sense);
+
+      DenseIndex addColumn(const string& name);
+
+      optional<DenseIndex> rowIndex(const string& name) const;
+
+      optional<DenseIndex> columnIndex(const string& name) const;
+
+      DenseIndex rowsCount() const;
+
+      DenseIndex columnsCount() const;
+
+      void addCoeff(DenseIndex rowIdx, DenseIndex colIdx, const T& value);
+
+      void addObjectiveCoeff(DenseIndex colIdx, const T& value);
+
+      void setObjectiveOffset(const T& value);
+
+      void setRHS(DenseIndex rowIdx, const T& value);
+
+      void setSense(DenseIndex rowIdx, RowSense sense);
+
+      void setRange(DenseIndex rowIdx, const T& value);
+
+      void setLowerBound(DenseIndex colIdx, const optional<T>& value);
+
+      void setUpperBound(DenseIndex colIdx, const optional<T>& value);
+
+      bool hasLowerBound(DenseIndex colIdx) const;
+
+      ImportedProgram<T> build() const throw(invalid_argument);
+
+
+    private:
+      struct Row
+      {
+        RowSense sense;
+        T rhs;
+        optional<T> range;
+      };
+
+
+      struct Column
+      {
+        //NOTE: `none' stands for the infinite bound
+        optional<T> lowerBound;
+        optional<T> upperBound;
+        bool hasExplicitLowerBound;
+      };
+
+
+      struct Entry
+      {
+        DenseIndex rowIdx;
+        DenseIndex colIdx;
+        T value;
+      };
+
+
+      string name_;
+
+      OptimizationGoalType goalType_ = OptimizationGoalType::Minimize;
+
+      vector<string> rowNames_;
+
+      vector<string> columnNames_;
+
+      unordered_map<string, DenseIndex> rowIndices_;
+
+      unordered_map<string, DenseIndex> columnIndices_;
+
+      vector<Row> rows_;
+
+      vector<Column> columns_;
+
+      vector<T> objectiveCoeffs_;
+
+      T objectiveOffset_ = T(0);
+
+      /**
+       * @brief entries_
+       * Non-zero constraints coefficients in the order of arrival.
+       */
+      vector<Entry> entries_;
+  };
+}
+
+
+#include "standardformbuilder.txx"
+
+
+#endif // STANDARDFORMBUILDER_HXX
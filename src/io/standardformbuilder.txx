@@ -0,0 +1,521 @@
+﻿#pragma once
+
+#ifndef STANDARDFORMBUILDER_TXX
+#define STANDARDFORMBUILDER_TXX
+
+
+#include "standardformbuilder.hxx"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "importedprogram.hxx"
+#include "../lp/linearprogramdata.hxx"
+#include "../lp/optimizationgoaltype.hxx"
+#include "../lp/rowsense.hxx"
+#include "../math/mathutils.hxx"
+
+
+namespace ProgramIO
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using LinearProgramming::LinearProgramData;
+  using LinearProgramming::OptimizationGoalType;
+  using LinearProgramming::RowSense;
+  using MathUtils::absoluteValue;
+  using std::invalid_argument;
+  using std::string;
+  using std::vector;
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::setName
+   * @param name
+   */
+  void
+  StandardFormBuilder<T>::setName(const string& name)
+  {
+    name_ = name;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::setGoalType
+   * @param goalType
+   */
+  void
+  StandardFormBuilder<T>::setGoalType(OptimizationGoalType goalType)
+  {
+    goalType_ = goalType;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::addRow
+   * Appends the constraint w/ zero RHS and no range.
+   * @param name
+   * @param sense
+   * @return Index of the new row.
+   */
+  DenseIndex
+  StandardFormBuilder<T>::addRow(const string& name, RowSense sense)
+  {
+    const DenseIndex rowIdx(rows_.size());
+
+    rows_.push_back(Row{sense, T(0), optional<T>()});
+    rowNames_.push_back(name);
+    rowIndices_.emplace(name, rowIdx);
+
+    return rowIdx;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::addColumn
+   * Appends the variable w/ default bounds [0; +∞).
+   * @param name
+   * @return Index of the new column.
+   */
+  DenseIndex
+  StandardFormBuilder<T>::addColumn(const string& name)
+  {
+    const DenseIndex colIdx(columns_.size());
+
+    columns_.push_back(Column{optional<T>(T(0)), optional<T>(), false});
+    columnNames_.push_back(name);
+    columnIndices_.emplace(name, colIdx);
+    objectiveCoeffs_.push_back(T(0));
+
+    return colIdx;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::rowIndex
+   * @param name
+   * @return (optional) Index of the row named `name'.
+   */
+  optional<DenseIndex>
+  StandardFormBuilder<T>::rowIndex(const string& name) const
+  {
+    optional<DenseIndex> ret;
+
+    const auto it(rowIndices_.find(name));
+    if (it != rowIndices_.end())
+    {
+      ret = it->second;
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::columnIndex
+   * @param name
+   * @return (optional) Index of the column named `name'.
+   */
+  optional<DenseIndex>
+  StandardFormBuilder<T>::columnIndex(const string& name) const
+  {
+    optional<DenseIndex> ret;
+
+    const auto it(columnIndices_.find(name));
+    if (it != columnIndices_.end())
+    {
+      ret = it->second;
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  DenseIndex
+  StandardFormBuilder<T>::rowsCount() const
+  {
+    return rows_.size();
+  }
+
+
+  template<typename T>
+  DenseIndex
+  StandardFormBuilder<T>::columnsCount() const
+  {
+    return columns_.size();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::addCoeff
+   * Adds `value' to the coefficient `α[rowIdx, colIdx]'.
+   * Zero values are not stored.
+   * @param rowIdx
+   * @param colIdx
+   * @param value
+   */
+  void
+  StandardFormBuilder<T>::addCoeff(
+    DenseIndex rowIdx, DenseIndex colIdx, const T& value
+  )
+  {
+    if (value != T(0))
+    {
+      entries_.push_back(Entry{rowIdx, colIdx, value});
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::addObjectiveCoeff
+   * Adds `value' to the objective function coefficient `c[colIdx]'.
+   * @param colIdx
+   * @param value
+   */
+  void
+  StandardFormBuilder<T>::addObjectiveCoeff(DenseIndex colIdx, const T& value)
+  {
+    objectiveCoeffs_[colIdx] += value;
+  }
+
+
+  template<typename T>
+  void
+  StandardFormBuilder<T>::setObjectiveOffset(const T& value)
+  {
+    objectiveOffset_ = value;
+  }
+
+
+  template<typename T>
+  void
+  StandardFormBuilder<T>::setRHS(DenseIndex rowIdx, const T& value)
+  {
+    rows_[rowIdx].rhs = value;
+  }
+
+
+  template<typename T>
+  void
+  StandardFormBuilder<T>::setSense(DenseIndex rowIdx, RowSense sense)
+  {
+    rows_[rowIdx].sense = sense;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::setRange
+   * Sets the MPS-style range `R' of the row, so the row
+   * becomes (lo <= (α[i], x) <= hi), where
+   *   [lo; hi] == [β - |R|; β] for (<=) rows,
+   *   [lo; hi] == [β; β + |R|] for (>=) rows,
+   *   [lo; hi] == [β; β + R] or [β + R; β] for (==) rows
+   * depending on the sign of `R'.
+   * @param rowIdx
+   * @param value
+   */
+  void
+  StandardFormBuilder<T>::setRange(DenseIndex rowIdx, const T& value)
+  {
+    rows_[rowIdx].range = value;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::setLowerBound
+   * @param colIdx
+   * @param value Lower bound value, `none' for (-∞).
+   */
+  void
+  StandardFormBuilder<T>::setLowerBound(
+    DenseIndex colIdx, const optional<T>& value
+  )
+  {
+    columns_[colIdx].lowerBound = value;
+    columns_[colIdx].hasExplicitLowerBound = true;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::setUpperBound
+   * @param colIdx
+   * @param value Upper bound value, `none' for (+∞).
+   */
+  void
+  StandardFormBuilder<T>::setUpperBound(
+    DenseIndex colIdx, const optional<T>& value
+  )
+  {
+    columns_[colIdx].upperBound = value;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::hasLowerBound
+   * @param colIdx
+   * @return `true' if the lower bound was set explicitly.
+   */
+  bool
+  StandardFormBuilder<T>::hasLowerBound(DenseIndex colIdx) const
+  {
+    return columns_[colIdx].hasExplicitLowerBound;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief StandardFormBuilder<T>::build
+   * Converts the collected program to the standard form:
+   *  - variable w/ the finite lower bound `l' is shifted: x == l + x';
+   *  - variable w/ only the finite upper bound `u' is mirrored: x == u - x';
+   *  - free variable is split: x == x' - x'';
+   *  - fixed variable is substituted by its value;
+   *  - (<=) and (>=) rows get the slack variable (w/ coeff 1 or -1);
+   *  - ranged row (lo <= (α[i], x) <= hi) becomes ((α[i], x) - s == lo)
+   *    plus the extra row (s + t == hi - lo);
+   *  - variable w/ both the finite bounds gets the extra row
+   *    (x' + t == u - l);
+   *  - maximization objective is negated.
+   * Only the resulting dense matrix is allocated at once, all the
+   * intermediate data is kept as the list of non-zero entries.
+   * @return
+   */
+  ImportedProgram<T>
+  StandardFormBuilder<T>::build() const throw(invalid_argument)
+  {
+    struct BoundedColumn
+    {
+      DenseIndex colIdx;
+      DenseIndex varIdx;
+      T width;
+    };
+
+
+    ImportedProgram<T> ret;
+    ret.name = name_;
+    ret.goalType = goalType_;
+    ret.variableNames = columnNames_;
+    ret.columnMappings = vector<ColumnMapping<T>>(columns_.size());
+
+    //Lay out the structural columns
+    DenseIndex colsCount(0);
+    vector<BoundedColumn> boundedColumns;
+
+    for (DenseIndex j(0); j < DenseIndex(columns_.size()); ++j)
+    {
+      const Column& column(columns_[j]);
+      ColumnMapping<T>& mapping(ret.columnMappings[j]);
+
+      if (column.lowerBound && column.upperBound)
+      {
+        if (*column.upperBound < *column.lowerBound)
+        {
+          throw invalid_argument(
+            "Column `" + columnNames_[j] + "' has empty bounds interval"
+          );
+        }
+
+        mapping.offset = *column.lowerBound;
+
+        if (*column.upperBound != *column.lowerBound)
+        {
+          mapping.positive = colsCount++;
+          ret.columnNames.push_back(columnNames_[j]);
+          boundedColumns.push_back(
+            BoundedColumn{
+              mapping.positive, j, *column.upperBound - *column.lowerBound
+            }
+          );
+        }
+      }
+      else
+      {
+        if (column.lowerBound)
+        {
+          mapping.offset = *column.lowerBound;
+          mapping.positive = colsCount++;
+          ret.columnNames.push_back(columnNames_[j]);
+        }
+        else
+        {
+          if (column.upperBound)
+          {
+            mapping.offset = *column.upperBound;
+            mapping.negative = colsCount++;
+            ret.columnNames.push_back(columnNames_[j] + "~neg");
+          }
+          else
+          {
+            mapping.positive = colsCount++;
+            ret.columnNames.push_back(columnNames_[j]);
+            mapping.negative = colsCount++;
+            ret.columnNames.push_back(columnNames_[j] + "~neg");
+          }
+        }
+      }
+    }
+
+    //Lay out the rows and the slack columns, the extra rows (for the ranges
+    //and the bounds) are appended after all the original ones
+    const DenseIndex originalRowsCount(rows_.size());
+    vector<Entry> slackEntries;
+    vector<T> rhs;
+    vector<T> extraRHS;
+    rhs.reserve(rows_.size());
+    ret.rowNames = rowNames_;
+
+    for (DenseIndex i(0); i < originalRowsCount; ++i)
+    {
+      const Row& row(rows_[i]);
+      rhs.push_back(row.rhs);
+
+      if (row.range)
+      {
+        const T width(absoluteValue<T>(*row.range));
+
+        if (
+          row.sense == RowSense::LessThanOrEqual ||
+          (row.sense == RowSense::Equal && *row.range < T(0))
+        )
+        {
+          rhs[i] = row.rhs - width;
+        }
+
+        //Zero-width range turns the row into the equality one
+        if (width != T(0))
+        {
+          const DenseIndex slackIdx(colsCount++);
+          ret.columnNames.push_back(rowNames_[i] + "~slack");
+          slackEntries.push_back(Entry{i, slackIdx, T(-1)});
+
+          const DenseIndex extraRowIdx(ret.rowNames.size());
+          ret.rowNames.push_back(rowNames_[i] + "~range");
+          extraRHS.push_back(width);
+          slackEntries.push_back(Entry{extraRowIdx, slackIdx, T(1)});
+          slackEntries.push_back(Entry{extraRowIdx, colsCount++, T(1)});
+          ret.columnNames.push_back(rowNames_[i] + "~range");
+        }
+      }
+      else
+      {
+        switch (row.sense)
+        {
+          case RowSense::LessThanOrEqual:
+            slackEntries.push_back(Entry{i, colsCount++, T(1)});
+            ret.columnNames.push_back(rowNames_[i] + "~slack");
+            break;
+
+          case RowSense::GreaterThanOrEqual:
+            slackEntries.push_back(Entry{i, colsCount++, T(-1)});
+            ret.columnNames.push_back(rowNames_[i] + "~slack");
+            break;
+
+          default:
+            break;
+        }
+      }
+    }
+
+    for (const BoundedColumn& boundedColumn : boundedColumns)
+    {
+      const DenseIndex extraRowIdx(ret.rowNames.size());
+      ret.rowNames.push_back(columnNames_[boundedColumn.varIdx] + "~bound");
+      extraRHS.push_back(boundedColumn.width);
+      slackEntries.push_back(Entry{extraRowIdx, boundedColumn.colIdx, T(1)});
+      slackEntries.push_back(Entry{extraRowIdx, colsCount++, T(1)});
+      ret.columnNames.push_back(columnNames_[boundedColumn.varIdx] + "~bound");
+    }
+
+    rhs.insert(rhs.end(), extraRHS.begin(), extraRHS.end());
+    const DenseIndex rowsCount(rhs.size());
+
+    //Materialize the dense program substituting the original variables
+    Matrix<T, 1, Dynamic> objFuncCoeffs(
+      Matrix<T, 1, Dynamic>::Zero(1, colsCount)
+    );
+    Matrix<T, Dynamic, Dynamic> constrsCoeffs(
+      Matrix<T, Dynamic, Dynamic>::Zero(rowsCount, colsCount)
+    );
+    Matrix<T, Dynamic, 1> constrsRHS(rowsCount, 1);
+
+    for (DenseIndex i(0); i < rowsCount; ++i)
+    {
+      constrsRHS(i) = rhs[i];
+    }
+
+    for (const Entry& entry : entries_)
+    {
+      const ColumnMapping<T>& mapping(ret.columnMappings[entry.colIdx]);
+
+      constrsRHS(entry.rowIdx) -= entry.value * mapping.offset;
+      if (mapping.positive >= 0)
+      {
+        constrsCoeffs(entry.rowIdx, mapping.positive) += entry.value;
+      }
+      if (mapping.negative >= 0)
+      {
+        constrsCoeffs(entry.rowIdx, mapping.negative) -= entry.value;
+      }
+    }
+
+    for (const Entry& entry : slackEntries)
+    {
+      constrsCoeffs(entry.rowIdx, entry.colIdx) += entry.value;
+    }
+
+    T objectiveOffset(objectiveOffset_);
+    for (DenseIndex j(0); j < DenseIndex(columns_.size()); ++j)
+    {
+      const ColumnMapping<T>& mapping(ret.columnMappings[j]);
+      const T& value(objectiveCoeffs_[j]);
+
+      objectiveOffset += value * mapping.offset;
+      if (mapping.positive >= 0)
+      {
+        objFuncCoeffs(mapping.positive) += value;
+      }
+      if (mapping.negative >= 0)
+      {
+        objFuncCoeffs(mapping.negative) -= value;
+      }
+    }
+
+    if (goalType_ == OptimizationGoalType::Maximize)
+    {
+      objFuncCoeffs *= T(-1);
+      objectiveOffset *= T(-1);
+    }
+
+    ret.objectiveOffset = objectiveOffset;
+    ret.linearProgramData = LinearProgramData<T>(
+      std::move(objFuncCoeffs),
+      std::move(constrsCoeffs),
+      std::move(constrsRHS)
+    );
+
+    return ret;
+  }
+}
+
+
+#endif // STANDARDFORMBUILDER_TXX
@@ -0,0 +1,85 @@
+﻿#include "basiscache.hxx"
+
+#include <cstddef>
+
+#include <mutex>
+#include <vector>
+
+#include "boost/optional.hpp"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using std::lock_guard;
+  using std::size_t;
+  using std::vector;
+
+
+  /**
+   * @brief BasisCache::BasisCache
+   * @param capacity Count of the structures whose bases are kept.
+   */
+  BasisCache::BasisCache(size_t capacity) :
+    entries_(capacity)
+  { }
+
+
+  /**
+   * @brief BasisCache::find
+   * @param key
+   * @return (optional) The basic variables indices in the order
+   * of the constraints.
+   */
+  optional<vector<DenseIndex>>
+  BasisCache::find(const Key& key)
+  {
+    optional<vector<DenseIndex>> ret;
+
+    lock_guard<mutex> lock(mutex_);
+
+    const vector<DenseIndex>* const basicVars(entries_.find(key));
+    if (basicVars != nullptr)
+    {
+      ret = *basicVars;
+    }
+
+    return ret;
+  }
+
+
+  /**
+   * @brief BasisCache::insert
+   * Replaces the basis of the structure `key'.
+   * @param key
+   * @param basicVars
+   */
+  void
+  BasisCache::insert(const Key& key, const vector<DenseIndex>& basicVars)
+  {
+    lock_guard<mutex> lock(mutex_);
+    entries_.insert(key, basicVars);
+  }
+
+
+  void
+  BasisCache::clear()
+  {
+    lock_guard<mutex> lock(mutex_);
+    entries_.clear();
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  template
+  BasisCache::Key BasisCache::makeKey<NumericTypes::real_t>(
+    const LinearProgramData<NumericTypes::real_t>&
+  );
+  template
+  BasisCache::Key BasisCache::makeKey<NumericTypes::rational_t>(
+    const LinearProgramData<NumericTypes::rational_t>&
+  );
+#endif // LP_WITH_MULTIPRECISION
+}
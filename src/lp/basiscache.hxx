@@ -0,0 +1,79 @@
+﻿#pragma once
+
+#ifndef BASISCACHE_HXX
+#define BASISCACHE_HXX
+
+
+#include <cstddef>
+
+#include <mutex>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "../misc/hasher.hxx"
+#include "../misc/lrucache.hxx"
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using std::mutex;
+  using std::size_t;
+  using std::vector;
+  using Utils::Digest;
+  using Utils::DigestHash;
+  using Utils::LruCache;
+
+
+  /**
+   * @brief The BasisCache class
+   * Maps the structure of the programs (the shape and the nonzero pattern
+   * of the constraints coefficients matrix `A') to the basic variables
+   * of the most recent optimal solution of the program of this structure.
+   * The programs that only differ in values are likely to share
+   * the optimal basis, so `SimplexSolver' tries it first.
+   * The basis is given as is, it is up to the solver to check it.
+   * All the members are thread-safe.
+   */
+  class BasisCache
+  {
+    public:
+      using Key = Digest;
+
+
+      explicit BasisCache(
+        size_t capacity = Config::LinearProgramming::BasisCacheCapacity
+      );
+
+      BasisCache(const BasisCache&) = delete;
+
+      BasisCache& operator =(const BasisCache&) = delete;
+
+      template<typename T>
+      static Key makeKey(const LinearProgramData<T>& linearProgramData);
+
+      optional<vector<DenseIndex>> find(const Key& key);
+
+      void insert(const Key& key, const vector<DenseIndex>& basicVars);
+
+      void clear();
+
+
+    private:
+      //Guards everything below
+      mutex mutex_;
+
+      LruCache<Key, vector<DenseIndex>, DigestHash> entries_;
+  };
+}
+
+
+#include "basiscache.txx"
+
+
+#endif // BASISCACHE_HXX
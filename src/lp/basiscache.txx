@@ -0,0 +1,83 @@
+﻿#pragma once
+
+#ifndef BASISCACHE_TXX
+#define BASISCACHE_TXX
+
+
+#include "basiscache.hxx"
+
+#include <cstdint>
+
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "../math/numerictypes.hxx"
+#include "../misc/hasher.hxx"
+
+
+namespace LinearProgramming
+{
+  using Eigen::DenseIndex;
+  using Utils::Hasher;
+
+
+  template<typename T>
+  /**
+   * @brief BasisCache::makeKey
+   * Hashes the shape and the nonzero pattern of the constraints
+   * coefficients matrix (row by row, 64 entries per word).
+   * @param linearProgramData
+   * @return
+   */
+  BasisCache::Key
+  BasisCache::makeKey(const LinearProgramData<T>& linearProgramData)
+  {
+    const auto& constraints(linearProgramData.constraintsCoeffs);
+
+    Hasher hasher;
+
+    hasher.add(uint64_t(constraints.rows()));
+    hasher.add(uint64_t(constraints.cols()));
+
+    uint64_t word(0);
+    int bitsCount(0);
+
+    for (DenseIndex i(0); i < constraints.rows(); ++i)
+    {
+      for (DenseIndex j(0); j < constraints.cols(); ++j)
+      {
+        word = (word << 1) | uint64_t(constraints(i, j) != T(0));
+
+        if (++bitsCount == 64)
+        {
+          hasher.add(word);
+          word = 0;
+          bitsCount = 0;
+        }
+      }
+    }
+
+    if (bitsCount > 0)
+    {
+      hasher.add(word);
+    }
+
+    return hasher.digest();
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `basiscache.cxx'
+  extern template
+  BasisCache::Key BasisCache::makeKey<NumericTypes::real_t>(
+    const LinearProgramData<NumericTypes::real_t>&
+  );
+  extern template
+  BasisCache::Key BasisCache::makeKey<NumericTypes::rational_t>(
+    const LinearProgramData<NumericTypes::rational_t>&
+  );
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // BASISCACHE_TXX
@@ -0,0 +1,12 @@
+﻿#include "batchsolver.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class BatchSolver<NumericTypes::real_t>;
+  template class BatchSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
@@ -0,0 +1,85 @@
+﻿#pragma once
+
+#ifndef BATCHSOLVER_HXX
+#define BATCHSOLVER_HXX
+
+
+#include <cstddef>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+
+#include "basiscache.hxx"
+#include "linearprogramdata.hxx"
+#include "linearprogramsolution.hxx"
+#include "simplexsolver.hxx"
+#include "solutioncache.hxx"
+#include "solutiontype.hxx"
+#include "../math/numerictypes.hxx"
+#include "../misc/threadpool.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using NumericTypes::real_t;
+  using std::pair;
+  using std::shared_ptr;
+  using std::size_t;
+  using std::vector;
+  using Utils::ThreadPool;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The BatchSolver class
+   * Solves the batches of independent programs w/ `SimplexSolver<T>'
+   * on all the cores (see `ThreadPool'). Every worker reuses its own
+   * solver, so the storage of the programs of the same size is only
+   * allocated once per worker.
+   * If the cache is given, the programs solved before (by this or
+   * any other front-end sharing it) are not solved again.
+   * If the basis cache is given, the programs of the same structure
+   * are solved starting from each other's optimal basis.
+   * The batches given to the same instance are solved one at a time.
+   */
+  class BatchSolver
+  {
+    public:
+      using Result = pair<SolutionType, optional<LinearProgramSolution<T>>>;
+
+
+      explicit BatchSolver(
+        size_t threadsCount = 0,
+        const shared_ptr<SolutionCache<T>>& solutionCache = nullptr,
+        const shared_ptr<BasisCache>& basisCache = nullptr
+      );
+
+      size_t threadsCount() const;
+
+      vector<Result> solve(
+        const LinearProgramData<T>* first, const LinearProgramData<T>* last
+      );
+
+      vector<Result> solve(
+        const vector<LinearProgramData<T>>& linearProgramsData
+      );
+
+
+    private:
+      ThreadPool threadPool_;
+
+      vector<SimplexSolver<T>> solvers_;
+
+      shared_ptr<SolutionCache<T>> solutionCache_;
+  };
+}
+
+
+#include "batchsolver.txx"
+
+
+#endif // BATCHSOLVER_HXX
@@ -0,0 +1,128 @@
+﻿#pragma once
+
+#ifndef BATCHSOLVER_TXX
+#define BATCHSOLVER_TXX
+
+
+#include "batchsolver.hxx"
+
+#include <cstddef>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+
+#include "basiscache.hxx"
+#include "linearprogramdata.hxx"
+#include "linearprogramsolution.hxx"
+#include "simplexsolver.hxx"
+#include "solutioncache.hxx"
+#include "solutiontype.hxx"
+#include "../misc/eigenextensions.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using std::make_pair;
+  using std::shared_ptr;
+  using std::size_t;
+  using std::vector;
+
+
+  template<typename T>
+  /**
+   * @brief BatchSolver<T>::BatchSolver
+   * @param threadsCount Workers count, `0' stands for the number
+   * of the hardware threads.
+   * @param solutionCache (optional) Cache to look the solutions up in.
+   * @param basisCache (optional) Cache of the optimal bases shared
+   * by all the workers.
+   */
+  BatchSolver<T>::BatchSolver(
+    size_t threadsCount, const shared_ptr<SolutionCache<T>>& solutionCache,
+    const shared_ptr<BasisCache>& basisCache
+  ) :
+    threadPool_(threadsCount),
+    solvers_(threadPool_.threadsCount()),
+    solutionCache_(solutionCache)
+  {
+    for (SimplexSolver<T>& solver : solvers_)
+    {
+      solver.setBasisCache(basisCache);
+    }
+  }
+
+
+  template<typename T>
+  size_t
+  BatchSolver<T>::threadsCount() const
+  {
+    return threadPool_.threadsCount();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BatchSolver<T>::solve
+   * Solves the programs [first; last).
+   * @param first
+   * @param last
+   * @return Results in the order of the programs.
+   */
+  vector<typename BatchSolver<T>::Result>
+  BatchSolver<T>::solve(
+    const LinearProgramData<T>* first, const LinearProgramData<T>* last
+  )
+  {
+    const size_t count(last - first);
+
+    vector<Result> ret(
+      count,
+      make_pair(SolutionType::Unknown, optional<LinearProgramSolution<T>>())
+    );
+
+    threadPool_.run(
+      count,
+      [&](size_t workerIdx, size_t idx)
+      {
+        SimplexSolver<T>& solver(solvers_[workerIdx]);
+
+        solver.setLinearProgramData(first[idx]);
+        ret[idx] =
+          solutionCache_ ? solutionCache_->solve(solver) : solver.solve();
+      }
+    );
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BatchSolver<T>::solve
+   * @param linearProgramsData
+   * @return Results in the order of the programs.
+   */
+  vector<typename BatchSolver<T>::Result>
+  BatchSolver<T>::solve(const vector<LinearProgramData<T>>& linearProgramsData)
+  {
+    return
+      solve(
+        linearProgramsData.data(),
+        linearProgramsData.data() + linearProgramsData.size()
+      );
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `batchsolver.cxx'
+  extern template class BatchSolver<NumericTypes::real_t>;
+  extern template class BatchSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // BATCHSOLVER_TXX
@@ -0,0 +1,12 @@
+﻿#include "boundedprogramdata.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template struct BoundedProgramData<NumericTypes::real_t>;
+  template struct BoundedProgramData<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
@@ -0,0 +1,86 @@
+﻿#pragma once
+
+#ifndef BOUNDEDPROGRAMDATA_HXX
+#define BOUNDEDPROGRAMDATA_HXX
+
+
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "columnmapping.hxx"
+#include "linearprogramdata.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::real_t;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The BoundedProgramData struct
+   * The standard form of `GeneralProgramData<T>' w/ the implicit slack
+   * variables and the upper bounds:
+   *   min (c, x), αx + σs == β, 0 <= x <= u, 0 <= s <= v,
+   * where `σ' is the diagonal matrix w/ `σ[i]' of 1, -1 or 0 (the row
+   * has no slack variable `s[i]'). Neither the slack columns nor the rows
+   * of the bounds are stored.
+   */
+  struct BoundedProgramData
+  {
+    DenseIndex constraintsCount() const;
+
+    DenseIndex variablesCount() const;
+
+    Matrix<T, Dynamic, 1> originalPoint(const Matrix<T, Dynamic, 1>& x) const;
+
+    T originalValue(const T& value) const;
+
+
+    /**
+     * @brief linearProgramData
+     * The objective function coefficients `c', the constraints
+     * coefficients `α' and the RHS `β' (of the variables `x' only).
+     */
+    LinearProgramData<T> linearProgramData;
+
+    /**
+     * @brief slackCoeffs
+     * Coefficients `σ[i]' of the slack variables `s[i]'.
+     */
+    Matrix<T, Dynamic, 1> slackCoeffs;
+
+    /**
+     * @brief upperBounds
+     * Upper bounds `u' of `x' followed by `v' of `s' (N + M),
+     * `none' for (+∞).
+     */
+    vector<optional<T>> upperBounds;
+
+    /**
+     * @brief columnMappings
+     * Expresses the variables of the general form through `x'.
+     */
+    vector<ColumnMapping<T>> columnMappings;
+
+    /**
+     * @brief objectiveOffset
+     * Constant term of the objective function in terms of `x'.
+     */
+    T objectiveOffset = T(0);
+  };
+}
+
+
+#include "boundedprogramdata.txx"
+
+
+#endif // BOUNDEDPROGRAMDATA_HXX
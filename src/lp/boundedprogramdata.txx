@@ -0,0 +1,92 @@
+﻿#pragma once
+
+#ifndef BOUNDEDPROGRAMDATA_TXX
+#define BOUNDEDPROGRAMDATA_TXX
+
+
+#include "boundedprogramdata.hxx"
+
+#include "eigen3/Eigen/Core"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+
+
+  template<typename T>
+  DenseIndex
+  BoundedProgramData<T>::constraintsCount() const
+  {
+    return linearProgramData.constraintsCount();
+  }
+
+
+  template<typename T>
+  DenseIndex
+  BoundedProgramData<T>::variablesCount() const
+  {
+    return linearProgramData.variablesCount();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedProgramData<T>::originalPoint
+   * Maps the point `x' of the standard form program
+   * to the values of the variables of the general form one.
+   * @param x
+   * @return
+   */
+  Matrix<T, Dynamic, 1>
+  BoundedProgramData<T>::originalPoint(const Matrix<T, Dynamic, 1>& x) const
+  {
+    Matrix<T, Dynamic, 1> ret(columnMappings.size(), 1);
+
+    for (DenseIndex j(0); j < ret.rows(); ++j)
+    {
+      const ColumnMapping<T>& mapping(columnMappings[j]);
+
+      ret(j) = mapping.offset;
+      if (mapping.positive >= 0)
+      {
+        ret(j) += x(mapping.positive);
+      }
+      if (mapping.negative >= 0)
+      {
+        ret(j) -= x(mapping.negative);
+      }
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedProgramData<T>::originalValue
+   * Maps the objective value of the standard form program
+   * to the value of the objective function of the general form one.
+   * @param value
+   * @return
+   */
+  T
+  BoundedProgramData<T>::originalValue(const T& value) const
+  {
+    return (value + objectiveOffset);
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `boundedprogramdata.cxx'
+  extern template struct BoundedProgramData<NumericTypes::real_t>;
+  extern template struct BoundedProgramData<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // BOUNDEDPROGRAMDATA_TXX
@@ -0,0 +1,12 @@
+﻿#include "boundedsimplexsolver.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class BoundedSimplexSolver<NumericTypes::real_t>;
+  template class BoundedSimplexSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
@@ -0,0 +1,119 @@
+﻿#pragma once
+
+#ifndef BOUNDEDSIMPLEXSOLVER_HXX
+#define BOUNDEDSIMPLEXSOLVER_HXX
+
+
+#include <cstdint>
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "boundedprogramdata.hxx"
+#include "cycledetector.hxx"
+#include "generalprogramdata.hxx"
+#include "isolver.hxx"
+#include "linearprogramsolution.hxx"
+#include "simplexstatistics.hxx"
+#include "simplextableau_fwd.hxx"
+#include "solutiontype.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::real_t;
+  using std::invalid_argument;
+  using std::pair;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  class BoundedSimplexSolver :
+    public ISolver<LinearProgramSolution<T>>
+  {
+    public:
+      BoundedSimplexSolver() = default;
+
+      explicit BoundedSimplexSolver(
+        const GeneralProgramData<T>& generalProgramData
+      ) throw(invalid_argument);
+
+      const BoundedProgramData<T>& boundedProgramData() const;
+
+      void setGeneralProgramData(
+        const GeneralProgramData<T>& generalProgramData
+      ) throw(invalid_argument);
+
+      const SimplexStatistics& statistics() const;
+
+      virtual pair<SolutionType, optional<LinearProgramSolution<T>>>
+      solve() override;
+
+      SolutionType solve(LinearProgramSolution<T>& linearProgramSolution);
+
+
+    private:
+      BoundedProgramData<T> boundedProgramData_;
+
+      /**
+       * @brief isFlipped_
+       * Marks the variables that are replaced w/ (u[j] - x[j])
+       * in the tableau, i.e. the free ones of them are at the upper bound.
+       */
+      vector<bool> isFlipped_;
+
+      CycleDetector cycleDetector_;
+
+      SimplexStatistics statistics_;
+
+      uint32_t iterCount_ = 0;
+
+
+      void reset();
+
+      optional<T> upperBound(DenseIndex varIdx) const;
+
+      SolutionType optimize(SimplexTableau<T>& tableau);
+
+      SolutionType iterate(SimplexTableau<T>& tableau);
+
+      optional<DenseIndex> computePivotColIdx(
+        const SimplexTableau<T>& tableau
+      ) const;
+
+      pair<SolutionType, optional<DenseIndex>> computePivotRowIdx(
+        const SimplexTableau<T>& tableau, DenseIndex pivotColIdx
+      ) const;
+
+      void flipColumn(SimplexTableau<T>& tableau, DenseIndex colIdx);
+
+      void flipRow(SimplexTableau<T>& tableau, DenseIndex rowIdx);
+
+      void transformTableau(
+        SimplexTableau<T>& tableau, DenseIndex rowIdx, DenseIndex colIdx
+      );
+
+      SolutionType checkPhase1Solution(const SimplexTableau<T>& tableau) const;
+
+      SolutionType checkPhase2Solution(const SimplexTableau<T>& tableau) const;
+
+      void extremePoint(
+        const SimplexTableau<T>& tableau, Matrix<T, Dynamic, 1>& extremePoint
+      ) const;
+  };
+}
+
+
+#include "boundedsimplexsolver.txx"
+
+
+#endif // BOUNDEDSIMPLEXSOLVER_HXX
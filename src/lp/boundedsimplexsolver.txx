@@ -0,0 +1,735 @@
+﻿#pragma once
+
+#ifndef BOUNDEDSIMPLEXSOLVER_TXX
+#define BOUNDEDSIMPLEXSOLVER_TXX
+
+
+#include "boundedsimplexsolver.hxx"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "boundedprogramdata.hxx"
+#include "generalprogramdata.hxx"
+#include "linearprogramdata.hxx"
+#include "linearprogramsolution.hxx"
+#include "simplextableau.hxx"
+#include "solutiontype.hxx"
+#include "../math/mathutils.hxx"
+#include "../misc/eigenextensions.hxx"
+#include "../misc/utils.hxx"
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using namespace Config::LinearProgramming;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using MathUtils::isEqual;
+  using MathUtils::isEqualToZero;
+  using MathUtils::isGreaterThan;
+  using MathUtils::isGreaterThanZero;
+  using MathUtils::isLessThan;
+  using MathUtils::isLessThanZero;
+  using std::invalid_argument;
+  using std::make_pair;
+  using std::pair;
+  using std::vector;
+  using Utils::makeString;
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::BoundedSimplexSolver
+   * Solves the programs in the general form (see `GeneralProgramData<T>')
+   * using the two-phase Simplex method w/ the bounded variables.
+   * Unlike `SimplexSolver<T>', neither the slack variables nor the bounds
+   * are the columns or rows of the tableau: the slacks are the initial
+   * basic variables (the artificial ones are only added for the rows
+   * the slacks can't cover), and the variable that reaches its upper bound
+   * is flipped to (u[j] - x[j]) instead of the pivot (see `flipColumn'),
+   * so the tableau is (M+1) × (N+K+1) rather than (M+B+1) × (N+M+B+1)
+   * of the dense standard form (`B' is the count of the bounds).
+   * For the reference see:
+   *   Chvátal V. Linear Programming, ch. 8
+   *   (The upper-bounding technique).
+   * @param generalProgramData
+   */
+  BoundedSimplexSolver<T>::BoundedSimplexSolver(
+    const GeneralProgramData<T>& generalProgramData
+  ) throw(invalid_argument) :
+    boundedProgramData_(generalProgramData.standardForm())
+  { }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::boundedProgramData
+   * Provides read-only access to the standard form of the program.
+   * @return
+   */
+  const BoundedProgramData<T>&
+  BoundedSimplexSolver<T>::boundedProgramData() const
+  {
+    return boundedProgramData_;
+  }
+
+
+  template<typename T>
+  void
+  BoundedSimplexSolver<T>::setGeneralProgramData(
+    const GeneralProgramData<T>& generalProgramData
+  ) throw(invalid_argument)
+  {
+    boundedProgramData_ = generalProgramData.standardForm();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::statistics
+   * @return Counters of the last solve.
+   */
+  const SimplexStatistics&
+  BoundedSimplexSolver<T>::statistics() const
+  {
+    return statistics_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::solve
+   * @return `LinearProgramSolution' instance w/ the values `x*'
+   * of the variables of the general form program and the extreme
+   * (minimal) value `F*' of its objective function.
+   */
+  pair<SolutionType, optional<LinearProgramSolution<T>>>
+  BoundedSimplexSolver<T>::solve()
+  {
+    //For result
+    optional<LinearProgramSolution<T>> ret;
+
+    LinearProgramSolution<T> linearProgramSolution;
+    const SolutionType solutionType(solve(linearProgramSolution));
+
+    if (solutionType == SolutionType::Optimal)
+    {
+      ret = std::move(linearProgramSolution);
+    }
+
+    return make_pair(solutionType, std::move(ret));
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::solve
+   * Solves the program (see above).
+   * @param linearProgramSolution Solution to store the extreme point `x*'
+   * and the extreme value `F*' to, it is left unchanged unless
+   * the solution is optimal.
+   * @return
+   */
+  SolutionType
+  BoundedSimplexSolver<T>::solve(
+    LinearProgramSolution<T>& linearProgramSolution
+  )
+  {
+    //Reset internal state
+    reset();
+    statistics_ = SimplexStatistics();
+
+    const LinearProgramData<T>& linearProgramData(
+      boundedProgramData_.linearProgramData
+    );
+    const DenseIndex rowsCount(linearProgramData.constraintsCount());
+    const DenseIndex varsCount(linearProgramData.variablesCount());
+
+    LOG(
+      "c == \n{0},\nA ==\n{1},\nb ==\n{2},\nσ ==\n{3}",
+      linearProgramData.objectiveFunctionCoeffs,
+      linearProgramData.constraintsCoeffs,
+      linearProgramData.constraintsRHS,
+      boundedProgramData_.slackCoeffs
+    );
+
+    //`x', `s' and the artificial variables, none of them is flipped
+    isFlipped_.assign(varsCount + rowsCount * 2, false);
+
+    //Make a new Phase-1 tableau
+    SimplexTableau<T> tableau(
+      SimplexTableau<T>::makePhaseOne(boundedProgramData_)
+    );
+
+    LOG(
+      "~X({0}) ==\n{1},\n~x == {2},\n x == {3}",
+      iterCount_,
+      tableau.entries(),
+      makeString(tableau.basicVars()),
+      makeString(tableau.freeVars())
+    );
+
+    //Solve Phase-1 unless the slacks cover all the rows
+    if (
+      std::any_of(
+        tableau.basicVars().cbegin(), tableau.basicVars().cend(),
+        [&] (DenseIndex varIdx) { return (varIdx >= varsCount + rowsCount); }
+      )
+    )
+    {
+      SolutionType phase1SolutionType(optimize(tableau));
+
+      //NOTE: The Phase-1 program is bounded (~F >= 0), so it can only be
+      //"unbounded" due to the rounding errors (e.g. P[s] == -1E-9)
+      if (phase1SolutionType == SolutionType::Unbounded)
+      {
+        return SolutionType::Unknown;
+      }
+
+      if (phase1SolutionType == SolutionType::Optimal)
+      {
+        //Recheck Phase-1 solution (~F* == 0)
+        phase1SolutionType = checkPhase1Solution(tableau);
+      }
+
+      if (phase1SolutionType != SolutionType::Optimal)
+      {
+        return phase1SolutionType;
+      }
+    }
+
+    //The objective function of the tableau variables: (c[j] * x[j]) of
+    //the flipped ones is (c[j] * u[j] - c[j] * (u[j] - x[j]))
+    Matrix<T, 1, Dynamic> objFuncCoeffs(
+      Matrix<T, 1, Dynamic>::Zero(1, varsCount + rowsCount)
+    );
+    objFuncCoeffs.head(varsCount) = linearProgramData.objectiveFunctionCoeffs;
+
+    T flippedValue(0);
+    for (DenseIndex j(0); j < varsCount; ++j)
+    {
+      if (isFlipped_[j])
+      {
+        flippedValue += objFuncCoeffs(j) * *upperBound(j);
+        objFuncCoeffs(j) *= T(-1);
+      }
+    }
+
+    SimplexTableau<T>::transformToPhaseTwo(objFuncCoeffs, tableau);
+    tableau(tableau.rows() - 1, tableau.cols() - 1) -= flippedValue;
+
+    LOG(
+      "X({0}) ==\n{1},\n~x == {2},\n x == {3}",
+      iterCount_,
+      tableau.entries(),
+      makeString(tableau.basicVars()),
+      makeString(tableau.freeVars())
+    );
+
+    //Solve Phase-2: do `iterate()' while the solution is not optimal
+    SolutionType phase2SolutionType(optimize(tableau));
+
+    LOG(
+      "X({0}) ==\n{1},\n~x == {2},\n x == {3}",
+      iterCount_,
+      tableau.entries(),
+      makeString(tableau.basicVars()),
+      makeString(tableau.freeVars())
+    );
+
+    if (phase2SolutionType == SolutionType::Optimal)
+    {
+      //Recheck Phase-2 solution (0 <= x* <= u)
+      phase2SolutionType = checkPhase2Solution(tableau);
+
+      if (phase2SolutionType == SolutionType::Optimal)
+      {
+        Matrix<T, Dynamic, 1> extremePoint;
+        this->extremePoint(tableau, extremePoint);
+
+        linearProgramSolution.extremePoint =
+          boundedProgramData_.originalPoint(extremePoint);
+        linearProgramSolution.extremeValue =
+          boundedProgramData_.originalValue(tableau.extremeValue());
+
+        LOG(
+          "x* == {0},\nF* == {1}",
+          linearProgramSolution.extremePoint,
+          linearProgramSolution.extremeValue
+        );
+      }
+    }
+
+    return phase2SolutionType;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::reset
+   * Resets the internal state of the object.
+   */
+  void
+  BoundedSimplexSolver<T>::reset()
+  {
+    iterCount_ = 0;
+    cycleDetector_.reset();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::upperBound
+   * @param varIdx
+   * @return (optional) The upper bound of the variable, `none' for (+∞)
+   * (the artificial variables are not bounded).
+   */
+  optional<T>
+  BoundedSimplexSolver<T>::upperBound(DenseIndex varIdx) const
+  {
+    if (varIdx < DenseIndex(boundedProgramData_.upperBounds.size()))
+    {
+      return boundedProgramData_.upperBounds[varIdx];
+    }
+    else
+    {
+      return optional<T>();
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::optimize
+   * Performs the Simplex algorithm steps on the given tableau.
+   * @param tableau
+   * @return
+   */
+  SolutionType
+  BoundedSimplexSolver<T>::optimize(SimplexTableau<T>& tableau)
+  {
+    //Start w/ the fast pivot rule from the basis of the given tableau
+    cycleDetector_.reset();
+
+    SolutionType solutionType(SolutionType::Incomplete);
+    while (solutionType == SolutionType::Incomplete)
+    {
+      solutionType = iterate(tableau);
+    }
+
+    return solutionType;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::iterate
+   * Tries to execute one iteration (either the pivot or the bound flip)
+   * of the Simplex method on the given tableau.
+   * @param tableau
+   * @return
+   */
+  SolutionType
+  BoundedSimplexSolver<T>::iterate(SimplexTableau<T>& tableau)
+  {
+    if (iterCount_ >= MaxSimplexIterations)
+    {
+      return SolutionType::Unknown;
+    }
+
+    //If (∀j: P[j] >= 0), the solution is optimal
+    const optional<DenseIndex> pivotColIdx(computePivotColIdx(tableau));
+    if (!pivotColIdx)
+    {
+      return SolutionType::Optimal;
+    }
+
+    const pair<SolutionType, optional<DenseIndex>> pivotRowIdx(
+      computePivotRowIdx(tableau, *pivotColIdx)
+    );
+    if (pivotRowIdx.first != SolutionType::Incomplete)
+    {
+      return pivotRowIdx.first;
+    }
+
+    ++iterCount_;
+
+    if (pivotRowIdx.second)
+    {
+      transformTableau(tableau, *pivotRowIdx.second, *pivotColIdx);
+    }
+    else
+    {
+      flipColumn(tableau, *pivotColIdx);
+    }
+
+    return SolutionType::Incomplete;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::computePivotColIdx
+   * Computes the entering variable column `s' by Dantzig's rule
+   * or by Bland's one while the cycling is suspected
+   * (see `SimplexSolver<T>::computePivotColIdx').
+   * @param tableau
+   * @return (optional)
+   */
+  optional<DenseIndex>
+  BoundedSimplexSolver<T>::computePivotColIdx(
+    const SimplexTableau<T>& tableau
+  ) const
+  {
+    optional<DenseIndex> ret;
+
+#ifdef LP_WITH_BLAND_RULE
+    const bool isBlandRule(cycleDetector_.isAntiCycling());
+#else // LP_WITH_BLAND_RULE
+    const bool isBlandRule(false);
+#endif // LP_WITH_BLAND_RULE
+
+    T minCoeff(0);
+    DenseIndex minVarIdx(0);
+
+    for (DenseIndex colIdx(0); colIdx < tableau.cols() - 1; ++colIdx)
+    {
+      const T& currCoeff(tableau(tableau.rows() - 1, colIdx));
+
+      //Pick only negative `P[j]'
+      if (!isLessThanZero<T>(currCoeff))
+      {
+        continue;
+      }
+
+      const DenseIndex currVarIdx(tableau.freeVars()[colIdx]);
+
+      if (
+        !ret ||
+        (isBlandRule ? currVarIdx < minVarIdx : currCoeff < minCoeff)
+      )
+      {
+        ret = colIdx;
+        minCoeff = currCoeff;
+        minVarIdx = currVarIdx;
+      }
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::computePivotRowIdx
+   * Computes the pivot row index `k' for the pivot column index `s'
+   * by the ratio test of the bounded variables: the entering variable
+   * grows until either
+   *   the basic variable w/ (α[k, s] > 0) drops to 0 (β[k] / α[k, s]),
+   *   the basic variable w/ (α[k, s] < 0) reaches its upper bound
+   * ((u[k] - β[k]) / -α[k, s]),
+   *   or the entering variable reaches its own upper bound `u[s]'.
+   * The ties are resolved in favor of the last case (it takes no pivot),
+   * then as in `SimplexSolver<T>::computePivotRowIdx'.
+   * @param tableau
+   * @param pivotColIdx
+   * @return `SolutionType::Unbounded' if the entering variable can grow
+   * infinitely, `SolutionType::Incomplete' and (optional) `k' otherwise
+   * (`none' for the bound flip).
+   */
+  pair<SolutionType, optional<DenseIndex>>
+  BoundedSimplexSolver<T>::computePivotRowIdx(
+    const SimplexTableau<T>& tableau, DenseIndex pivotColIdx
+  ) const
+  {
+#ifdef LP_WITH_BLAND_RULE
+    const bool isBlandRule(cycleDetector_.isAntiCycling());
+#else // LP_WITH_BLAND_RULE
+    const bool isBlandRule(false);
+#endif // LP_WITH_BLAND_RULE
+
+    const DenseIndex rhsColIdx(tableau.cols() - 1);
+
+    optional<DenseIndex> minRatioRowIdx;
+    DenseIndex minRatioVarIdx(0);
+
+    //The entering variable bound is the first candidate
+    optional<T> minRatio(upperBound(tableau.freeVars()[pivotColIdx]));
+
+    for (DenseIndex rowIdx(0); rowIdx < tableau.rows() - 1; ++rowIdx)
+    {
+      const T& coeff(tableau(rowIdx, pivotColIdx));
+      const DenseIndex currVarIdx(tableau.basicVars()[rowIdx]);
+
+      T currRatio(0);
+      if (isGreaterThanZero<T>(coeff))
+      {
+        currRatio = tableau(rowIdx, rhsColIdx) / coeff; //!
+      }
+      else
+      {
+        const optional<T> bound(upperBound(currVarIdx));
+
+        if (!isLessThanZero<T>(coeff) || !bound)
+        {
+          continue;
+        }
+
+        currRatio = (*bound - tableau(rowIdx, rhsColIdx)) / (coeff * T(-1));
+      }
+
+      if (!minRatio || isLessThan<T>(currRatio, *minRatio))
+      {
+        minRatio = currRatio;
+        minRatioRowIdx = rowIdx;
+        minRatioVarIdx = currVarIdx;
+      }
+      else
+      {
+        if (
+          isBlandRule && minRatioRowIdx && currVarIdx < minRatioVarIdx &&
+          isEqual<T>(currRatio, *minRatio)
+        )
+        {
+          minRatioRowIdx = rowIdx;
+          minRatioVarIdx = currVarIdx;
+        }
+      }
+    }
+
+    if (!minRatio)
+    {
+      //If (α[i, s] <= 0) for the rows of (+∞) bounds and (u[s] == +∞),
+      //the objective function is unbounded over the feasible region
+      return make_pair(SolutionType::Unbounded, minRatioRowIdx);
+    }
+
+    return make_pair(SolutionType::Incomplete, minRatioRowIdx);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::flipColumn
+   * Moves the free variable `x[s]' to its other bound, i.e. replaces it
+   * w/ (u[s] - x[s]):
+   *   (β[i] -= u[s] * α[i, s]) for all the rows (including `P'),
+   *   (α[i, s] *= -1).
+   * The basis is left as is.
+   * @param tableau
+   * @param colIdx
+   */
+  void
+  BoundedSimplexSolver<T>::flipColumn(
+    SimplexTableau<T>& tableau, DenseIndex colIdx
+  )
+  {
+    const DenseIndex varIdx(tableau.freeVars()[colIdx]);
+    const T bound(*upperBound(varIdx));
+
+    LOG(
+      "colIdx == {0}, flip x{1} to (u - x{1}), u == {2}",
+      colIdx, varIdx, bound
+    );
+
+    tableau.col(tableau.cols() - 1) -= tableau.col(colIdx) * bound;
+    tableau.col(colIdx) *= T(-1);
+    isFlipped_[varIdx] = !isFlipped_[varIdx];
+
+    ++statistics_.boundFlipsCount;
+
+    //The objective function value has changed (u[s] > 0),
+    //so none of the previous bases can repeat
+    cycleDetector_.reset();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::flipRow
+   * Replaces the basic variable `~x[k]' w/ (u[k] - ~x[k]), so it leaves
+   * the basis at its upper bound by the ordinary pivot:
+   *   (α[k, j] *= -1) for all `j', (β[k] = u[k] - β[k]).
+   * @param tableau
+   * @param rowIdx
+   */
+  void
+  BoundedSimplexSolver<T>::flipRow(
+    SimplexTableau<T>& tableau, DenseIndex rowIdx
+  )
+  {
+    const DenseIndex varIdx(tableau.basicVars()[rowIdx]);
+    const DenseIndex rhsColIdx(tableau.cols() - 1);
+
+    tableau.row(rowIdx).head(rhsColIdx) *= T(-1);
+    tableau(rowIdx, rhsColIdx) =
+      *upperBound(varIdx) - tableau(rowIdx, rhsColIdx);
+    isFlipped_[varIdx] = !isFlipped_[varIdx];
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::transformTableau
+   * Performs the pivot ~x[k] ↔ x[s], the leaving variable is flipped
+   * first if it leaves the basis at its upper bound (α[k, s] < 0).
+   * @param tableau
+   * @param rowIdx
+   * @param colIdx
+   */
+  void
+  BoundedSimplexSolver<T>::transformTableau(
+    SimplexTableau<T>& tableau, DenseIndex rowIdx, DenseIndex colIdx
+  )
+  {
+    if (tableau(rowIdx, colIdx) < T(0))
+    {
+      flipRow(tableau, rowIdx);
+    }
+
+    LOG(
+      "pivotElement == {2}, rowIdx == {0}, colIdx == {1}, swap ~x{3} <> x{4}",
+      rowIdx, colIdx, tableau(rowIdx, colIdx),
+      tableau.basicVars()[rowIdx], tableau.freeVars()[colIdx]
+    );
+
+    const bool isDegenerate(
+      isEqualToZero<T>(tableau(rowIdx, tableau.cols() - 1))
+    );
+
+    ++statistics_.pivotsCount;
+    if (isDegenerate)
+    {
+      ++statistics_.degeneratePivotsCount;
+    }
+
+    //Watch the bases for cycling (see `computePivotColIdx')
+    cycleDetector_.update(
+      tableau.basicVars()[rowIdx], tableau.freeVars()[colIdx], isDegenerate
+    );
+
+    //See `SimplexTableau<T>::pivot'
+    tableau.pivot(rowIdx, colIdx);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::checkPhase1Solution
+   * Checks if the solution obtained at the Phase-1 is valid.
+   * @param tableau
+   * @return
+   */
+  SolutionType
+  BoundedSimplexSolver<T>::checkPhase1Solution(
+    const SimplexTableau<T>& tableau
+  ) const
+  {
+    const T objFuncValue(tableau.extremeValue());
+
+    //If (~F* == 0) -- The end of the Phase-1
+    if (isEqualToZero<T>(objFuncValue))
+    {
+      return SolutionType::Optimal;
+    }
+
+    //If (~F* > 0) -- Inconsistent (infeasible) program
+    if (isGreaterThanZero<T>(objFuncValue))
+    {
+      return SolutionType::Infeasible;
+    }
+
+    return SolutionType::Unknown;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::checkPhase2Solution
+   * Checks if the basic variables are within their bounds (0 <= β <= u),
+   * the rounding errors (e.g. -1E-16) are tolerated.
+   * NOTE: The ratio test keeps the basis feasible, so the solution can
+   * only be infeasible due to the rounding errors, it is not solved then.
+   * @param tableau
+   * @return
+   */
+  SolutionType
+  BoundedSimplexSolver<T>::checkPhase2Solution(
+    const SimplexTableau<T>& tableau
+  ) const
+  {
+    for (DenseIndex i(0); i < tableau.rows() - 1; ++i)
+    {
+      const T& value(tableau(i, tableau.cols() - 1));
+      const optional<T> bound(upperBound(tableau.basicVars()[i]));
+
+      if (
+        isLessThanZero<T>(value) || (bound && isGreaterThan<T>(value, *bound))
+      )
+      {
+        return SolutionType::Unknown;
+      }
+    }
+
+    return SolutionType::Optimal;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief BoundedSimplexSolver<T>::extremePoint
+   * Stores the values of `x' and `s' of the given tableau (the basic
+   * variables are `β', the free ones are at their bounds) to `extremePoint'.
+   * @param tableau
+   * @param extremePoint
+   */
+  void
+  BoundedSimplexSolver<T>::extremePoint(
+    const SimplexTableau<T>& tableau, Matrix<T, Dynamic, 1>& extremePoint
+  ) const
+  {
+    const DenseIndex varsCount(boundedProgramData_.upperBounds.size());
+
+    extremePoint.setZero(varsCount);
+
+    for (DenseIndex i(0); i < tableau.rows() - 1; ++i)
+    {
+      const DenseIndex varIdx(tableau.basicVars()[i]);
+      const T& value(tableau(i, tableau.cols() - 1));
+
+      if (varIdx < varsCount)
+      {
+        extremePoint(varIdx) = (
+          value < T(0) && !isLessThanZero<T>(value) ? T(0) : value
+        );
+      }
+    }
+
+    for (DenseIndex j(0); j < varsCount; ++j)
+    {
+      if (isFlipped_[j])
+      {
+        extremePoint(j) = *upperBound(j) - extremePoint(j);
+      }
+    }
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `boundedsimplexsolver.cxx'
+  extern template class BoundedSimplexSolver<NumericTypes::real_t>;
+  extern template class BoundedSimplexSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // BOUNDEDSIMPLEXSOLVER_TXX
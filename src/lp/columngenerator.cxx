@@ -0,0 +1,12 @@
+﻿#include "columngenerator.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class ColumnGenerator<NumericTypes::real_t>;
+  template class ColumnGenerator<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
@@ -0,0 +1,151 @@
+﻿#pragma once
+
+#ifndef COLUMNGENERATOR_HXX
+#define COLUMNGENERATOR_HXX
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "linearprogramsolution.hxx"
+#include "simplexsolver.hxx"
+#include "simplexstatistics.hxx"
+#include "solutiontype.hxx"
+#include "../math/numerictypes.hxx"
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::real_t;
+  using std::function;
+  using std::invalid_argument;
+  using std::size_t;
+  using std::uint32_t;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The ColumnGenerator class
+   * Solves the program w/ too many variables to enumerate: the restricted
+   * master program (w/ some of the columns) is solved, its dual prices
+   * `y' are passed to the pricing, and the columns of the negative
+   * reduced cost it finds are added to the optimal tableau of the master
+   * (see `SimplexSolver<T>::addVariable') until there are none.
+   * The generated columns that stay free for `maxIdleRounds()' rounds
+   * in a row are removed from the master, so it stays small.
+   * NOTE: The master must be feasible, e.g. w/ the artificial columns
+   * of the large costs.
+   */
+  class ColumnGenerator
+  {
+    public:
+      /**
+       * @brief The Column struct
+       * Column `α[., j]' of the new variable w/ its `c[j]'.
+       */
+      struct Column
+      {
+        Matrix<T, Dynamic, 1> coeffs;
+
+        T objectiveFunctionCoeff;
+      };
+
+      /**
+       * @brief Pricing
+       * Called w/ the dual prices `y' of the rows of the master, returns
+       * the columns of (c[j] - (y, α[., j]) < 0) it has found (none if
+       * there are no such columns).
+       */
+      using Pricing = function<vector<Column>(const Matrix<T, Dynamic, 1>&)>;
+
+
+      ColumnGenerator(
+        const LinearProgramData<T>& linearProgramData, const Pricing& pricing
+      );
+
+      const LinearProgramData<T>& linearProgramData() const;
+
+      const vector<size_t>& columnIds() const;
+
+      uint32_t maxIdleRounds() const;
+
+      void setMaxIdleRounds(uint32_t maxIdleRounds);
+
+      uint32_t roundsCount() const;
+
+      const SimplexStatistics& statistics() const;
+
+      SolutionType solve(
+        LinearProgramSolution<T>& linearProgramSolution
+      ) throw(invalid_argument);
+
+
+    private:
+      /**
+       * @brief simplexSolver_
+       * Solves the master, its program is the current master.
+       */
+      SimplexSolver<T> simplexSolver_;
+
+      Pricing pricing_;
+
+      uint32_t maxIdleRounds_ =
+        Config::LinearProgramming::ColumnIdleRoundsLimit;
+
+      uint32_t roundsCount_ = 0;
+
+      SimplexStatistics statistics_;
+
+      /**
+       * @brief columnIds_
+       * Maps the columns of the master to the columns of the program:
+       * the given ones are [0; N), the added ones are numbered on.
+       * Only the added ones are ever removed, as the pricing may not
+       * give back the given ones (e.g. the slack or the artificial
+       * columns), w/o them the master could lose its optimum.
+       */
+      vector<size_t> columnIds_;
+
+      /**
+       * @brief givenColumnsCount_
+       * `N', the ids of the given columns are less than it.
+       */
+      size_t givenColumnsCount_;
+
+      size_t nextColumnId_;
+
+      /**
+       * @brief idleRounds_
+       * Count of the rounds each column of the master stayed free.
+       */
+      vector<uint32_t> idleRounds_;
+
+
+      bool computeDualPrices(Matrix<T, Dynamic, 1>& dualPrices);
+
+      void updateIdleRounds();
+
+      SolutionType removeIdleColumns(
+        LinearProgramSolution<T>& linearProgramSolution
+      );
+
+      void addStatistics();
+  };
+}
+
+
+#include "columngenerator.txx"
+
+
+#endif // COLUMNGENERATOR_HXX
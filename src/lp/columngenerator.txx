@@ -0,0 +1,385 @@
+﻿#pragma once
+
+#ifndef COLUMNGENERATOR_TXX
+#define COLUMNGENERATOR_TXX
+
+
+#include "columngenerator.hxx"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <stdexcept>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "linearprogramsolution.hxx"
+#include "sensitivityanalysis.hxx"
+#include "simplexsolver.hxx"
+#include "simplexstatistics.hxx"
+#include "simplextableau.hxx"
+#include "solutiontype.hxx"
+#include "../math/mathutils.hxx"
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using namespace Config::LinearProgramming;
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using MathUtils::isLessThanZero;
+  using std::invalid_argument;
+  using std::size_t;
+  using std::uint32_t;
+  using std::vector;
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::ColumnGenerator
+   * @param linearProgramData The restricted master program.
+   * @param pricing
+   */
+  ColumnGenerator<T>::ColumnGenerator(
+    const LinearProgramData<T>& linearProgramData, const Pricing& pricing
+  ) :
+    simplexSolver_(linearProgramData),
+    pricing_(pricing),
+    columnIds_(size_t(linearProgramData.variablesCount())),
+    givenColumnsCount_(columnIds_.size()),
+    nextColumnId_(givenColumnsCount_)
+  {
+    for (size_t j(0); j < columnIds_.size(); ++j)
+    {
+      columnIds_[j] = j;
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::linearProgramData
+   * @return The current master program.
+   */
+  const LinearProgramData<T>&
+  ColumnGenerator<T>::linearProgramData() const
+  {
+    return simplexSolver_.linearProgramData();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::columnIds
+   * @return Ids of the columns of the current master (see `columnIds_').
+   */
+  const vector<size_t>&
+  ColumnGenerator<T>::columnIds() const
+  {
+    return columnIds_;
+  }
+
+
+  template<typename T>
+  uint32_t
+  ColumnGenerator<T>::maxIdleRounds() const
+  {
+    return maxIdleRounds_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::setMaxIdleRounds
+   * @param maxIdleRounds Count of the rounds the added column may stay
+   * free before it is removed from the master.
+   */
+  void
+  ColumnGenerator<T>::setMaxIdleRounds(uint32_t maxIdleRounds)
+  {
+    maxIdleRounds_ = maxIdleRounds;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::roundsCount
+   * @return Count of the pricing rounds of the last solve.
+   */
+  uint32_t
+  ColumnGenerator<T>::roundsCount() const
+  {
+    return roundsCount_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::statistics
+   * @return Statistics of all the solves of the master in the last solve.
+   */
+  const SimplexStatistics&
+  ColumnGenerator<T>::statistics() const
+  {
+    return statistics_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::solve
+   * Solves the master, then, while the pricing finds the columns, adds
+   * them to the optimal tableau and reoptimizes it by the primal Simplex
+   * method (see `SimplexSolver<T>::addVariable'). The columns of
+   * (c[j] - (y, α[., j]) >= 0) are ignored, so it stops once the pricing
+   * finds no improving columns. Each round the added columns free for
+   * more than `maxIdleRounds()' rounds are removed.
+   * The master is kept, so the next solve starts from its columns.
+   * @param linearProgramSolution Solution to store the optimum
+   * of the master to (see `SimplexSolver<T>::solve').
+   * @return `Unknown' if the rounds limit is reached, the type
+   * of the solution of the master otherwise.
+   */
+  SolutionType
+  ColumnGenerator<T>::solve(
+    LinearProgramSolution<T>& linearProgramSolution
+  ) throw(invalid_argument)
+  {
+    const DenseIndex rowsCount(
+      simplexSolver_.linearProgramData().constraintsCount()
+    );
+
+    roundsCount_ = 0;
+    statistics_ = SimplexStatistics();
+
+    idleRounds_.assign(columnIds_.size(), 0);
+
+    SolutionType solutionType(simplexSolver_.solve(linearProgramSolution));
+    addStatistics();
+
+    Matrix<T, Dynamic, 1> dualPrices;
+
+    while (solutionType == SolutionType::Optimal)
+    {
+      if (roundsCount_ >= MaxColumnGenerationRounds)
+      {
+        return SolutionType::Unknown;
+      }
+      ++roundsCount_;
+
+      updateIdleRounds();
+
+      solutionType = removeIdleColumns(linearProgramSolution);
+      if (solutionType != SolutionType::Optimal)
+      {
+        break;
+      }
+
+      if (!computeDualPrices(dualPrices))
+      {
+        return SolutionType::Unknown;
+      }
+
+      bool isColumnAdded(false);
+      for (const Column& column : pricing_(dualPrices))
+      {
+        if (column.coeffs.rows() != rowsCount)
+        {
+          throw invalid_argument("The column doesn't fit the master");
+        }
+
+        //The master is optimal, so it only takes the columns that may
+        //improve it (P[j] < 0)
+        if (
+          !isLessThanZero<T>(
+            column.objectiveFunctionCoeff -
+            (dualPrices.transpose() * column.coeffs)(0)
+          )
+        )
+        {
+          continue;
+        }
+
+        solutionType = simplexSolver_.addVariable(
+          column.coeffs, column.objectiveFunctionCoeff, linearProgramSolution
+        );
+        addStatistics();
+
+        columnIds_.push_back(nextColumnId_++);
+        idleRounds_.push_back(0);
+        isColumnAdded = true;
+
+        if (solutionType != SolutionType::Optimal)
+        {
+          break;
+        }
+
+        //The prices of the next columns are the new `y'
+        if (!computeDualPrices(dualPrices))
+        {
+          return SolutionType::Unknown;
+        }
+      }
+
+      if (!isColumnAdded)
+      {
+        break;
+      }
+    }
+
+    return solutionType;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::computeDualPrices
+   * Computes `y' of the optimal basis of the master: it is the last row
+   * of `B^-1' (if the master has no redundant constraints), or the shadow
+   * prices of the tableau otherwise.
+   * @param dualPrices
+   * @return `false' if there is no optimal tableau.
+   */
+  bool
+  ColumnGenerator<T>::computeDualPrices(Matrix<T, Dynamic, 1>& dualPrices)
+  {
+    const DenseIndex rowsCount(
+      simplexSolver_.linearProgramData().constraintsCount()
+    );
+
+    if (simplexSolver_.editableTableau() != nullptr)
+    {
+      dualPrices = -simplexSolver_.basisInverse_.row(rowsCount).transpose();
+
+      return true;
+    }
+
+    const SimplexTableau<T>* const tableau(
+      simplexSolver_.workspace_.tableau()
+    );
+    if (!simplexSolver_.isTableauOptimal_ || tableau == nullptr)
+    {
+      return false;
+    }
+
+    const optional<SensitivityAnalysis<T>> sensitivityAnalysis(
+      SensitivityAnalysis<T>::make(
+        simplexSolver_.linearProgramData(), *tableau
+      )
+    );
+    if (!sensitivityAnalysis)
+    {
+      return false;
+    }
+
+    dualPrices = sensitivityAnalysis->shadowPrices;
+
+    return true;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::updateIdleRounds
+   * Counts one more round for the free columns of the optimal tableau,
+   * and resets the counters of the basic ones.
+   */
+  void
+  ColumnGenerator<T>::updateIdleRounds()
+  {
+    const SimplexTableau<T>* const tableau(
+      simplexSolver_.workspace_.tableau()
+    );
+
+    for (uint32_t& idleRounds : idleRounds_)
+    {
+      ++idleRounds;
+    }
+
+    if (tableau != nullptr)
+    {
+      for (const DenseIndex varIdx : tableau->basicVars())
+      {
+        if (size_t(varIdx) < idleRounds_.size())
+        {
+          idleRounds_[size_t(varIdx)] = 0;
+        }
+      }
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::removeIdleColumns
+   * Removes the added columns free for more than `maxIdleRounds_' rounds
+   * from the master (see `columnIds_'). They are free, so the basis stays
+   * optimal (as long as there is the tableau, see
+   * `SimplexSolver<T>::removeVariable').
+   * @param linearProgramSolution
+   * @return
+   */
+  SolutionType
+  ColumnGenerator<T>::removeIdleColumns(
+    LinearProgramSolution<T>& linearProgramSolution
+  )
+  {
+    SolutionType solutionType(SolutionType::Optimal);
+
+    for (size_t j(idleRounds_.size()); j-- > 0; )
+    {
+      if (
+        columnIds_[j] < givenColumnsCount_ || idleRounds_[j] <= maxIdleRounds_
+      )
+      {
+        continue;
+      }
+
+      solutionType =
+        simplexSolver_.removeVariable(DenseIndex(j), linearProgramSolution);
+      addStatistics();
+
+      columnIds_.erase(columnIds_.begin() + j);
+      idleRounds_.erase(idleRounds_.begin() + j);
+
+      if (solutionType != SolutionType::Optimal)
+      {
+        break;
+      }
+    }
+
+    return solutionType;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ColumnGenerator<T>::addStatistics
+   * Adds the statistics of the last solve (or edit) of the master.
+   */
+  void
+  ColumnGenerator<T>::addStatistics()
+  {
+    const SimplexStatistics& statistics(simplexSolver_.statistics());
+
+    statistics_.pivotsCount += statistics.pivotsCount;
+    statistics_.degeneratePivotsCount += statistics.degeneratePivotsCount;
+    statistics_.boundFlipsCount += statistics.boundFlipsCount;
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `columngenerator.cxx'
+  extern template class ColumnGenerator<NumericTypes::real_t>;
+  extern template class ColumnGenerator<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // COLUMNGENERATOR_TXX
@@ -0,0 +1,14 @@
+﻿#pragma once
+
+#ifndef COLUMNGENERATOR_FWD_HXX
+#define COLUMNGENERATOR_FWD_HXX
+
+
+namespace LinearProgramming
+{
+  template<typename T>
+  class ColumnGenerator;
+}
+
+
+#endif // COLUMNGENERATOR_FWD_HXX
@@ -0,0 +1,36 @@
+﻿#pragma once
+
+#ifndef COLUMNMAPPING_HXX
+#define COLUMNMAPPING_HXX
+
+
+#include "eigen3/Eigen/Core"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using Eigen::DenseIndex;
+  using NumericTypes::real_t;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The ColumnMapping struct
+   * Expresses the original variable through the standard form ones:
+   *   x[j] == offset + x'[positive] - x'[negative],
+   * where the missing index is (-1).
+   */
+  struct ColumnMapping
+  {
+    DenseIndex positive = -1;
+
+    DenseIndex negative = -1;
+
+    T offset = T(0);
+  };
+}
+
+
+#endif // COLUMNMAPPING_HXX
@@ -0,0 +1,116 @@
+﻿#include "cycledetector.hxx"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+
+#include "../misc/hasher.hxx"
+
+
+namespace LinearProgramming
+{
+  using Config::LinearProgramming::MaxDegeneratePivots;
+  using std::size_t;
+  using Utils::Hasher;
+
+
+  CycleDetector::CycleDetector()
+  {
+    reset();
+  }
+
+
+  /**
+   * @brief CycleDetector::reset
+   * Starts watching from the current basis of the new tableau
+   * w/ the fast pivot rule.
+   */
+  void
+  CycleDetector::reset()
+  {
+    basisHash_ = 0;
+    isAntiCycling_ = false;
+
+    startRun();
+  }
+
+
+  /**
+   * @brief CycleDetector::update
+   * Accounts for the pivot ~x[k] ↔ x[s].
+   * @param leavingVarIdx Index of the basic variable `~x[k]'.
+   * @param enteringVarIdx Index of the free variable `x[s]'.
+   * @param isDegenerate `true' if (β[k] == 0) before the pivot.
+   */
+  void
+  CycleDetector::update(
+    DenseIndex leavingVarIdx, DenseIndex enteringVarIdx, bool isDegenerate
+  )
+  {
+    basisHash_ ^= key(leavingVarIdx) ^ key(enteringVarIdx);
+
+    if (!isDegenerate)
+    {
+      //The objective function value has changed,
+      //so none of the previous bases can repeat
+      isAntiCycling_ = false;
+      startRun();
+
+      return;
+    }
+
+    ++degeneratePivotsCount_;
+
+    const auto historyEnd(history_.cbegin() + historySize_);
+    if (
+      std::find(history_.cbegin(), historyEnd, basisHash_) != historyEnd ||
+      degeneratePivotsCount_ >= MaxDegeneratePivots
+    )
+    {
+      isAntiCycling_ = true;
+    }
+
+    history_[historyPos_] = basisHash_;
+    historyPos_ = (historyPos_ + 1) % history_.size();
+    historySize_ = std::min(historySize_ + 1, history_.size());
+  }
+
+
+  /**
+   * @brief CycleDetector::isAntiCycling
+   * @return `true' if the anti-cycling pivot rule is to be used.
+   */
+  bool
+  CycleDetector::isAntiCycling() const
+  {
+    return isAntiCycling_;
+  }
+
+
+  /**
+   * @brief CycleDetector::startRun
+   * Starts the new run of the degenerate pivots at the current basis.
+   */
+  void
+  CycleDetector::startRun()
+  {
+    degeneratePivotsCount_ = 0;
+
+    history_[0] = basisHash_;
+    historySize_ = 1;
+    historyPos_ = 1 % history_.size();
+  }
+
+
+  /**
+   * @brief CycleDetector::key
+   * @param varIdx
+   * @return The (pseudorandom) Zobrist key of the variable.
+   */
+  uint64_t
+  CycleDetector::key(DenseIndex varIdx)
+  {
+    return Hasher().add(uint64_t(varIdx)).digest().low;
+  }
+}
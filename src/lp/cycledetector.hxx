@@ -0,0 +1,79 @@
+﻿#pragma once
+
+#ifndef CYCLEDETECTOR_HXX
+#define CYCLEDETECTOR_HXX
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+
+#include "eigen3/Eigen/Core"
+
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using Eigen::DenseIndex;
+  using std::array;
+  using std::size_t;
+
+
+  /**
+   * @brief The CycleDetector class
+   * Watches the bases the Simplex method goes through to tell when
+   * the anti-cycling (Bland's) pivot rule is needed.
+   * The basis is identified by the incremental Zobrist hash of the set
+   * of its variables (XOR of the keys of the variables, relative to
+   * the basis it was reset at), so every pivot is O(1).
+   * Only the degenerate pivots (β[k] == 0) leave the objective function
+   * value as is, so the basis can only repeat within the run of them:
+   * the history of the bases is cleared by every nondegenerate pivot.
+   * The anti-cycling rule is needed since the basis of the run repeats
+   * or the run gets too long, and until the run ends.
+   * Nothing is allocated.
+   */
+  class CycleDetector
+  {
+    public:
+      CycleDetector();
+
+      void reset();
+
+      void update(
+        DenseIndex leavingVarIdx, DenseIndex enteringVarIdx,
+        bool isDegenerate
+      );
+
+      bool isAntiCycling() const;
+
+
+    private:
+      /**
+       * @brief history_
+       * Ring of the hashes of the recent bases of the run.
+       */
+      array<uint64_t, Config::LinearProgramming::CycleHistoryLength>
+      history_;
+
+      size_t historySize_;
+
+      size_t historyPos_;
+
+      uint64_t basisHash_;
+
+      uint32_t degeneratePivotsCount_;
+
+      bool isAntiCycling_;
+
+
+      void startRun();
+
+      static uint64_t key(DenseIndex varIdx);
+  };
+}
+
+
+#endif // CYCLEDETECTOR_HXX
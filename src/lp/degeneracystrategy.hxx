@@ -0,0 +1,28 @@
+﻿#pragma once
+
+#ifndef DEGENERACYSTRATEGY_HXX
+#define DEGENERACYSTRATEGY_HXX
+
+
+namespace LinearProgramming
+{
+  /**
+   * @brief The DegeneracyStrategy enum
+   * How `SimplexSolver<T>' deals w/ the degenerate (β[k] == 0) pivots:
+   *   `None' -- as is (see `CycleDetector' for the cycling),
+   *   `Perturbation' -- the program is solved w/ the randomly perturbed
+   * `β' first, the perturbation is removed at the end (it is meant for
+   * the real field),
+   *   `Lexicographic' -- the ties of the minimum ratio test are resolved
+   * by the lexicographic rule (it is exact for the rational field).
+   */
+  enum struct DegeneracyStrategy : int
+  {
+    None = 0,
+    Perturbation = 1,
+    Lexicographic = 2
+  };
+}
+
+
+#endif // DEGENERACYSTRATEGY_HXX
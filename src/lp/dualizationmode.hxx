@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#ifndef DUALIZATIONMODE_HXX
+#define DUALIZATIONMODE_HXX
+
+
+namespace LinearProgramming
+{
+  /**
+   * @brief The DualizationMode enum
+   * Whether `SimplexSolver<T>' solves the dual program
+   * (see `LinearProgramData<T>::dual') instead of the given one:
+   *   `Never' -- the given program is solved,
+   *   `Automatic' -- the dual one is solved if it is estimated
+   * to be cheaper to solve (e.g. for the tall programs, M >> N),
+   *   `Always' -- the dual one is solved.
+   * The extreme point of the given program is recovered from the dual's
+   * optimal tableau. The given program is infeasible if the dual one is
+   * unbounded, it is solved as is if the dual one is infeasible (it is either
+   * infeasible or unbounded then).
+   */
+  enum struct DualizationMode : int
+  {
+    Never = 0,
+    Automatic = 1,
+    Always = 2
+  };
+}
+
+
+#endif // DUALIZATIONMODE_HXX
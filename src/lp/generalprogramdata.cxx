@@ -0,0 +1,12 @@
+﻿#include "generalprogramdata.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template struct GeneralProgramData<NumericTypes::real_t>;
+  template struct GeneralProgramData<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
@@ -0,0 +1,94 @@
+﻿#pragma once
+
+#ifndef GENERALPROGRAMDATA_HXX
+#define GENERALPROGRAMDATA_HXX
+
+
+#include <stdexcept>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "boundedprogramdata.hxx"
+#include "linearprogramdata.hxx"
+#include "rowsense.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::real_t;
+  using std::invalid_argument;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The GeneralProgramData struct
+   * The program in the general form:
+   *   min (c, x), (α[i], x) {<=, ==, >=} β[i], l <= x <= u,
+   * where any row can be ranged (lo[i] <= (α[i], x) <= hi[i]) and any
+   * bound can be infinite. See `standardForm' for the conversion.
+   */
+  struct GeneralProgramData
+  {
+    GeneralProgramData() = default;
+
+    explicit GeneralProgramData(const LinearProgramData<T>& linearProgramData);
+
+    GeneralProgramData(
+      const Matrix<T, 1, Dynamic>& objectiveFunctionCoeffs,
+      const Matrix<T, Dynamic, Dynamic>& constraintsCoeffs,
+      const Matrix<T, Dynamic, 1>& constraintsRHS,
+      const vector<RowSense>& constraintsSenses
+    ) throw(invalid_argument);
+
+    DenseIndex constraintsCount() const;
+
+    DenseIndex variablesCount() const;
+
+    BoundedProgramData<T> standardForm() const throw(invalid_argument);
+
+
+    Matrix<T, 1, Dynamic> objectiveFunctionCoeffs;
+
+    Matrix<T, Dynamic, Dynamic> constraintsCoeffs;
+
+    Matrix<T, Dynamic, 1> constraintsRHS;
+
+    vector<RowSense> constraintsSenses;
+
+    /**
+     * @brief constraintsRanges
+     * MPS-style ranges `R' of the rows, `none' for the rows w/o range:
+     *   [lo; hi] == [β - |R|; β] for (<=) rows,
+     *   [lo; hi] == [β; β + |R|] for (>=) rows,
+     *   [lo; hi] == [β; β + R] or [β + R; β] for (==) rows
+     * depending on the sign of `R'.
+     */
+    vector<optional<T>> constraintsRanges;
+
+    /**
+     * @brief lowerBounds
+     * Lower bounds `l' of the variables, `none' for (-∞).
+     */
+    vector<optional<T>> lowerBounds;
+
+    /**
+     * @brief upperBounds
+     * Upper bounds `u' of the variables, `none' for (+∞).
+     */
+    vector<optional<T>> upperBounds;
+  };
+}
+
+
+#include "generalprogramdata.txx"
+
+
+#endif // GENERALPROGRAMDATA_HXX
@@ -0,0 +1,293 @@
+﻿#pragma once
+
+#ifndef GENERALPROGRAMDATA_TXX
+#define GENERALPROGRAMDATA_TXX
+
+
+#include "generalprogramdata.hxx"
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "boundedprogramdata.hxx"
+#include "columnmapping.hxx"
+#include "linearprogramdata.hxx"
+#include "rowsense.hxx"
+#include "../math/mathutils.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using MathUtils::absoluteValue;
+  using std::invalid_argument;
+  using std::vector;
+
+
+  template<typename T>
+  /**
+   * @brief GeneralProgramData<T>::GeneralProgramData
+   * The program w/ equality rows and non-negative variables.
+   * @param linearProgramData
+   */
+  GeneralProgramData<T>::GeneralProgramData(
+    const LinearProgramData<T>& linearProgramData
+  ) :
+    objectiveFunctionCoeffs(linearProgramData.objectiveFunctionCoeffs),
+    constraintsCoeffs(linearProgramData.constraintsCoeffs),
+    constraintsRHS(linearProgramData.constraintsRHS),
+    constraintsSenses(linearProgramData.constraintsCount(), RowSense::Equal),
+    constraintsRanges(linearProgramData.constraintsCount()),
+    lowerBounds(linearProgramData.variablesCount(), T(0)),
+    upperBounds(linearProgramData.variablesCount())
+  { }
+
+
+  template<typename T>
+  /**
+   * @brief GeneralProgramData<T>::GeneralProgramData
+   * The program w/o ranges and w/ non-negative variables.
+   * @param objectiveFunctionCoeffs
+   * @param constraintsCoeffs
+   * @param constraintsRHS
+   * @param constraintsSenses
+   */
+  GeneralProgramData<T>::GeneralProgramData(
+    const Matrix<T, 1, Dynamic>& objectiveFunctionCoeffs,
+    const Matrix<T, Dynamic, Dynamic>& constraintsCoeffs,
+    const Matrix<T, Dynamic, 1>& constraintsRHS,
+    const vector<RowSense>& constraintsSenses
+  ) throw(invalid_argument) :
+    objectiveFunctionCoeffs(objectiveFunctionCoeffs),
+    constraintsCoeffs(constraintsCoeffs),
+    constraintsRHS(constraintsRHS),
+    constraintsSenses(constraintsSenses),
+    constraintsRanges(constraintsCoeffs.rows()),
+    lowerBounds(constraintsCoeffs.cols(), T(0)),
+    upperBounds(constraintsCoeffs.cols())
+  {
+    if (
+      objectiveFunctionCoeffs.cols() != constraintsCoeffs.cols() ||
+      constraintsRHS.rows() != constraintsCoeffs.rows() ||
+      DenseIndex(constraintsSenses.size()) != constraintsCoeffs.rows()
+    )
+    {
+      throw invalid_argument(
+        "objectiveFunctionCoeffs.cols() != constraintsCoeffs.cols()"
+        " || constraintsRHS.rows() != constraintsCoeffs.rows()"
+        " || constraintsSenses.size() != constraintsCoeffs.rows()"
+      );
+    }
+  }
+
+
+  template<typename T>
+  DenseIndex
+  GeneralProgramData<T>::constraintsCount() const
+  {
+    return constraintsCoeffs.rows();
+  }
+
+
+  template<typename T>
+  DenseIndex
+  GeneralProgramData<T>::variablesCount() const
+  {
+    return constraintsCoeffs.cols();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief GeneralProgramData<T>::standardForm
+   * Converts the program to the standard form w/ the implicit slacks
+   * and the upper bounds (see `BoundedProgramData<T>'). Unlike
+   * `StandardFormBuilder<T>', neither the ranges nor the bounds add rows:
+   *   the bounded variable `l <= x <= u' becomes `x == l + x'',
+   *   `0 <= x' <= (u - l)' (the fixed one is substituted);
+   *   the variable w/ the upper bound only becomes `x == u - x'';
+   *   the free variable is split as `x == x' - x''';
+   *   the ranged row `lo <= (α[i], x) <= hi' becomes
+   *   `(α[i], x) - s[i] == lo', `0 <= s[i] <= (hi - lo)'.
+   * @return
+   */
+  BoundedProgramData<T>
+  GeneralProgramData<T>::standardForm() const throw(invalid_argument)
+  {
+    const DenseIndex rowsCount(constraintsCount());
+    const DenseIndex varsCount(variablesCount());
+
+    if (
+      objectiveFunctionCoeffs.cols() != varsCount ||
+      constraintsRHS.rows() != rowsCount ||
+      DenseIndex(constraintsSenses.size()) != rowsCount ||
+      DenseIndex(constraintsRanges.size()) != rowsCount ||
+      DenseIndex(lowerBounds.size()) != varsCount ||
+      DenseIndex(upperBounds.size()) != varsCount
+    )
+    {
+      throw invalid_argument("Sizes of the program data do not match");
+    }
+
+    BoundedProgramData<T> ret;
+    ret.columnMappings = vector<ColumnMapping<T>>(varsCount);
+
+    //Lay out the columns
+    DenseIndex colsCount(0);
+
+    for (DenseIndex j(0); j < varsCount; ++j)
+    {
+      const optional<T>& lowerBound(lowerBounds[j]);
+      const optional<T>& upperBound(upperBounds[j]);
+      ColumnMapping<T>& mapping(ret.columnMappings[j]);
+
+      if (lowerBound && upperBound)
+      {
+        if (*upperBound < *lowerBound)
+        {
+          throw invalid_argument("Variable has empty bounds interval");
+        }
+
+        mapping.offset = *lowerBound;
+
+        if (*upperBound != *lowerBound)
+        {
+          mapping.positive = colsCount++;
+          ret.upperBounds.push_back(*upperBound - *lowerBound);
+        }
+      }
+      else
+      {
+        if (lowerBound)
+        {
+          mapping.offset = *lowerBound;
+          mapping.positive = colsCount++;
+          ret.upperBounds.push_back(optional<T>());
+        }
+        else
+        {
+          if (upperBound)
+          {
+            mapping.offset = *upperBound;
+            mapping.negative = colsCount++;
+            ret.upperBounds.push_back(optional<T>());
+          }
+          else
+          {
+            mapping.positive = colsCount++;
+            mapping.negative = colsCount++;
+            ret.upperBounds.push_back(optional<T>());
+            ret.upperBounds.push_back(optional<T>());
+          }
+        }
+      }
+    }
+
+    //Substitute the variables
+    Matrix<T, 1, Dynamic> objFuncCoeffs(
+      Matrix<T, 1, Dynamic>::Zero(1, colsCount)
+    );
+    Matrix<T, Dynamic, Dynamic> constrsCoeffs(
+      Matrix<T, Dynamic, Dynamic>::Zero(rowsCount, colsCount)
+    );
+    Matrix<T, Dynamic, 1> constrsRHS(constraintsRHS);
+
+    for (DenseIndex j(0); j < varsCount; ++j)
+    {
+      const ColumnMapping<T>& mapping(ret.columnMappings[j]);
+
+      if (mapping.offset != T(0))
+      {
+        constrsRHS -= constraintsCoeffs.col(j) * mapping.offset;
+        ret.objectiveOffset += objectiveFunctionCoeffs(j) * mapping.offset;
+      }
+      if (mapping.positive >= 0)
+      {
+        constrsCoeffs.col(mapping.positive) = constraintsCoeffs.col(j);
+        objFuncCoeffs(mapping.positive) = objectiveFunctionCoeffs(j);
+      }
+      if (mapping.negative >= 0)
+      {
+        constrsCoeffs.col(mapping.negative) = constraintsCoeffs.col(j) * T(-1);
+        objFuncCoeffs(mapping.negative) = objectiveFunctionCoeffs(j) * T(-1);
+      }
+    }
+
+    //Lay out the slacks, the range `R' moves the RHS to the lower end
+    ret.slackCoeffs = Matrix<T, Dynamic, 1>::Zero(rowsCount, 1);
+
+    for (DenseIndex i(0); i < rowsCount; ++i)
+    {
+      const optional<T>& range(constraintsRanges[i]);
+      const RowSense sense(constraintsSenses[i]);
+
+      if (range)
+      {
+        const T width(absoluteValue<T>(*range));
+
+        if (
+          sense == RowSense::LessThanOrEqual ||
+          (sense == RowSense::Equal && *range < T(0))
+        )
+        {
+          constrsRHS(i) -= width;
+        }
+
+        //Zero-width range turns the row into the equality one
+        if (width != T(0))
+        {
+          ret.slackCoeffs(i) = T(-1);
+          ret.upperBounds.push_back(width);
+        }
+        else
+        {
+          ret.upperBounds.push_back(optional<T>());
+        }
+      }
+      else
+      {
+        switch (sense)
+        {
+          case RowSense::LessThanOrEqual:
+            ret.slackCoeffs(i) = T(1);
+            break;
+
+          case RowSense::GreaterThanOrEqual:
+            ret.slackCoeffs(i) = T(-1);
+            break;
+
+          default:
+            break;
+        }
+
+        ret.upperBounds.push_back(optional<T>());
+      }
+    }
+
+    ret.linearProgramData = LinearProgramData<T>(
+      std::move(objFuncCoeffs),
+      std::move(constrsCoeffs),
+      std::move(constrsRHS)
+    );
+
+    return ret;
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `generalprogramdata.cxx'
+  extern template struct GeneralProgramData<NumericTypes::real_t>;
+  extern template struct GeneralProgramData<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // GENERALPROGRAMDATA_TXX
@@ -0,0 +1,12 @@
+﻿#include "graphicalsolver2d.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class GraphicalSolver2D<NumericTypes::real_t>;
+  template class GraphicalSolver2D<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
@@ -13,8 +13,6 @@
 #include <utility>
 #include <vector>
 
-#include <QDebug>
-
 #include "boost/optional.hpp"
 #include "eigen3/Eigen/Core"
 
@@ -25,14 +23,14 @@
 #include "solutiontype.hxx"
 #include "../math/numericlimits.hxx"
 #include "../math/mathutils.hxx"
-#include "../misc/dataconvertors.hxx"
+#include "../misc/eigenextensions.hxx"
+#include "../misc/logsink.hxx"
 #include "../misc/utils.hxx"
 
 
 namespace LinearProgramming
 {
   using boost::optional;
-  using DataConvertors::numericCast;
   using Eigen::DenseIndex;
   using Eigen::Dynamic;
   using Eigen::Matrix;
@@ -42,6 +40,7 @@ namespace LinearProgramming
   using LinearProgrammingUtils::isSolutionFeasible;
   using MathUtils::isEqual;
   using MathUtils::isLessThan;
+  using MathUtils::numericCast;
   using LinearProgrammingUtils::sortPointsByPolarAngle;
   using LinearProgrammingUtils::computeBoundingBox;
   using NumericTypes::real_t;
@@ -51,7 +50,9 @@ namespace LinearProgramming
   using std::pair;
   using std::list;
   using std::vector;
+  using Utils::LogLevel;
   using Utils::makeString;
+  using Utils::writeLog;
 
 
   template<typename TCoeff/*, DenseIndex TDim = 2*/>
@@ -86,7 +87,7 @@ namespace LinearProgramming
     LinearProgramData<TCoeff>&& linearProgramData
   )
   {
-    linearProgramData_ = move(linearProgramData);
+    linearProgramData_ = std::move(linearProgramData);
   }
 
 
@@ -132,8 +133,11 @@ namespace LinearProgramming
     //rank(A^) should be equal to rank((A|b)^)
     if (rref_A.rank != rref_A_b.rank)
     {
-      qWarning() << "GraphicalSolver2D<T>::solve: inconsistent system:"
-                    " rank(A^) != rank((A|b)^)";
+      writeLog(
+        LogLevel::Warning,
+        "GraphicalSolver2D<T>::solve: inconsistent system:"
+        " rank(A^) != rank((A|b)^)"
+      );
 
       return make_pair(SolutionType::Infeasible, ret);
     }
@@ -141,8 +145,10 @@ namespace LinearProgramming
     //If (rank((A|b)^) == 0), all values of `x' are solutions
     if(rref_A_b.rank == 0)
     {
-      qWarning() << "GraphicalSolver2D<T>::solve: empty system:"
-                    " rank((A|b)^) == 0";
+      writeLog(
+        LogLevel::Warning,
+        "GraphicalSolver2D<T>::solve: empty system: rank((A|b)^) == 0"
+      );
 
       return make_pair(SolutionType::Unbounded, ret);
     }
@@ -158,8 +164,11 @@ namespace LinearProgramming
     const DenseIndex N_(N - M_);
     if (N_ != 2)
     {
-      qWarning() << "GraphicalSolver2D<T>::solve: could not solve this"
-                    " linear program: `N^' != 2";
+      writeLog(
+        LogLevel::Warning,
+        "GraphicalSolver2D<T>::solve: could not solve this"
+        " linear program: `N^' != 2"
+      );
 
       return make_pair(SolutionType::Unknown, ret);
     }
@@ -494,6 +503,13 @@ namespace LinearProgramming
       }
     }
   }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `graphicalsolver2d.cxx'
+  extern template class GraphicalSolver2D<NumericTypes::real_t>;
+  extern template class GraphicalSolver2D<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
 }
 
 
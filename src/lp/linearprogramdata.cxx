@@ -0,0 +1,12 @@
+﻿#include "linearprogramdata.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class LinearProgramData<NumericTypes::real_t>;
+  template class LinearProgramData<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
@@ -49,6 +49,8 @@ namespace LinearProgramming
 
     DenseIndex variablesCount() const;
 
+    LinearProgramData<T> dual() const;
+
 //    static LinearProgramData<T> make(???); //TODO: [0;?] Do we really need this?
 
 
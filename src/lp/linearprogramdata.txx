@@ -11,6 +11,8 @@
 
 #include "eigen3/Eigen/Core"
 
+#include "../misc/eigenextensions.hxx"
+
 
 namespace LinearProgramming
 {
@@ -130,6 +132,56 @@ namespace LinearProgramming
   {
     return constraintsCoeffs.cols();
   }
+
+
+  template<typename T>
+  /**
+   * @brief LinearProgramData<T>::dual
+   * Constructs the dual program of this one in the same form.
+   * The dual of
+   *   min (c, x), αx = β, x >= 0
+   * is
+   *   max (β, y), α^T y <= c (y is free),
+   * which is stored as
+   *   min (-β, y') + (β, y'') , α^T y' - α^T y'' + s = c,
+   *   y', y'', s >= 0,
+   * i.e. its N constraints are of the variables `y' == y' - y''' (M + M)
+   * and the slack ones `s' (N). Its optimal value is `-F*' and the extreme
+   * point `x*' is made of the reduced costs of `s'.
+   * @return
+   */
+  LinearProgramData<T>
+  LinearProgramData<T>::dual() const
+  {
+    const DenseIndex rowsCount(constraintsCount());
+    const DenseIndex colsCount(variablesCount());
+
+    LinearProgramData<T> ret;
+
+    ret.objectiveFunctionCoeffs.resize(2 * rowsCount + colsCount);
+    ret.objectiveFunctionCoeffs.head(rowsCount) =
+      constraintsRHS.transpose() * T(-1);
+    ret.objectiveFunctionCoeffs.segment(rowsCount, rowsCount) =
+      constraintsRHS.transpose();
+    ret.objectiveFunctionCoeffs.tail(colsCount).setZero();
+
+    ret.constraintsCoeffs.resize(colsCount, 2 * rowsCount + colsCount);
+    ret.constraintsCoeffs.leftCols(rowsCount) = constraintsCoeffs.transpose();
+    ret.constraintsCoeffs.middleCols(rowsCount, rowsCount) =
+      constraintsCoeffs.transpose() * T(-1);
+    ret.constraintsCoeffs.rightCols(colsCount).setIdentity();
+
+    ret.constraintsRHS = objectiveFunctionCoeffs.transpose();
+
+    return ret;
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `linearprogramdata.cxx'
+  extern template class LinearProgramData<NumericTypes::real_t>;
+  extern template class LinearProgramData<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
 }
 
 
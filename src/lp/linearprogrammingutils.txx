@@ -33,7 +33,7 @@ namespace LinearProgrammingUtils
   using std::ref;
 
 
-  template<typename T = real_t>
+  template<typename T>
   /**
    * @brief isSolutionFeasible
    * Checks if the point lies inside of
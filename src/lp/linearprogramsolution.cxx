@@ -0,0 +1,12 @@
+﻿#include "linearprogramsolution.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class LinearProgramSolution<NumericTypes::real_t>;
+  template class LinearProgramSolution<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
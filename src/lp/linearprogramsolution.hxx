@@ -4,13 +4,16 @@
 #define LINEARPROGRAMSOLUTION_HXX
 
 
+#include "boost/optional.hpp"
 #include "eigen3/Eigen/Core"
 
+#include "sensitivityanalysis.hxx"
 #include "../math/numerictypes.hxx"
 
 
 namespace LinearProgramming
 {
+  using boost::optional;
   using Eigen::Dynamic;
   using Eigen::Matrix;
   using NumericTypes::real_t;
@@ -47,6 +50,13 @@ namespace LinearProgramming
     Matrix<T, Dynamic, 1> extremePoint;
 
     T extremeValue;
+
+    /**
+     * @brief sensitivityAnalysis
+     * Filled by the solver on demand
+     * (see `SimplexSolver<T>::setSensitivityAnalysisEnabled').
+     */
+    optional<SensitivityAnalysis<T>> sensitivityAnalysis;
   };
 }
 
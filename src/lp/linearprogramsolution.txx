@@ -10,7 +10,9 @@
 
 #include "eigen3/Eigen/Core"
 
+#include "sensitivityanalysis.hxx"
 #include "solutiontype.hxx"
+#include "../misc/eigenextensions.hxx"
 
 
 namespace LinearProgramming
@@ -24,7 +26,8 @@ namespace LinearProgramming
     const LinearProgramSolution<T>& other
   ) :
     extremePoint(other.extremePoint),
-    extremeValue(other.extremeValue)
+    extremeValue(other.extremeValue),
+    sensitivityAnalysis(other.sensitivityAnalysis)
   { }
 
 
@@ -33,7 +36,8 @@ namespace LinearProgramming
     LinearProgramSolution<T>&& other
   ) :
     extremePoint(std::move(other.extremePoint)),
-    extremeValue(other.extremeValue)
+    extremeValue(other.extremeValue),
+    sensitivityAnalysis(std::move(other.sensitivityAnalysis))
   { }
 
 
@@ -65,6 +69,7 @@ namespace LinearProgramming
     {
       extremePoint = other.extremePoint;
       extremeValue = other.extremeValue;
+      sensitivityAnalysis = other.sensitivityAnalysis;
     }
 
     return *this;
@@ -77,12 +82,20 @@ namespace LinearProgramming
   {
     if (this != &other)
     {
-      extremePoint = move(other.extremePoint);
+      extremePoint = std::move(other.extremePoint);
       extremeValue = other.extremeValue;
+      sensitivityAnalysis = std::move(other.sensitivityAnalysis);
     }
 
     return *this;
   }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `linearprogramsolution.cxx'
+  extern template class LinearProgramSolution<NumericTypes::real_t>;
+  extern template class LinearProgramSolution<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
 }
 
 
@@ -0,0 +1,49 @@
+﻿#pragma once
+
+#ifndef MULTIRHSSOLUTION_HXX
+#define MULTIRHSSOLUTION_HXX
+
+
+#include <vector>
+
+#include "eigen3/Eigen/Core"
+
+#include "solutiontype.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::real_t;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The MultiRHSSolution struct
+   * Solutions of the program for every column `β[k]' of the given
+   * matrix (see `MultiRHSSolver<T>'), the column `k' of the matrices
+   * below is the one of `β[k]'.
+   */
+  struct MultiRHSSolution
+  {
+    vector<SolutionType> solutionTypes;
+
+    /**
+     * @brief extremePoints
+     * `x*' of `β[k]' as the column `k' (zero unless it is optimal).
+     */
+    Matrix<T, Dynamic, Dynamic> extremePoints;
+
+    /**
+     * @brief extremeValues
+     * `F*' of `β[k]' (zero unless it is optimal).
+     */
+    Matrix<T, 1, Dynamic> extremeValues;
+  };
+}
+
+
+#endif // MULTIRHSSOLUTION_HXX
@@ -0,0 +1,12 @@
+﻿#include "multirhssolver.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class MultiRHSSolver<NumericTypes::real_t>;
+  template class MultiRHSSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
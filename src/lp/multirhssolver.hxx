@@ -0,0 +1,105 @@
+﻿#pragma once
+
+#ifndef MULTIRHSSOLVER_HXX
+#define MULTIRHSSOLVER_HXX
+
+
+#include <stdexcept>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "multirhssolution.hxx"
+#include "simplexsolver.hxx"
+#include "simplexstatistics.hxx"
+#include "simplextableau.hxx"
+#include "solutiontype.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::real_t;
+  using std::invalid_argument;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The MultiRHSSolver class
+   * Solves the program for many `β' (e.g. the scenarios) w/ the same
+   * `α' and `c': the first `β' is solved from scratch, the next ones
+   * start from the previous optimal basis. Changing `β' leaves the basis
+   * dual feasible, so the dual Simplex method only has to restore
+   * (β >= (0)), usually in a few pivots.
+   * `B^-1' is computed once and kept up to date by these pivots,
+   * so the new column `β' of the tableau is just (B^-1 * β).
+   */
+  class MultiRHSSolver
+  {
+    public:
+      MultiRHSSolver() = default;
+
+      explicit MultiRHSSolver(const LinearProgramData<T>& linearProgramData);
+      explicit MultiRHSSolver(LinearProgramData<T>&& linearProgramData);
+
+      const LinearProgramData<T>& linearProgramData() const;
+
+      void setLinearProgramData(const LinearProgramData<T>& linearProgramData);
+      void setLinearProgramData(LinearProgramData<T>&& linearProgramData);
+
+      const SimplexStatistics& statistics() const;
+
+      MultiRHSSolution<T> solve(
+        const Matrix<T, Dynamic, Dynamic>& rhsColumns
+      ) throw(invalid_argument);
+
+
+    private:
+      /**
+       * @brief linearProgramData_
+       * The program, its `β' is not used.
+       */
+      LinearProgramData<T> linearProgramData_;
+
+      /**
+       * @brief simplexSolver_
+       * Pivots the tableau, its program is not used.
+       */
+      SimplexSolver<T> simplexSolver_;
+
+      optional<SimplexTableau<T>> tableau_;
+
+      /**
+       * @brief basisInverse_
+       * Maps `β' to the column `β' of the tableau (w/ `P0' in the last
+       * row), i.e. `B^-1' of the current basis w/ (-c[B] * B^-1) below.
+       */
+      Matrix<T, Dynamic, Dynamic> basisInverse_;
+
+      /**
+       * @brief redundancyChecks_
+       * Rows `y' of (y * α == (0)), the program is infeasible unless
+       * (y * β == 0) for all of them (see the redundant constraints
+       * dropped by `SimplexTableau<T>::transformToPhaseTwo').
+       */
+      Matrix<T, Dynamic, Dynamic> redundancyChecks_;
+
+
+      void factorize();
+
+      SolutionType resolve(const Matrix<T, Dynamic, 1>& rhs);
+
+      void pivot(DenseIndex rowIdx, DenseIndex colIdx);
+  };
+}
+
+
+#include "multirhssolver.txx"
+
+
+#endif // MULTIRHSSOLVER_HXX
@@ -0,0 +1,343 @@
+﻿#pragma once
+
+#ifndef MULTIRHSSOLVER_TXX
+#define MULTIRHSSOLVER_TXX
+
+
+#include "multirhssolver.hxx"
+
+#include <cstddef>
+
+#include <stdexcept>
+#include <utility>
+
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "linearprogrammingutils.hxx"
+#include "multirhssolution.hxx"
+#include "simplexsolver.hxx"
+#include "simplexstatistics.hxx"
+#include "simplextableau.hxx"
+#include "solutiontype.hxx"
+#include "../math/mathutils.hxx"
+#include "../misc/eigenextensions.hxx"
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using namespace Config::LinearProgramming;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using LinearProgrammingUtils::reducedRowEchelonForm;
+  using LinearProgrammingUtils::RREF;
+  using MathUtils::isEqualToZero;
+  using std::invalid_argument;
+  using std::pair;
+  using std::size_t;
+
+
+  template<typename T>
+  /**
+   * @brief MultiRHSSolver<T>::MultiRHSSolver
+   * @param linearProgramData The program, its `β' is not used.
+   */
+  MultiRHSSolver<T>::MultiRHSSolver(
+    const LinearProgramData<T>& linearProgramData
+  ) :
+    linearProgramData_(linearProgramData)
+  { }
+
+
+  template<typename T>
+  /**
+   * @brief MultiRHSSolver<T>::MultiRHSSolver
+   * @param linearProgramData The program, its `β' is not used.
+   */
+  MultiRHSSolver<T>::MultiRHSSolver(
+    LinearProgramData<T>&& linearProgramData
+  ) :
+    linearProgramData_(std::move(linearProgramData))
+  { }
+
+
+  template<typename T>
+  const LinearProgramData<T>&
+  MultiRHSSolver<T>::linearProgramData() const
+  {
+    return linearProgramData_;
+  }
+
+
+  template<typename T>
+  void
+  MultiRHSSolver<T>::setLinearProgramData(
+    const LinearProgramData<T>& linearProgramData
+  )
+  {
+    linearProgramData_ = linearProgramData;
+  }
+
+
+  template<typename T>
+  void
+  MultiRHSSolver<T>::setLinearProgramData(
+    LinearProgramData<T>&& linearProgramData
+  )
+  {
+    linearProgramData_ = std::move(linearProgramData);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MultiRHSSolver<T>::statistics
+   * @return Counters of the last `solve', summed up over all the columns.
+   */
+  const SimplexStatistics&
+  MultiRHSSolver<T>::statistics() const
+  {
+    return simplexSolver_.statistics();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MultiRHSSolver<T>::solve
+   * Solves the program for every column of `rhsColumns', in order.
+   * The columns are solved from scratch until one of them is optimal,
+   * the next ones start from the optimal basis of the previous column.
+   * @param rhsColumns `β[k]' as the column `k'.
+   * @return
+   */
+  MultiRHSSolution<T>
+  MultiRHSSolver<T>::solve(
+    const Matrix<T, Dynamic, Dynamic>& rhsColumns
+  ) throw(invalid_argument)
+  {
+    if (rhsColumns.rows() != linearProgramData_.constraintsCount())
+    {
+      throw invalid_argument("`rhsColumns' don't fit the program");
+    }
+
+    simplexSolver_.statistics_ = SimplexStatistics();
+
+    MultiRHSSolution<T> ret;
+    ret.solutionTypes.reserve(size_t(rhsColumns.cols()));
+    ret.extremePoints.setZero(
+      linearProgramData_.variablesCount(), rhsColumns.cols()
+    );
+    ret.extremeValues.setZero(rhsColumns.cols());
+
+    LinearProgramData<T> linearProgramData(linearProgramData_);
+    Matrix<T, Dynamic, 1> extremePoint;
+    bool isFactorized(false);
+
+    for (DenseIndex k(0); k < rhsColumns.cols(); ++k)
+    {
+      SolutionType solutionType;
+
+      if (isFactorized)
+      {
+        solutionType = resolve(rhsColumns.col(k));
+
+        //NOTE: The dual Simplex method keeps the basis dual feasible,
+        //unless it is interrupted
+        isFactorized = (
+          solutionType == SolutionType::Optimal ||
+          solutionType == SolutionType::Infeasible
+        );
+      }
+      else
+      {
+        linearProgramData.constraintsRHS = rhsColumns.col(k);
+        solutionType =
+          simplexSolver_.solveTableau(linearProgramData, tableau_);
+
+        if (solutionType == SolutionType::Optimal)
+        {
+          factorize();
+          isFactorized = true;
+        }
+      }
+
+      ret.solutionTypes.push_back(solutionType);
+
+      if (solutionType == SolutionType::Optimal)
+      {
+        tableau_->extremePoint(extremePoint);
+        ret.extremePoints.col(k) = extremePoint;
+        ret.extremeValues(k) = tableau_->extremeValue();
+      }
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MultiRHSSolver<T>::factorize
+   * Computes `basisInverse_' and `redundancyChecks_' of the optimal
+   * basis in `tableau_':
+   *   [α[., B] | I] ~ [I | B^-1]
+   *                   [0 |  Y  ].
+   */
+  void
+  MultiRHSSolver<T>::factorize()
+  {
+    const SimplexTableau<T>& tableau(*tableau_);
+    const DenseIndex basisSize(tableau.rows() - 1);
+    const DenseIndex constraintsCount(linearProgramData_.constraintsCount());
+
+    Matrix<T, Dynamic, Dynamic> system(
+      constraintsCount, basisSize + constraintsCount
+    );
+    for (DenseIndex i(0); i < basisSize; ++i)
+    {
+      system.col(i) =
+        linearProgramData_.constraintsCoeffs.col(tableau.basicVars()[i]);
+    }
+    system.rightCols(constraintsCount).setIdentity();
+
+    const RREF<T> rref(reducedRowEchelonForm<T>(system));
+
+    basisInverse_.resize(basisSize + 1, constraintsCount);
+    basisInverse_.topRows(basisSize) =
+      rref.rref.topRightCorner(basisSize, constraintsCount);
+    basisInverse_.row(basisSize).setZero();
+    for (DenseIndex i(0); i < basisSize; ++i)
+    {
+      basisInverse_.row(basisSize) -=
+        basisInverse_.row(i) *
+        linearProgramData_.objectiveFunctionCoeffs(tableau.basicVars()[i]);
+    }
+
+    redundancyChecks_ = rref.rref.bottomRightCorner(
+      constraintsCount - basisSize, constraintsCount
+    );
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MultiRHSSolver<T>::resolve
+   * Replaces `β' of the optimal tableau and makes it optimal again w/
+   * the dual Simplex method.
+   * @param rhs
+   * @return
+   */
+  SolutionType
+  MultiRHSSolver<T>::resolve(const Matrix<T, Dynamic, 1>& rhs)
+  {
+    SimplexTableau<T>& tableau(*tableau_);
+
+    const Matrix<T, Dynamic, 1> residuals(redundancyChecks_ * rhs);
+    for (DenseIndex i(0); i < residuals.rows(); ++i)
+    {
+      if (!isEqualToZero<T>(residuals(i)))
+      {
+        return SolutionType::Infeasible;
+      }
+    }
+
+    tableau.col(tableau.cols() - 1) = basisInverse_ * rhs;
+
+    simplexSolver_.reset();
+
+    //Dual Simplex method, (P >= (0)) holds for any `β'
+    while (true)
+    {
+      if (simplexSolver_.iterCount_ >= MaxSimplexIterations)
+      {
+        return SolutionType::Unknown;
+      }
+
+      const pair<SolutionType, MaybeIndex2D> pivotIdx(
+        simplexSolver_.computeDualPivotIdx(tableau)
+      );
+
+      if (!pivotIdx.second)
+      {
+        if (pivotIdx.first != SolutionType::Optimal)
+        {
+          return pivotIdx.first;
+        }
+
+        break;
+      }
+
+      ++simplexSolver_.iterCount_;
+
+      pivot((*pivotIdx.second).first, (*pivotIdx.second).second);
+    }
+
+    //The rounding errors in `P' are pivoted out by the primal Simplex
+    //method (see `SimplexSolver<T>::solvePhaseTwo')
+    while (true)
+    {
+      if (simplexSolver_.iterCount_ >= MaxSimplexIterations)
+      {
+        return SolutionType::Unknown;
+      }
+
+      const pair<SolutionType, MaybeIndex2D> pivotIdx(
+        simplexSolver_.computePivotIdx(tableau)
+      );
+
+      if (!pivotIdx.second)
+      {
+        if (pivotIdx.first != SolutionType::Optimal)
+        {
+          return pivotIdx.first;
+        }
+
+        break;
+      }
+
+      ++simplexSolver_.iterCount_;
+
+      pivot((*pivotIdx.second).first, (*pivotIdx.second).second);
+    }
+
+    return simplexSolver_.checkPhase2Solution(tableau);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief MultiRHSSolver<T>::pivot
+   * Pivots `tableau_' and transforms `basisInverse_' as its column `β'.
+   * @param rowIdx
+   * @param colIdx
+   */
+  void
+  MultiRHSSolver<T>::pivot(DenseIndex rowIdx, DenseIndex colIdx)
+  {
+    const SimplexTableau<T>& tableau(*tableau_);
+
+    basisInverse_.row(rowIdx) /= tableau(rowIdx, colIdx); //!
+    for (DenseIndex i(0); i < tableau.rows(); ++i)
+    {
+      if (i != rowIdx)
+      {
+        basisInverse_.row(i) -=
+          basisInverse_.row(rowIdx) * tableau(i, colIdx);
+      }
+    }
+
+    simplexSolver_.transformTableau(*tableau_, rowIdx, colIdx);
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `multirhssolver.cxx'
+  extern template class MultiRHSSolver<NumericTypes::real_t>;
+  extern template class MultiRHSSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // MULTIRHSSOLVER_TXX
@@ -0,0 +1,14 @@
+﻿#pragma once
+
+#ifndef MULTIRHSSOLVER_FWD_HXX
+#define MULTIRHSSOLVER_FWD_HXX
+
+
+namespace LinearProgramming
+{
+  template<typename T>
+  class MultiRHSSolver;
+}
+
+
+#endif // MULTIRHSSOLVER_FWD_HXX
@@ -0,0 +1,12 @@
+﻿#include "packedsimplexsolver.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class PackedSimplexSolver<NumericTypes::real_t>;
+  template class PackedSimplexSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
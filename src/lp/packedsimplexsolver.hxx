@@ -0,0 +1,134 @@
+﻿#pragma once
+
+#ifndef PACKEDSIMPLEXSOLVER_HXX
+#define PACKEDSIMPLEXSOLVER_HXX
+
+
+#include <cstdint>
+
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "cycledetector.hxx"
+#include "linearprogramdata.hxx"
+#include "linearprogramsolution.hxx"
+#include "simplexsolver.hxx"
+#include "simplextableau.hxx"
+#include "solutiontype.hxx"
+#include "../math/numerictypes.hxx"
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using namespace Config::LinearProgramming;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::real_t;
+  using std::pair;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The PackedSimplexSolver class
+   * Solves the batches of the same-shaped programs in lock-step.
+   * Up to `PackedSimplexLanesCount' tableaus are packed side by side
+   * (one lane per program), so every tableau entry is stored as a
+   * contiguous vector of lanes and the pivoting of all the lanes
+   * is done at once w/ the SIMD instructions.
+   * Lanes that have finished are masked out until the whole pack is done.
+   * The results are the same as the ones of `SimplexSolver<T>'.
+   * Packing pays off for the real programs of the moderate size only
+   * (see `isPackable'), the rest are solved by `SimplexSolver<T>'.
+   */
+  class PackedSimplexSolver
+  {
+    public:
+      using Result = pair<SolutionType, optional<LinearProgramSolution<T>>>;
+
+
+      PackedSimplexSolver() = default;
+
+      vector<Result> solve(
+        const LinearProgramData<T>* first, const LinearProgramData<T>* last
+      );
+
+      vector<Result> solve(
+        const vector<LinearProgramData<T>>& linearProgramsData
+      );
+
+
+    private:
+      /**
+       * @brief entries_
+       * Packed entries of the tableaus: the column `i * cols + j' stores
+       * the entry (i, j) of all the lanes. The count of the lanes is fixed,
+       * so that the operations on the columns are unrolled.
+       */
+      Matrix<T, PackedSimplexLanesCount, Dynamic> entries_;
+
+      /**
+       * @brief rowFactors_
+       * Pivot column of every lane w/o the pivot row entry (lanes × rows).
+       */
+      Matrix<T, PackedSimplexLanesCount, Dynamic> rowFactors_;
+
+      /**
+       * @brief colFactors_
+       * New pivot row of every lane w/o the pivot column entry
+       * (lanes × cols).
+       */
+      Matrix<T, PackedSimplexLanesCount, Dynamic> colFactors_;
+
+      DenseIndex rows_;
+
+      DenseIndex cols_;
+
+      vector<SimplexTableau<T>*> tableaus_;
+
+      vector<SolutionType> solutionTypes_;
+
+      vector<uint32_t> iterCounts_;
+
+      vector<pair<DenseIndex, DenseIndex>> pivotsIndices_;
+
+      vector<CycleDetector> cycleDetectors_;
+
+
+      static bool isPackable(DenseIndex rows, DenseIndex cols);
+
+      void solvePack(
+        const LinearProgramData<T>* first, const LinearProgramData<T>* last,
+        Result* results
+      );
+
+      void optimize(vector<optional<SimplexTableau<T>>>& tableaus);
+
+      void pack();
+
+      void unpack();
+
+      pair<SolutionType, MaybeIndex2D>
+      computePivotIdx(DenseIndex laneIdx) const;
+
+      MaybeIndex1D computePivotColIdx(DenseIndex laneIdx) const;
+
+      MaybeIndex1D computePivotRowIdx(
+        DenseIndex laneIdx, DenseIndex pivotColIdx
+      ) const;
+
+      void transformTableaus();
+  };
+}
+
+
+#include "packedsimplexsolver.txx"
+
+
+#endif // PACKEDSIMPLEXSOLVER_HXX
@@ -0,0 +1,729 @@
+﻿#pragma once
+
+#ifndef PACKEDSIMPLEXSOLVER_TXX
+#define PACKEDSIMPLEXSOLVER_TXX
+
+
+#include "packedsimplexsolver.hxx"
+
+#include <cstdint>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "linearprogramsolution.hxx"
+#include "simplexsolver.hxx"
+#include "simplextableau.hxx"
+#include "solutiontype.hxx"
+#include "../math/mathutils.hxx"
+#include "../math/numericlimits.hxx"
+#include "../misc/eigenextensions.hxx"
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using namespace Config::LinearProgramming;
+  using Eigen::DenseIndex;
+  using MathUtils::isEqual;
+  using MathUtils::isEqualToZero;
+  using MathUtils::isGreaterThanZero;
+  using MathUtils::isLessThan;
+  using MathUtils::isLessThanZero;
+  using std::make_pair;
+  using std::pair;
+  using std::vector;
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::solve
+   * Solves the programs [first; last). The consecutive programs of the
+   * same size are packed together, the program of the other size starts
+   * a new pack. The packs that are not worth it (see `isPackable')
+   * are solved one by one.
+   * @param first
+   * @param last
+   * @return Results in the order of the programs.
+   */
+  vector<typename PackedSimplexSolver<T>::Result>
+  PackedSimplexSolver<T>::solve(
+    const LinearProgramData<T>* first, const LinearProgramData<T>* last
+  )
+  {
+    vector<Result> ret(
+      last - first,
+      make_pair(SolutionType::Unknown, optional<LinearProgramSolution<T>>())
+    );
+
+    const LinearProgramData<T>* packFirst(first);
+    while (packFirst != last)
+    {
+      const DenseIndex rows(packFirst->constraintsCoeffs.rows());
+      const DenseIndex cols(packFirst->constraintsCoeffs.cols());
+
+      const LinearProgramData<T>* packLast(packFirst + 1);
+      while (
+        packLast != last &&
+        packLast - packFirst < PackedSimplexLanesCount &&
+        packLast->constraintsCoeffs.rows() == rows &&
+        packLast->constraintsCoeffs.cols() == cols
+      )
+      {
+        ++packLast;
+      }
+
+      if (packLast - packFirst > 1 && isPackable(rows, cols))
+      {
+        solvePack(packFirst, packLast, ret.data() + (packFirst - first));
+      }
+      else
+      {
+        SimplexSolver<T> simplexSolver;
+
+        for (const LinearProgramData<T>* it(packFirst); it != packLast; ++it)
+        {
+          simplexSolver.setLinearProgramData(*it);
+          ret[it - first] = simplexSolver.solve();
+        }
+      }
+
+      packFirst = packLast;
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::solve
+   * @param linearProgramsData
+   * @return Results in the order of the programs.
+   */
+  vector<typename PackedSimplexSolver<T>::Result>
+  PackedSimplexSolver<T>::solve(
+    const vector<LinearProgramData<T>>& linearProgramsData
+  )
+  {
+    return
+      solve(
+        linearProgramsData.data(),
+        linearProgramsData.data() + linearProgramsData.size()
+      );
+  }
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::isPackable
+   * Packing speeds up the pivoting only, at the cost of the lanes that
+   * idle until the slowest one is done. It pays off neither for the
+   * small programs, nor for the ones whose pack does not fit the cache,
+   * nor for the rational ones, that are not vectorized.
+   * @param rows
+   * @param cols
+   * @return `true' if the programs of the size (rows × cols) are solved
+   * faster packed than one by one.
+   */
+  bool
+  PackedSimplexSolver<T>::isPackable(DenseIndex rows, DenseIndex cols)
+  {
+    return (
+      std::is_floating_point<T>::value &&
+      rows * cols >= MinPackedSimplexCoeffsCount &&
+      rows * cols <= MaxPackedSimplexCoeffsCount
+    );
+  }
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::solvePack
+   * Solves the same-sized programs [first; last) (one lane per program)
+   * step by step as `SimplexSolver<T>::solve' does.
+   * @param first
+   * @param last
+   * @param results
+   */
+  void
+  PackedSimplexSolver<T>::solvePack(
+    const LinearProgramData<T>* first, const LinearProgramData<T>* last,
+    Result* results
+  )
+  {
+    const DenseIndex lanesCount(last - first);
+
+    //NOTE: Only the checks of the solutions are used
+    SimplexSolver<T> simplexSolver;
+
+    solutionTypes_.assign(lanesCount, SolutionType::Incomplete);
+    iterCounts_.assign(lanesCount, 0);
+    pivotsIndices_.resize(lanesCount);
+
+    //Solve Phase-1 for all the lanes (starting from the crash bases,
+    //it doesn't change the shape of the tableaus)
+    vector<optional<SimplexTableau<T>>> phase1Tableaus(lanesCount);
+    for (DenseIndex laneIdx(0); laneIdx < lanesCount; ++laneIdx)
+    {
+      phase1Tableaus[laneIdx].emplace(
+        SimplexTableau<T>::makePhaseOne(first[laneIdx])
+      );
+      SimplexTableau<T>::crash(first[laneIdx], *phase1Tableaus[laneIdx]);
+    }
+
+    optimize(phase1Tableaus);
+
+    //Solve Phase-2 for the lanes w/ the optimal Phase-1 solution
+    vector<optional<SimplexTableau<T>>> phase2Tableaus(lanesCount);
+    for (DenseIndex laneIdx(0); laneIdx < lanesCount; ++laneIdx)
+    {
+      SolutionType& solutionType(solutionTypes_[laneIdx]);
+
+      if (solutionType == SolutionType::Optimal)
+      {
+        solutionType =
+          simplexSolver.checkPhase1Solution(*phase1Tableaus[laneIdx]);
+
+        if (solutionType == SolutionType::Optimal)
+        {
+          ++iterCounts_[laneIdx];
+
+          phase2Tableaus[laneIdx].emplace(
+            SimplexTableau<T>::makePhaseTwo(
+              first[laneIdx], *phase1Tableaus[laneIdx]
+            )
+          );
+          solutionType = SolutionType::Incomplete;
+
+          //NOTE: The tableau w/o the rows of the redundant constraints
+          //doesn't fit the pack, so it is solved on its own
+          if (
+            phase2Tableaus[laneIdx]->rows() !=
+            phase1Tableaus[laneIdx]->rows()
+          )
+          {
+            simplexSolver.iterCount_ = iterCounts_[laneIdx];
+            solutionType = simplexSolver.optimize(*phase2Tableaus[laneIdx]);
+            iterCounts_[laneIdx] = simplexSolver.iterCount_;
+          }
+        }
+      }
+    }
+
+    optimize(phase2Tableaus);
+
+    for (DenseIndex laneIdx(0); laneIdx < lanesCount; ++laneIdx)
+    {
+      SolutionType solutionType(solutionTypes_[laneIdx]);
+      optional<LinearProgramSolution<T>> solution;
+
+      if (solutionType == SolutionType::Optimal && phase2Tableaus[laneIdx])
+      {
+        //Recheck Phase-2 solution (x* >= (0))
+        const SimplexTableau<T>& phase2Tableau(*phase2Tableaus[laneIdx]);
+
+        solutionType = simplexSolver.checkPhase2Solution(phase2Tableau);
+        if (solutionType == SolutionType::Optimal)
+        {
+          solution = LinearProgramSolution<T>(
+            phase2Tableau.extremePoint(), phase2Tableau.extremeValue()
+          );
+        }
+      }
+
+      results[laneIdx] = make_pair(solutionType, solution);
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::optimize
+   * Performs the Simplex algorithm steps on the lanes w/ the incomplete
+   * solutions until all of them are done.
+   * @param tableaus Tableaus of the lanes, `none' for the masked lanes.
+   */
+  void
+  PackedSimplexSolver<T>::optimize(
+    vector<optional<SimplexTableau<T>>>& tableaus
+  )
+  {
+    const DenseIndex lanesCount(tableaus.size());
+
+    tableaus_.assign(lanesCount, nullptr);
+    rows_ = 0;
+    cols_ = 0;
+
+    for (DenseIndex laneIdx(0); laneIdx < lanesCount; ++laneIdx)
+    {
+      if (
+        tableaus[laneIdx] &&
+        solutionTypes_[laneIdx] == SolutionType::Incomplete
+      )
+      {
+        tableaus_[laneIdx] = &*tableaus[laneIdx];
+        rows_ = tableaus[laneIdx]->rows();
+        cols_ = tableaus[laneIdx]->cols();
+      }
+    }
+
+    if (rows_ == 0)
+    {
+      return;
+    }
+
+    //Start w/ the fast pivot rule from the bases of the given tableaus
+    cycleDetectors_.assign(lanesCount, CycleDetector());
+
+    pack();
+
+    while (true)
+    {
+      bool isIncomplete(false);
+
+      for (DenseIndex laneIdx(0); laneIdx < lanesCount; ++laneIdx)
+      {
+        SolutionType& solutionType(solutionTypes_[laneIdx]);
+
+        if (solutionType != SolutionType::Incomplete)
+        {
+          continue;
+        }
+
+        if (iterCounts_[laneIdx] >= MaxSimplexIterations) //If can iterate
+        {
+          solutionType = SolutionType::Unknown;
+        }
+        else
+        {
+          const pair<SolutionType, MaybeIndex2D> pivotIdx(
+            computePivotIdx(laneIdx)
+          );
+
+          if (pivotIdx.second) //If indices is present
+          {
+            ++iterCounts_[laneIdx];
+            pivotsIndices_[laneIdx] = *pivotIdx.second;
+            isIncomplete = true;
+          }
+          else
+          {
+            solutionType = pivotIdx.first;
+          }
+        }
+      }
+
+      if (!isIncomplete)
+      {
+        break;
+      }
+
+      transformTableaus();
+    }
+
+    unpack();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::pack
+   * Copies the entries of the tableaus to the lanes.
+   */
+  void
+  PackedSimplexSolver<T>::pack()
+  {
+    const DenseIndex lanesCount(tableaus_.size());
+
+    entries_.setZero(PackedSimplexLanesCount, rows_ * cols_);
+    rowFactors_.setZero(PackedSimplexLanesCount, rows_);
+    colFactors_.setZero(PackedSimplexLanesCount, cols_);
+
+    for (DenseIndex laneIdx(0); laneIdx < lanesCount; ++laneIdx)
+    {
+      if (tableaus_[laneIdx] != nullptr)
+      {
+        const SimplexTableau<T>& tableau(*tableaus_[laneIdx]);
+
+        for (DenseIndex i(0); i < rows_; ++i)
+        {
+          for (DenseIndex j(0); j < cols_; ++j)
+          {
+            entries_(laneIdx, i * cols_ + j) = tableau(i, j);
+          }
+        }
+      }
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::unpack
+   * Copies the entries of the lanes back to the tableaus.
+   */
+  void
+  PackedSimplexSolver<T>::unpack()
+  {
+    const DenseIndex lanesCount(tableaus_.size());
+
+    for (DenseIndex laneIdx(0); laneIdx < lanesCount; ++laneIdx)
+    {
+      if (tableaus_[laneIdx] != nullptr)
+      {
+        SimplexTableau<T>& tableau(*tableaus_[laneIdx]);
+
+        for (DenseIndex i(0); i < rows_; ++i)
+        {
+          for (DenseIndex j(0); j < cols_; ++j)
+          {
+            tableau(i, j) = entries_(laneIdx, i * cols_ + j);
+          }
+        }
+      }
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::computePivotIdx
+   * Tries to compute pivot element position in the tableau of the lane
+   * (see `SimplexSolver<T>::computePivotIdx').
+   * @param laneIdx
+   * @return
+   */
+  pair<SolutionType, MaybeIndex2D>
+  PackedSimplexSolver<T>::computePivotIdx(DenseIndex laneIdx) const
+  {
+    MaybeIndex2D idx;
+
+    const MaybeIndex1D pivotColIdx(computePivotColIdx(laneIdx));
+    if (pivotColIdx)
+    {
+      const MaybeIndex1D pivotRowIdx(
+        computePivotRowIdx(laneIdx, *pivotColIdx)
+      );
+
+      if (pivotRowIdx)
+      {
+        idx = make_pair(*pivotRowIdx, *pivotColIdx);
+
+        return make_pair(SolutionType::Incomplete, idx);
+      }
+      else
+      {
+        return make_pair(SolutionType::Unbounded, idx);
+      }
+    }
+    else
+    {
+      return make_pair(SolutionType::Optimal, idx);
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::computePivotColIdx
+   * Picks the pivot column of the lane w/ the same rule as
+   * `SimplexSolver<T>::computePivotColIdx' does.
+   * @param laneIdx
+   * @return (optional)
+   */
+  MaybeIndex1D
+  PackedSimplexSolver<T>::computePivotColIdx(DenseIndex laneIdx) const
+  {
+    MaybeIndex1D ret;
+
+    const DenseIndex objRowOffset((rows_ - 1) * cols_);
+
+    DenseIndex minCoeffColIdx(0);
+    bool haveNegativeCoeffs(false);
+
+#ifdef LP_WITH_BLAND_RULE
+    const bool isBlandRule(cycleDetectors_[laneIdx].isAntiCycling());
+#else // LP_WITH_BLAND_RULE
+    const bool isBlandRule(false);
+#endif // LP_WITH_BLAND_RULE
+
+    if (isBlandRule)
+    {
+      const SimplexTableau<T>& tableau(*tableaus_[laneIdx]);
+
+      //Find min{s} for all `s' where (∃s: P[s] < 0)
+      DenseIndex minVarIdx(
+        tableau.freeVarsCount() + tableau.basicVarsCount()
+      );
+
+      for (DenseIndex colIdx(0); colIdx < cols_ - 1; ++colIdx)
+      {
+        const DenseIndex currVarIdx(tableau.freeVars()[colIdx]);
+        const T& currCoeff(entries_(laneIdx, objRowOffset + colIdx));
+
+        if (isLessThanZero<T>(currCoeff))
+        {
+          haveNegativeCoeffs = true;
+
+          if (currVarIdx < minVarIdx)
+          {
+            minVarIdx = currVarIdx;
+            minCoeffColIdx = colIdx;
+          }
+        }
+      }
+    }
+    else
+    {
+      //Find argmin{P[s]} for all `s' where (P[s] < 0)
+      T minCoeff(0);
+
+      for (DenseIndex colIdx(0); colIdx < cols_ - 1; ++colIdx)
+      {
+        const T& currCoeff(entries_(laneIdx, objRowOffset + colIdx));
+
+        if (isLessThanZero<T>(currCoeff))
+        {
+          haveNegativeCoeffs = true;
+
+          if (currCoeff < minCoeff)
+          {
+            minCoeff = currCoeff;
+            minCoeffColIdx = colIdx;
+          }
+        }
+      }
+    }
+
+    if (haveNegativeCoeffs)
+    {
+      ret = minCoeffColIdx;
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::computePivotRowIdx
+   * Performs the minimum ratio test on the lane w/ the same rule as
+   * `SimplexSolver<T>::computePivotRowIdx' does.
+   * @param laneIdx
+   * @param pivotColIdx
+   * @return (optional)
+   */
+  MaybeIndex1D
+  PackedSimplexSolver<T>::computePivotRowIdx(
+    DenseIndex laneIdx, DenseIndex pivotColIdx
+  ) const
+  {
+    MaybeIndex1D ret;
+
+    DenseIndex minRatioRowIdx(0);
+    T minRatio(NumericLimits::max<T>());
+
+#ifdef LP_WITH_BLAND_RULE
+    const bool isBlandRule(cycleDetectors_[laneIdx].isAntiCycling());
+#else // LP_WITH_BLAND_RULE
+    const bool isBlandRule(false);
+#endif // LP_WITH_BLAND_RULE
+
+    const SimplexTableau<T>& tableau(*tableaus_[laneIdx]);
+
+    //NOTE: Ties are resolved on the fly: among the rows w/ the same
+    //minimal ratio the one w/ the least basic var index is picked,
+    //the first of them if all of the indices are >= (~M)
+    DenseIndex minRatioRowsCount(0);
+    DenseIndex minRatioVarIdx(0);
+
+    for (DenseIndex rowIdx(0); rowIdx < rows_ - 1; ++rowIdx)
+    {
+      const T& currCoeff(entries_(laneIdx, rowIdx * cols_ + pivotColIdx));
+
+      //For the minimum-ratio-test pick
+      //only non-negative elements (α[k, s] > 0)
+      if (!isGreaterThanZero<T>(currCoeff))
+      {
+        continue;
+      }
+
+      //Compute ratio β[k] / α[k, s]
+      const T currRatio(
+        entries_(laneIdx, rowIdx * cols_ + cols_ - 1) / currCoeff //!
+      );
+
+      if (isBlandRule)
+      {
+        if (!isEqual<T>(currRatio, minRatio))
+        {
+          if (!isLessThan<T>(currRatio, minRatio))
+          {
+            continue;
+          }
+
+          minRatio = currRatio;
+          minRatioRowsCount = 0;
+        }
+
+        if (minRatioRowsCount++ == 0)
+        {
+          minRatioRowIdx = rowIdx;
+          minRatioVarIdx = tableau.basicVarsCount();
+        }
+
+        const DenseIndex currVarIdx(tableau.basicVars()[rowIdx]);
+        if (currVarIdx < minRatioVarIdx)
+        {
+          minRatioVarIdx = currVarIdx;
+          minRatioRowIdx = rowIdx;
+        }
+      }
+      else
+      {
+        //Update w/ new found minimum
+        if (isLessThan<T>(currRatio, minRatio))
+        {
+          minRatio = currRatio;
+          minRatioRowIdx = rowIdx;
+        }
+
+        ++minRatioRowsCount;
+      }
+    }
+
+    if (minRatioRowsCount > 0)
+    {
+      ret = minRatioRowIdx;
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief PackedSimplexSolver<T>::transformTableaus
+   * Performs the pivoting on all the lanes w/ the incomplete solutions
+   * (see `SimplexSolver<T>::transformTableau').
+   * For the entries out of the pivot row `k' and the pivot column `s'
+   * it is the rank-1 update of the lanes
+   *   α[i, j] -= α[i, s] * (α[k, j] / α[k, s]),
+   * which is done for all the lanes at once. The factors of the masked
+   * lanes are zeros, so their entries are left as is.
+   * The pivot row and column are updated lane by lane afterwards.
+   */
+  void
+  PackedSimplexSolver<T>::transformTableaus()
+  {
+    const DenseIndex lanesCount(tableaus_.size());
+
+    //Gather the pivot columns and the new pivot rows
+    for (DenseIndex laneIdx(0); laneIdx < lanesCount; ++laneIdx)
+    {
+      if (solutionTypes_[laneIdx] != SolutionType::Incomplete)
+      {
+        rowFactors_.row(laneIdx).setZero();
+        colFactors_.row(laneIdx).setZero();
+
+        continue;
+      }
+
+      const DenseIndex rowIdx(pivotsIndices_[laneIdx].first);
+      const DenseIndex colIdx(pivotsIndices_[laneIdx].second);
+      const T pivotElement(entries_(laneIdx, rowIdx * cols_ + colIdx));
+
+      for (DenseIndex j(0); j < cols_; ++j)
+      {
+        colFactors_(laneIdx, j) = (
+          j != colIdx ?
+          entries_(laneIdx, rowIdx * cols_ + j) / pivotElement : //!
+          T(0)
+        );
+      }
+
+      for (DenseIndex i(0); i < rows_; ++i)
+      {
+        rowFactors_(laneIdx, i) = (
+          i != rowIdx ?
+          entries_(laneIdx, i * cols_ + colIdx) :
+          T(0)
+        );
+      }
+    }
+
+    //(new row) = (old row) - (factor) * (new pivot row) for all the lanes
+    for (DenseIndex i(0); i < rows_; ++i)
+    {
+      for (DenseIndex j(0); j < cols_; ++j)
+      {
+        entries_.col(i * cols_ + j) -=
+          rowFactors_.col(i).cwiseProduct(colFactors_.col(j));
+      }
+    }
+
+    //Scatter the new pivot rows and columns
+    for (DenseIndex laneIdx(0); laneIdx < lanesCount; ++laneIdx)
+    {
+      if (solutionTypes_[laneIdx] != SolutionType::Incomplete)
+      {
+        continue;
+      }
+
+      const DenseIndex rowIdx(pivotsIndices_[laneIdx].first);
+      const DenseIndex colIdx(pivotsIndices_[laneIdx].second);
+      const T pivotElement(entries_(laneIdx, rowIdx * cols_ + colIdx));
+
+      SimplexTableau<T>& tableau(*tableaus_[laneIdx]);
+
+      //Watch the bases for cycling (the pivot row is left as is so far)
+      cycleDetectors_[laneIdx].update(
+        tableau.basicVars()[rowIdx], tableau.freeVars()[colIdx],
+        isEqualToZero<T>(entries_(laneIdx, rowIdx * cols_ + cols_ - 1))
+      );
+
+      //Swap the free and basic variable ~x[k] ↔ x[s]
+      std::swap(tableau.basicVars()[rowIdx], tableau.freeVars()[colIdx]);
+
+      //(new pivot row) = (old pivot row) / (old pivot)
+      for (DenseIndex j(0); j < cols_; ++j)
+      {
+        if (j != colIdx)
+        {
+          entries_(laneIdx, rowIdx * cols_ + j) = colFactors_(laneIdx, j);
+        }
+      }
+
+      //(new pivot) = 1 / (old pivot)
+      entries_(laneIdx, rowIdx * cols_ + colIdx) = T(1) / pivotElement; //!
+
+      //(new pivot column) = (old pivot column) / ((-1) * (old pivot))
+      for (DenseIndex i(0); i < rows_; ++i)
+      {
+        if (i != rowIdx)
+        {
+          entries_(laneIdx, i * cols_ + colIdx) =
+            rowFactors_(laneIdx, i) / (pivotElement * T(-1)); //!
+        }
+      }
+    }
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `packedsimplexsolver.cxx'
+  extern template class PackedSimplexSolver<NumericTypes::real_t>;
+  extern template class PackedSimplexSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // PACKEDSIMPLEXSOLVER_TXX
@@ -0,0 +1,14 @@
+﻿#pragma once
+
+#ifndef PACKEDSIMPLEXSOLVER_FWD_HXX
+#define PACKEDSIMPLEXSOLVER_FWD_HXX
+
+
+namespace LinearProgramming
+{
+  template<typename T>
+  class PackedSimplexSolver;
+}
+
+
+#endif // PACKEDSIMPLEXSOLVER_FWD_HXX
@@ -0,0 +1,12 @@
+﻿#include "parametricsolution.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template struct ParametricSolution<NumericTypes::real_t>;
+  template struct ParametricSolution<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
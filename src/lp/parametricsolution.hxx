@@ -0,0 +1,70 @@
+﻿#pragma once
+
+#ifndef PARAMETRICSOLUTION_HXX
+#define PARAMETRICSOLUTION_HXX
+
+
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "solutiontype.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::real_t;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The ParametricSolution struct
+   * Optimal value function `F*(t)' of the program along the ray
+   * (see `ParametricSolver<T>'). It is linear between the consecutive
+   * breakpoints, every breakpoint is where the optimal basis changes
+   * (the first and the last ones are the ends of the swept range).
+   */
+  struct ParametricSolution
+  {
+    optional<T> extremeValue(const T& parameter) const;
+
+
+    /**
+     * @brief breakpoints
+     * Increasing values of `t', from the lower end of the range.
+     */
+    vector<T> breakpoints;
+
+    /**
+     * @brief extremeValues
+     * `F*' at the breakpoints.
+     */
+    vector<T> extremeValues;
+
+    /**
+     * @brief extremePoints
+     * `x*' at the breakpoints, of the basis that stays optimal up to
+     * the next breakpoint.
+     */
+    vector<Matrix<T, Dynamic, 1>> extremePoints;
+
+    /**
+     * @brief tailType
+     * What the program is past the last breakpoint (if it is not
+     * the upper end of the range), e.g. `SolutionType::Infeasible'.
+     */
+    SolutionType tailType = SolutionType::Optimal;
+  };
+}
+
+
+#include "parametricsolution.txx"
+
+
+#endif // PARAMETRICSOLUTION_HXX
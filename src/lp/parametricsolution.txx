@@ -0,0 +1,86 @@
+﻿#pragma once
+
+#ifndef PARAMETRICSOLUTION_TXX
+#define PARAMETRICSOLUTION_TXX
+
+
+#include "parametricsolution.hxx"
+
+#include <cstddef>
+
+#include <algorithm>
+#include <vector>
+
+#include "boost/optional.hpp"
+
+#include "../math/mathutils.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using MathUtils::isEqual;
+  using MathUtils::isGreaterThan;
+  using MathUtils::isLessThan;
+  using std::size_t;
+  using std::vector;
+
+
+  template<typename T>
+  /**
+   * @brief ParametricSolution<T>::extremeValue
+   * Interpolates `F*' between the breakpoints.
+   * @param parameter
+   * @return (optional) `F*(t)', `none' if `t' is out of the breakpoints
+   * (beyond the tolerance).
+   */
+  optional<T>
+  ParametricSolution<T>::extremeValue(const T& parameter) const
+  {
+    optional<T> ret;
+
+    if (
+      breakpoints.empty() ||
+      isLessThan<T>(parameter, breakpoints.front()) ||
+      isGreaterThan<T>(parameter, breakpoints.back())
+    )
+    {
+      return ret;
+    }
+
+    //The segment [t[k - 1]; t[k]] containing `t' (the last one if `t'
+    //is just past the end)
+    const size_t k(
+      std::min<size_t>(
+        std::lower_bound(breakpoints.cbegin(), breakpoints.cend(), parameter) -
+        breakpoints.cbegin(),
+        breakpoints.size() - 1
+      )
+    );
+
+    if (k == 0 || isEqual<T>(breakpoints[k], parameter))
+    {
+      ret = extremeValues[k];
+    }
+    else
+    {
+      ret =
+        extremeValues[k - 1] +
+        (extremeValues[k] - extremeValues[k - 1]) *
+        (parameter - breakpoints[k - 1]) /
+        (breakpoints[k] - breakpoints[k - 1]); //!
+    }
+
+    return ret;
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `parametricsolution.cxx'
+  extern template struct ParametricSolution<NumericTypes::real_t>;
+  extern template struct ParametricSolution<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // PARAMETRICSOLUTION_TXX
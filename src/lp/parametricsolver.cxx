@@ -0,0 +1,12 @@
+﻿#include "parametricsolver.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class ParametricSolver<NumericTypes::real_t>;
+  template class ParametricSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
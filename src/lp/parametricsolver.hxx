@@ -0,0 +1,95 @@
+﻿#pragma once
+
+#ifndef PARAMETRICSOLVER_HXX
+#define PARAMETRICSOLVER_HXX
+
+
+#include <stdexcept>
+#include <utility>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "parametricsolution.hxx"
+#include "simplexsolver.hxx"
+#include "simplexstatistics.hxx"
+#include "simplextableau.hxx"
+#include "solutiontype.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::real_t;
+  using std::invalid_argument;
+  using std::pair;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The ParametricSolver class
+   * Solves the program along the ray
+   *   β(t) == β + t * δ   or   c(t) == c + t * γ,   t in [t0; t1],
+   * i.e. it solves the program for `t0' once, then follows the optimal
+   * basis as `t' grows: the basis only changes at the breakpoints, where
+   * one pivot of the dual (for `β') or primal (for `c') Simplex method
+   * makes it optimal again.
+   */
+  class ParametricSolver
+  {
+    public:
+      using Result = pair<SolutionType, optional<ParametricSolution<T>>>;
+
+
+      ParametricSolver() = default;
+
+      explicit ParametricSolver(
+        const LinearProgramData<T>& linearProgramData
+      );
+      explicit ParametricSolver(LinearProgramData<T>&& linearProgramData);
+
+      const LinearProgramData<T>& linearProgramData() const;
+
+      void setLinearProgramData(const LinearProgramData<T>& linearProgramData);
+      void setLinearProgramData(LinearProgramData<T>&& linearProgramData);
+
+      const SimplexStatistics& statistics() const;
+
+      Result sweepRHS(
+        const Matrix<T, Dynamic, 1>& direction,
+        const T& lowerParameter, const T& upperParameter
+      ) throw(invalid_argument);
+
+      Result sweepObjective(
+        const Matrix<T, 1, Dynamic>& direction,
+        const T& lowerParameter, const T& upperParameter
+      ) throw(invalid_argument);
+
+
+    private:
+      LinearProgramData<T> linearProgramData_;
+
+      /**
+       * @brief simplexSolver_
+       * Pivots the tableau, its program is not used.
+       */
+      SimplexSolver<T> simplexSolver_;
+
+      optional<SimplexTableau<T>> tableau_;
+
+
+      static T snapParameter(const T& parameter, const T& lowerParameter);
+
+      void addBreakpoint(const T& parameter, ParametricSolution<T>& solution);
+  };
+}
+
+
+#include "parametricsolver.txx"
+
+
+#endif // PARAMETRICSOLVER_HXX
@@ -0,0 +1,481 @@
+﻿#pragma once
+
+#ifndef PARAMETRICSOLVER_TXX
+#define PARAMETRICSOLVER_TXX
+
+
+#include "parametricsolver.hxx"
+
+#include <stdexcept>
+#include <utility>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "linearprogrammingutils.hxx"
+#include "parametricsolution.hxx"
+#include "simplexsolver.hxx"
+#include "simplexstatistics.hxx"
+#include "simplextableau.hxx"
+#include "solutiontype.hxx"
+#include "../math/mathutils.hxx"
+#include "../misc/eigenextensions.hxx"
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using namespace Config::LinearProgramming;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using LinearProgrammingUtils::reducedRowEchelonForm;
+  using LinearProgrammingUtils::RREF;
+  using MathUtils::isEqual;
+  using MathUtils::isLessThan;
+  using MathUtils::isLessThanZero;
+  using std::invalid_argument;
+
+
+  template<typename T>
+  /**
+   * @brief ParametricSolver<T>::ParametricSolver
+   * @param linearProgramData The program at (t == 0).
+   */
+  ParametricSolver<T>::ParametricSolver(
+    const LinearProgramData<T>& linearProgramData
+  ) :
+    linearProgramData_(linearProgramData)
+  { }
+
+
+  template<typename T>
+  /**
+   * @brief ParametricSolver<T>::ParametricSolver
+   * @param linearProgramData The program at (t == 0).
+   */
+  ParametricSolver<T>::ParametricSolver(
+    LinearProgramData<T>&& linearProgramData
+  ) :
+    linearProgramData_(std::move(linearProgramData))
+  { }
+
+
+  template<typename T>
+  const LinearProgramData<T>&
+  ParametricSolver<T>::linearProgramData() const
+  {
+    return linearProgramData_;
+  }
+
+
+  template<typename T>
+  void
+  ParametricSolver<T>::setLinearProgramData(
+    const LinearProgramData<T>& linearProgramData
+  )
+  {
+    linearProgramData_ = linearProgramData;
+  }
+
+
+  template<typename T>
+  void
+  ParametricSolver<T>::setLinearProgramData(
+    LinearProgramData<T>&& linearProgramData
+  )
+  {
+    linearProgramData_ = std::move(linearProgramData);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ParametricSolver<T>::statistics
+   * @return Counters of the last sweep, including the pivots
+   * at the breakpoints.
+   */
+  const SimplexStatistics&
+  ParametricSolver<T>::statistics() const
+  {
+    return simplexSolver_.statistics();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ParametricSolver<T>::sweepRHS
+   * Follows the optimal basis of the program w/ (β + t * δ).
+   * The basic values move along (B^-1 * δ) as `t' grows, the breakpoint
+   * is where the first of them reaches (0): it leaves the basis by the
+   * dual ratio test, the program is infeasible further on if it can't.
+   * `F*(t)' is convex.
+   * @param direction `δ'.
+   * @param lowerParameter
+   * @param upperParameter
+   * @return The type of the program at `lowerParameter' and the solution
+   * if it is optimal there.
+   */
+  typename ParametricSolver<T>::Result
+  ParametricSolver<T>::sweepRHS(
+    const Matrix<T, Dynamic, 1>& direction,
+    const T& lowerParameter, const T& upperParameter
+  ) throw(invalid_argument)
+  {
+    if (direction.rows() != linearProgramData_.constraintsCount())
+    {
+      throw invalid_argument("`direction' doesn't fit the program");
+    }
+
+    if (upperParameter < lowerParameter)
+    {
+      throw invalid_argument("`upperParameter' < `lowerParameter'");
+    }
+
+    Result ret(SolutionType::Unknown, optional<ParametricSolution<T>>());
+
+    LinearProgramData<T> linearProgramData(linearProgramData_);
+    linearProgramData.constraintsRHS += direction * lowerParameter;
+
+    simplexSolver_.statistics_ = SimplexStatistics();
+    ret.first = simplexSolver_.solveTableau(linearProgramData, tableau_);
+    if (ret.first != SolutionType::Optimal)
+    {
+      return ret;
+    }
+
+    SimplexTableau<T>& tableau(*tableau_);
+    const DenseIndex basisSize(tableau.rows() - 1);
+    const DenseIndex rhsColIdx(tableau.cols() - 1);
+
+    //Direction of the basic values (α[., B] * Δβ == δ) and of `P0',
+    //it is pivoted along w/ the column `β' of the tableau
+    Matrix<T, Dynamic, Dynamic> system(
+      linearProgramData.constraintsCount(), basisSize + 1
+    );
+    for (DenseIndex i(0); i < basisSize; ++i)
+    {
+      system.col(i) =
+        linearProgramData.constraintsCoeffs.col(tableau.basicVars()[i]);
+    }
+    system.col(basisSize) = direction;
+
+    const RREF<T> rref(reducedRowEchelonForm<T>(system));
+
+    Matrix<T, Dynamic, 1> delta(tableau.rows());
+    delta(basisSize) = T(0);
+    for (DenseIndex i(0); i < basisSize; ++i)
+    {
+      delta(i) = rref.rref(i, basisSize);
+      delta(basisSize) -=
+        linearProgramData.objectiveFunctionCoeffs(tableau.basicVars()[i]) *
+        delta(i);
+    }
+
+    ParametricSolution<T> solution;
+    T parameter(lowerParameter);
+    addBreakpoint(parameter, solution);
+
+    //NOTE: `δ' out of the span of the basis columns breaks the redundant
+    //constraints, i.e. no other `t' is feasible
+    if (rref.rank > basisSize && isLessThan<T>(parameter, upperParameter))
+    {
+      solution.tailType = SolutionType::Infeasible;
+    }
+    else
+    {
+      while (isLessThan<T>(parameter, upperParameter))
+      {
+        //Ratio test: the basic variable to reach (0) first
+        optional<T> step;
+        DenseIndex rowIdx(-1);
+        for (DenseIndex i(0); i < basisSize; ++i)
+        {
+          if (isLessThanZero<T>(delta(i)))
+          {
+            const T value(
+              tableau(i, rhsColIdx) > T(0) ? tableau(i, rhsColIdx) : T(0)
+            );
+            const T ratio(value / (delta(i) * T(-1))); //!
+
+            if (!step || ratio < *step)
+            {
+              step = ratio;
+              rowIdx = i;
+            }
+          }
+        }
+
+        //NOTE: The breakpoint within the tolerance of the range end is
+        //snapped onto it, so there is no spurious segment past the end
+        if (!step || !isLessThan<T>(parameter + *step, upperParameter))
+        {
+          tableau.col(rhsColIdx) += delta * (upperParameter - parameter);
+          parameter = upperParameter;
+          addBreakpoint(parameter, solution);
+
+          break;
+        }
+
+        tableau.col(rhsColIdx) += delta * *step;
+        tableau(rowIdx, rhsColIdx) = T(0);
+        parameter = snapParameter(parameter + *step, lowerParameter);
+        addBreakpoint(parameter, solution);
+
+        //Dual ratio test: the free variable to replace the leaving one
+        optional<T> minRatio;
+        DenseIndex colIdx(-1);
+        for (DenseIndex j(0); j < rhsColIdx; ++j)
+        {
+          if (isLessThanZero<T>(tableau(rowIdx, j)))
+          {
+            const T ratio(
+              tableau(basisSize, j) / (tableau(rowIdx, j) * T(-1))
+            ); //!
+
+            if (!minRatio || ratio < *minRatio)
+            {
+              minRatio = ratio;
+              colIdx = j;
+            }
+          }
+        }
+
+        if (!minRatio)
+        {
+          solution.tailType = SolutionType::Infeasible;
+
+          break;
+        }
+
+        if (simplexSolver_.iterCount_ >= MaxSimplexIterations)
+        {
+          solution.tailType = SolutionType::Unknown;
+
+          break;
+        }
+
+        ++simplexSolver_.iterCount_;
+
+        //(new Δβ) as the column of the tableau (see `pivot')
+        delta(rowIdx) /= tableau(rowIdx, colIdx); //!
+        for (DenseIndex i(0); i < tableau.rows(); ++i)
+        {
+          if (i != rowIdx)
+          {
+            delta(i) -= tableau(i, colIdx) * delta(rowIdx);
+          }
+        }
+
+        simplexSolver_.transformTableau(tableau, rowIdx, colIdx);
+      }
+    }
+
+    ret.second = std::move(solution);
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ParametricSolver<T>::sweepObjective
+   * Follows the optimal basis of the program w/ (c + t * γ).
+   * The reduced costs `P' move along (γ[N] - γ[B] * α[B, N]) as `t'
+   * grows, the breakpoint is where the first of them reaches (0):
+   * it enters the basis by the primal ratio test, the program is
+   * unbounded further on if it can't. `F*(t)' is concave.
+   * @param direction `γ'.
+   * @param lowerParameter
+   * @param upperParameter
+   * @return The type of the program at `lowerParameter' and the solution
+   * if it is optimal there.
+   */
+  typename ParametricSolver<T>::Result
+  ParametricSolver<T>::sweepObjective(
+    const Matrix<T, 1, Dynamic>& direction,
+    const T& lowerParameter, const T& upperParameter
+  ) throw(invalid_argument)
+  {
+    if (direction.cols() != linearProgramData_.variablesCount())
+    {
+      throw invalid_argument("`direction' doesn't fit the program");
+    }
+
+    if (upperParameter < lowerParameter)
+    {
+      throw invalid_argument("`upperParameter' < `lowerParameter'");
+    }
+
+    Result ret(SolutionType::Unknown, optional<ParametricSolution<T>>());
+
+    LinearProgramData<T> linearProgramData(linearProgramData_);
+    linearProgramData.objectiveFunctionCoeffs += direction * lowerParameter;
+
+    simplexSolver_.statistics_ = SimplexStatistics();
+    ret.first = simplexSolver_.solveTableau(linearProgramData, tableau_);
+    if (ret.first != SolutionType::Optimal)
+    {
+      return ret;
+    }
+
+    SimplexTableau<T>& tableau(*tableau_);
+    const DenseIndex basisSize(tableau.rows() - 1);
+    const DenseIndex rhsColIdx(tableau.cols() - 1);
+
+    //Direction of the row `P' (incl. `P0'), it is pivoted along w/ it
+    Matrix<T, 1, Dynamic> delta(tableau.cols());
+    for (DenseIndex j(0); j < rhsColIdx; ++j)
+    {
+      delta(j) = direction(tableau.freeVars()[j]);
+    }
+    delta(rhsColIdx) = T(0);
+    for (DenseIndex i(0); i < basisSize; ++i)
+    {
+      delta -= tableau.row(i) * direction(tableau.basicVars()[i]);
+    }
+
+    ParametricSolution<T> solution;
+    T parameter(lowerParameter);
+    addBreakpoint(parameter, solution);
+
+    while (isLessThan<T>(parameter, upperParameter))
+    {
+      //Ratio test: the reduced cost to reach (0) first
+      optional<T> step;
+      DenseIndex colIdx(-1);
+      for (DenseIndex j(0); j < rhsColIdx; ++j)
+      {
+        if (isLessThanZero<T>(delta(j)))
+        {
+          const T value(
+            tableau(basisSize, j) > T(0) ? tableau(basisSize, j) : T(0)
+          );
+          const T ratio(value / (delta(j) * T(-1))); //!
+
+          if (!step || ratio < *step)
+          {
+            step = ratio;
+            colIdx = j;
+          }
+        }
+      }
+
+      //NOTE: Snapped onto the range end as in `sweepRHS'
+      if (!step || !isLessThan<T>(parameter + *step, upperParameter))
+      {
+        tableau.row(basisSize) += delta * (upperParameter - parameter);
+        parameter = upperParameter;
+        addBreakpoint(parameter, solution);
+
+        break;
+      }
+
+      tableau.row(basisSize) += delta * *step;
+      tableau(basisSize, colIdx) = T(0);
+      parameter = snapParameter(parameter + *step, lowerParameter);
+      addBreakpoint(parameter, solution);
+
+      //Primal ratio test: the basic variable to make room for it
+      const MaybeIndex1D rowIdx(
+        simplexSolver_.computePivotRowIdx(tableau, colIdx)
+      );
+
+      if (!rowIdx)
+      {
+        solution.tailType = SolutionType::Unbounded;
+
+        break;
+      }
+
+      if (simplexSolver_.iterCount_ >= MaxSimplexIterations)
+      {
+        solution.tailType = SolutionType::Unknown;
+
+        break;
+      }
+
+      ++simplexSolver_.iterCount_;
+
+      //(new ΔP) as the row of the tableau (see `pivot')
+      const T pivotElement(tableau(*rowIdx, colIdx));
+      const T factor(delta(colIdx) / pivotElement); //!
+      for (DenseIndex j(0); j < tableau.cols(); ++j)
+      {
+        if (j != colIdx)
+        {
+          delta(j) -= factor * tableau(*rowIdx, j);
+        }
+      }
+      delta(colIdx) = factor * T(-1);
+
+      simplexSolver_.transformTableau(tableau, *rowIdx, colIdx);
+
+      //`x*' jumps to the vertex of the new basis
+      addBreakpoint(parameter, solution);
+    }
+
+    ret.second = std::move(solution);
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ParametricSolver<T>::snapParameter
+   * @param parameter
+   * @param lowerParameter
+   * @return `lowerParameter' if `parameter' is within the tolerance
+   * of it, `parameter' otherwise.
+   */
+  T
+  ParametricSolver<T>::snapParameter(
+    const T& parameter, const T& lowerParameter
+  )
+  {
+    return (isEqual<T>(parameter, lowerParameter) ? lowerParameter : parameter);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief ParametricSolver<T>::addBreakpoint
+   * Adds the current `x*' and `F*' of the tableau at `parameter',
+   * or replaces the last ones if they are at the same `t'.
+   * @param parameter
+   * @param solution
+   */
+  void
+  ParametricSolver<T>::addBreakpoint(
+    const T& parameter, ParametricSolution<T>& solution
+  )
+  {
+    if (
+      !solution.breakpoints.empty() &&
+      isEqual<T>(solution.breakpoints.back(), parameter)
+    )
+    {
+      tableau_->extremePoint(solution.extremePoints.back());
+      solution.extremeValues.back() = tableau_->extremeValue();
+    }
+    else
+    {
+      solution.breakpoints.push_back(parameter);
+      solution.extremePoints.push_back(tableau_->extremePoint());
+      solution.extremeValues.push_back(tableau_->extremeValue());
+    }
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `parametricsolver.cxx'
+  extern template class ParametricSolver<NumericTypes::real_t>;
+  extern template class ParametricSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // PARAMETRICSOLVER_TXX
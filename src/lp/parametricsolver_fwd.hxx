@@ -0,0 +1,14 @@
+﻿#pragma once
+
+#ifndef PARAMETRICSOLVER_FWD_HXX
+#define PARAMETRICSOLVER_FWD_HXX
+
+
+namespace LinearProgramming
+{
+  template<typename T>
+  class ParametricSolver;
+}
+
+
+#endif // PARAMETRICSOLVER_FWD_HXX
@@ -0,0 +1,12 @@
+﻿#include "plotdata2d.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class PlotData2D<NumericTypes::real_t>;
+  template class PlotData2D<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
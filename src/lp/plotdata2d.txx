@@ -12,6 +12,7 @@
 
 #include "linearprogramsolution.hxx"
 #include "../math/numerictypes.hxx"
+#include "../misc/eigenextensions.hxx"
 
 
 namespace LinearProgramming
@@ -67,6 +68,13 @@ namespace LinearProgramming
     gradientVector(std::move(gradientVector)),
     decisionVariables(std::move(decisionVariables))
   { }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `plotdata2d.cxx'
+  extern template class PlotData2D<NumericTypes::real_t>;
+  extern template class PlotData2D<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
 }
 
 
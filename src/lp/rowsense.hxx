@@ -0,0 +1,22 @@
+﻿#pragma once
+
+#ifndef ROWSENSE_HXX
+#define ROWSENSE_HXX
+
+
+namespace LinearProgramming
+{
+  /**
+   * @brief The RowSense enum
+   * Relation between the row activity `(α[i], x)' and its RHS `β[i]'.
+   */
+  enum struct RowSense : int
+  {
+    Equal = 0,
+    LessThanOrEqual = 1,
+    GreaterThanOrEqual = 2
+  };
+}
+
+
+#endif // ROWSENSE_HXX
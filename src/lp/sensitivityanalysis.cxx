@@ -0,0 +1,12 @@
+﻿#include "sensitivityanalysis.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template struct SensitivityAnalysis<NumericTypes::real_t>;
+  template struct SensitivityAnalysis<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
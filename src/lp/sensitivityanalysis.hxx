@@ -0,0 +1,86 @@
+﻿#pragma once
+
+#ifndef SENSITIVITYANALYSIS_HXX
+#define SENSITIVITYANALYSIS_HXX
+
+
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "simplextableau_fwd.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::real_t;
+  using std::vector;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The SensitivityAnalysis struct
+   * Dual values and ranging of the optimal solution of the program
+   *   min (c, x), αx == β, x >= 0,
+   * i.e. how `F*' depends on `c' and `β' while the optimal basis stays
+   * the same. The limits are `none' where they are infinite.
+   */
+  struct SensitivityAnalysis
+  {
+    static optional<SensitivityAnalysis<T>> make(
+      const LinearProgramData<T>& linearProgramData,
+      const SimplexTableau<T>& tableau
+    );
+
+
+    /**
+     * @brief shadowPrices
+     * Dual values `y[i]' of the rows (∂F* / ∂β[i]), so that
+     * (y, α.col[j]) == c[j] for the basic variables.
+     */
+    Matrix<T, Dynamic, 1> shadowPrices;
+
+    /**
+     * @brief reducedCosts
+     * Reduced costs `d[j]' of the variables (∂F* / ∂x[j]),
+     * (0) for the basic ones.
+     */
+    Matrix<T, Dynamic, 1> reducedCosts;
+
+    /**
+     * @brief objectiveLowerLimits
+     * Lower limits of `c[j]' the basis stays optimal for.
+     */
+    vector<optional<T>> objectiveLowerLimits;
+
+    /**
+     * @brief objectiveUpperLimits
+     * Upper limits of `c[j]' the basis stays optimal for.
+     */
+    vector<optional<T>> objectiveUpperLimits;
+
+    /**
+     * @brief rhsLowerLimits
+     * Lower limits of `β[i]' the basis stays feasible for.
+     */
+    vector<optional<T>> rhsLowerLimits;
+
+    /**
+     * @brief rhsUpperLimits
+     * Upper limits of `β[i]' the basis stays feasible for.
+     */
+    vector<optional<T>> rhsUpperLimits;
+  };
+}
+
+
+#include "sensitivityanalysis.txx"
+
+
+#endif // SENSITIVITYANALYSIS_HXX
@@ -0,0 +1,272 @@
+﻿#pragma once
+
+#ifndef SENSITIVITYANALYSIS_TXX
+#define SENSITIVITYANALYSIS_TXX
+
+
+#include "sensitivityanalysis.hxx"
+
+#include <vector>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+
+#include "linearprogramdata.hxx"
+#include "simplextableau.hxx"
+#include "../math/mathutils.hxx"
+#include "../misc/eigenextensions.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using MathUtils::absoluteValue;
+  using MathUtils::isEqualToZero;
+  using MathUtils::isGreaterThan;
+  using std::vector;
+
+
+  template<typename T>
+  /**
+   * @brief SensitivityAnalysis<T>::make
+   * Computes the analysis from the optimal Phase-2 tableau of the program
+   * in one pass:
+   *   `d' is the bottom row `P' of the tableau,
+   *   the limits of `c[j]' of the free variable are [c[j] - d[j]; +∞),
+   *   the ones of the basic variable of the row `i' are where
+   * (d[s] - δ * α[i, s] >= 0) for all the free variables `s'.
+   * The condensed tableau has no columns of the basis inverse `B^-1',
+   * so it is computed by the Gauss-Jordan elimination of the basis
+   * columns of `α' (w/ the identity appended):
+   *   y == (B^-1)^T * c[B],
+   *   the limits of `β[i]' are where (β(B) + δ * B^-1.col[i] >= 0).
+   * The rows of the redundant constraints (see `transformToPhaseTwo')
+   * are the combinations of the others, so their `β[i]' (and the ones
+   * of the rows they depend on) can't change: both limits are `β[i]'.
+   * @param linearProgramData The program the tableau is optimal for.
+   * @param tableau
+   * @return (optional) The analysis, `none' if the basis turns out
+   * singular (due to the rounding errors).
+   */
+  optional<SensitivityAnalysis<T>>
+  SensitivityAnalysis<T>::make(
+    const LinearProgramData<T>& linearProgramData,
+    const SimplexTableau<T>& tableau
+  )
+  {
+    optional<SensitivityAnalysis<T>> ret;
+
+    const DenseIndex rowsCount(linearProgramData.constraintsCount());
+    const DenseIndex varsCount(linearProgramData.variablesCount());
+    const DenseIndex basisSize(tableau.rows() - 1);
+    const DenseIndex rhsColIdx(tableau.cols() - 1);
+
+    //Invert the basis: [B | I] ~ [I | B^-1] for the pivot rows,
+    //the rest of the rows are [0 | z], where (z^T * B == 0)
+    Matrix<T, Dynamic, Dynamic> inverse(rowsCount, basisSize + rowsCount);
+    for (DenseIndex i(0); i < basisSize; ++i)
+    {
+      inverse.col(i) =
+        linearProgramData.constraintsCoeffs.col(tableau.basicVars()[i]);
+    }
+    inverse.rightCols(rowsCount).setIdentity();
+
+    vector<DenseIndex> pivotRows(basisSize);
+    vector<bool> isPivotRow(rowsCount, false);
+
+    for (DenseIndex i(0); i < basisSize; ++i)
+    {
+      //The largest pivot is taken
+      DenseIndex pivotRowIdx(-1);
+      T maxPivot(0);
+      for (DenseIndex k(0); k < rowsCount; ++k)
+      {
+        const T pivot(absoluteValue<T>(inverse(k, i)));
+        if (!isPivotRow[k] && isGreaterThan<T>(pivot, maxPivot))
+        {
+          maxPivot = pivot;
+          pivotRowIdx = k;
+        }
+      }
+
+      if (pivotRowIdx < 0)
+      {
+        return ret;
+      }
+
+      isPivotRow[pivotRowIdx] = true;
+      pivotRows[i] = pivotRowIdx;
+
+      inverse.row(pivotRowIdx) /= inverse(pivotRowIdx, i); //!
+      for (DenseIndex k(0); k < rowsCount; ++k)
+      {
+        const T factor(inverse(k, i));
+        if (k != pivotRowIdx && factor != T(0))
+        {
+          inverse.row(k) -= inverse.row(pivotRowIdx) * factor;
+        }
+      }
+    }
+
+    //`β[k]' is fixed if it is in any of the combinations (z[k] != 0)
+    vector<bool> isFixedRow(rowsCount, false);
+    for (DenseIndex q(0); q < rowsCount; ++q)
+    {
+      if (!isPivotRow[q])
+      {
+        for (DenseIndex k(0); k < rowsCount; ++k)
+        {
+          isFixedRow[k] = (
+            isFixedRow[k] || !isEqualToZero<T>(inverse(q, basisSize + k))
+          );
+        }
+      }
+    }
+
+    SensitivityAnalysis<T> analysis;
+
+    //Dual values `y'
+    analysis.shadowPrices = Matrix<T, Dynamic, 1>::Zero(rowsCount);
+    for (DenseIndex i(0); i < basisSize; ++i)
+    {
+      analysis.shadowPrices +=
+        inverse.row(pivotRows[i]).tail(rowsCount).transpose() *
+        linearProgramData.objectiveFunctionCoeffs(tableau.basicVars()[i]);
+    }
+
+    //Reduced costs `d' and the limits of `c' of the free variables
+    analysis.reducedCosts = Matrix<T, Dynamic, 1>::Zero(varsCount);
+    analysis.objectiveLowerLimits.assign(varsCount, optional<T>());
+    analysis.objectiveUpperLimits.assign(varsCount, optional<T>());
+
+    for (DenseIndex j(0); j < rhsColIdx; ++j)
+    {
+      const DenseIndex varIdx(tableau.freeVars()[j]);
+      const T& reducedCost(tableau(basisSize, j));
+
+      analysis.reducedCosts(varIdx) = reducedCost;
+      analysis.objectiveLowerLimits[varIdx] =
+        linearProgramData.objectiveFunctionCoeffs(varIdx) - reducedCost;
+    }
+
+    //Limits of `c' of the basic variables: (d[s] - δ * α[i, s] >= 0)
+    for (DenseIndex i(0); i < basisSize; ++i)
+    {
+      const DenseIndex varIdx(tableau.basicVars()[i]);
+      const T& coeff(linearProgramData.objectiveFunctionCoeffs(varIdx));
+
+      optional<T> minDelta;
+      optional<T> maxDelta;
+      for (DenseIndex j(0); j < rhsColIdx; ++j)
+      {
+        const T& entry(tableau(i, j));
+        if (isEqualToZero<T>(entry))
+        {
+          continue;
+        }
+
+        const T delta(tableau(basisSize, j) / entry); //!
+        if (entry > T(0))
+        {
+          if (!maxDelta || delta < *maxDelta)
+          {
+            maxDelta = delta;
+          }
+        }
+        else
+        {
+          if (!minDelta || delta > *minDelta)
+          {
+            minDelta = delta;
+          }
+        }
+      }
+
+      if (minDelta)
+      {
+        analysis.objectiveLowerLimits[varIdx] = coeff + *minDelta;
+      }
+      if (maxDelta)
+      {
+        analysis.objectiveUpperLimits[varIdx] = coeff + *maxDelta;
+      }
+    }
+
+    //Limits of `β': (β[i] + δ * B^-1[i, k] >= 0) for all the rows `i'
+    analysis.rhsLowerLimits.assign(rowsCount, optional<T>());
+    analysis.rhsUpperLimits.assign(rowsCount, optional<T>());
+
+    for (DenseIndex k(0); k < rowsCount; ++k)
+    {
+      const T& rhs(linearProgramData.constraintsRHS(k));
+
+      if (isFixedRow[k])
+      {
+        analysis.rhsLowerLimits[k] = rhs;
+        analysis.rhsUpperLimits[k] = rhs;
+
+        continue;
+      }
+
+      optional<T> minDelta;
+      optional<T> maxDelta;
+      for (DenseIndex i(0); i < basisSize; ++i)
+      {
+        const T& entry(inverse(pivotRows[i], basisSize + k));
+        if (isEqualToZero<T>(entry))
+        {
+          continue;
+        }
+
+        //NOTE: The rounding errors in place of the zero `β[i]'
+        //(e.g. -1E-16) must not move the limit past `β[k]'
+        const T value(
+          isEqualToZero<T>(tableau(i, rhsColIdx)) ?
+          T(0) : tableau(i, rhsColIdx)
+        );
+        const T delta(value * T(-1) / entry); //!
+
+        if (entry > T(0))
+        {
+          if (!minDelta || delta > *minDelta)
+          {
+            minDelta = delta;
+          }
+        }
+        else
+        {
+          if (!maxDelta || delta < *maxDelta)
+          {
+            maxDelta = delta;
+          }
+        }
+      }
+
+      if (minDelta)
+      {
+        analysis.rhsLowerLimits[k] = rhs + *minDelta;
+      }
+      if (maxDelta)
+      {
+        analysis.rhsUpperLimits[k] = rhs + *maxDelta;
+      }
+    }
+
+    ret = std::move(analysis);
+
+    return ret;
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `sensitivityanalysis.cxx'
+  extern template struct SensitivityAnalysis<NumericTypes::real_t>;
+  extern template struct SensitivityAnalysis<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // SENSITIVITYANALYSIS_TXX
@@ -0,0 +1,12 @@
+﻿#include "simplexsolver.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class SimplexSolver<NumericTypes::real_t>;
+  template class SimplexSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
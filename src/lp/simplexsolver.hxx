@@ -7,6 +7,8 @@
 #include <cstdint>
 
 #include <map>
+#include <memory>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -14,9 +16,20 @@
 #include "eigen3/Eigen/Core"
 
 #include "simplexsolvercontroller_fwd.hxx"
+#include "packedsimplexsolver_fwd.hxx"
+#include "parametricsolver_fwd.hxx"
+#include "multirhssolver_fwd.hxx"
+#include "columngenerator_fwd.hxx"
+#include "basiscache.hxx"
+#include "cycledetector.hxx"
+#include "degeneracystrategy.hxx"
+#include "dualizationmode.hxx"
 #include "isolver.hxx"
 #include "linearprogramdata.hxx"
+#include "rowsense.hxx"
+#include "simplexstatistics.hxx"
 #include "simplextableau_fwd.hxx"
+#include "simplexworkspace.hxx"
 #include "solutiontype.hxx"
 #include "../math/numerictypes.hxx"
 #include "../config.hxx"
@@ -31,7 +44,10 @@ namespace LinearProgramming
   using Eigen::Matrix;
   using NumericTypes::rational_t;
   using NumericTypes::real_t;
+  using std::invalid_argument;
   using std::pair;
+  using std::shared_ptr;
+  using std::vector;
 
   using MaybeIndex2D = optional<pair<DenseIndex, DenseIndex>>;
   using MaybeIndex1D = optional<DenseIndex>;
@@ -44,6 +60,14 @@ namespace LinearProgramming
     public:
       friend SimplexSolverController<T>;
 
+      friend PackedSimplexSolver<T>;
+
+      friend ParametricSolver<T>;
+
+      friend MultiRHSSolver<T>;
+
+      friend ColumnGenerator<T>;
+
 
       SimplexSolver() = default;
 
@@ -57,20 +81,173 @@ namespace LinearProgramming
       void setLinearProgramData(const LinearProgramData<T>& linearProgramData);
       void setLinearProgramData(LinearProgramData<T>&& linearProgramData);
 
+      const shared_ptr<BasisCache>& basisCache() const;
+
+      void setBasisCache(const shared_ptr<BasisCache>& basisCache);
+
+      DegeneracyStrategy degeneracyStrategy() const;
+
+      void setDegeneracyStrategy(DegeneracyStrategy degeneracyStrategy);
+
+      DualizationMode dualizationMode() const;
+
+      void setDualizationMode(DualizationMode dualizationMode);
+
+      bool isSensitivityAnalysisEnabled() const;
+
+      void setSensitivityAnalysisEnabled(bool isEnabled);
+
+      const SimplexStatistics& statistics() const;
+
       virtual pair<SolutionType, optional<LinearProgramSolution<T>>>
       solve() override;
 
+      SolutionType solve(LinearProgramSolution<T>& linearProgramSolution);
+
+      SolutionType addConstraint(
+        const Matrix<T, 1, Dynamic>& coeffs, RowSense sense, const T& rhs,
+        LinearProgramSolution<T>& linearProgramSolution
+      ) throw(invalid_argument);
+
+      SolutionType removeConstraint(
+        DenseIndex rowIdx, LinearProgramSolution<T>& linearProgramSolution
+      ) throw(invalid_argument);
+
+      SolutionType removeVariable(
+        DenseIndex varIdx, LinearProgramSolution<T>& linearProgramSolution
+      ) throw(invalid_argument);
+
+      SolutionType setConstraintRHS(
+        DenseIndex rowIdx, const T& rhs,
+        LinearProgramSolution<T>& linearProgramSolution
+      ) throw(invalid_argument);
+
+      SolutionType addVariable(
+        const Matrix<T, Dynamic, 1>& coeffs, const T& objectiveFunctionCoeff,
+        LinearProgramSolution<T>& linearProgramSolution
+      ) throw(invalid_argument);
+
 
     private:
       LinearProgramData<T> linearProgramData_;
 
+      shared_ptr<BasisCache> basisCache_;
+
+      SimplexWorkspace<T> workspace_;
+
+      CycleDetector cycleDetector_;
+
+      DegeneracyStrategy degeneracyStrategy_ = DegeneracyStrategy::None;
+
+      DualizationMode dualizationMode_ = DualizationMode::Never;
+
+      /**
+       * @brief isDualized_
+       * `true' while `linearProgramData_' is the dual of the given program.
+       */
+      bool isDualized_ = false;
+
+      bool isSensitivityAnalysisEnabled_ = false;
+
+      SimplexStatistics statistics_;
+
+      /**
+       * @brief isPerturbed_
+       * `true' while `β' of `linearProgramData_' is perturbed,
+       * `perturbation_' is `δ' and `unperturbedRHS_' is the original `β'.
+       */
+      bool isPerturbed_ = false;
+
+      Matrix<T, Dynamic, 1> perturbation_;
+
+      Matrix<T, Dynamic, 1> unperturbedRHS_;
+
+      /**
+       * @brief lexicographicVars_
+       * Basic variables at the start of `optimize' (the order of
+       * the lexicographic rule), empty unless the rule is in use.
+       */
+      vector<DenseIndex> lexicographicVars_;
+
+      /**
+       * @brief varsPositions_
+       * Maps the variables to the columns `j' (if free)
+       * or to (-1 - i) for the rows `i' (if basic) of the tableau.
+       */
+      vector<DenseIndex> varsPositions_;
+
+      /**
+       * @brief isTableauOptimal_
+       * `true' while the tableau in `workspace_' is the optimal Phase-2
+       * tableau of `linearProgramData_', so the edits start from it.
+       */
+      bool isTableauOptimal_ = false;
+
+      /**
+       * @brief basisInverse_
+       * `B^-1' of that tableau w/ (-c[B] * B^-1) below, i.e. it maps `β'
+       * to the column `β' of the tableau. It is computed by the first edit
+       * and transformed by every pivot while it is not empty.
+       */
+      Matrix<T, Dynamic, Dynamic> basisInverse_;
+
       uint16_t iterCount_;
 
 
       void reset();
 
+      SimplexTableau<T>* editableTableau();
+
+      MaybeIndex1D computeDriveOutColIdx(
+        const SimplexTableau<T>& tableau, DenseIndex rowIdx
+      ) const;
+
+      void discardTableau();
+
+      SolutionType reoptimize(
+        SimplexTableau<T>& tableau,
+        LinearProgramSolution<T>& linearProgramSolution
+      );
+
+      SimplexTableau<T>* makeWarmTableau(const vector<DenseIndex>& basicVars);
+
+      bool isDualCheaper() const;
+
+      SolutionType solveDual(LinearProgramSolution<T>& linearProgramSolution);
+
+      void recoverPrimalSolution(
+        const SimplexTableau<T>& tableau,
+        LinearProgramSolution<T>& linearProgramSolution
+      ) const;
+
+      SolutionType solveWithStrategy(
+        LinearProgramSolution<T>& linearProgramSolution
+      );
+
+      SolutionType solveProgram(
+        LinearProgramSolution<T>& linearProgramSolution
+      );
+
+      SolutionType solveTableau(
+        const LinearProgramData<T>& linearProgramData,
+        optional<SimplexTableau<T>>& tableau
+      );
+
+      void perturb();
+
+      void removePerturbation(SimplexTableau<T>& tableau);
+
+      void restoreRHS();
+
+      SolutionType solvePhaseTwo(
+        SimplexTableau<T>& tableau, const optional<BasisCache::Key>& basisKey,
+        LinearProgramSolution<T>& linearProgramSolution
+      );
+
       SolutionType optimize(SimplexTableau<T>& tableau);
 
+      SolutionType dualOptimize(SimplexTableau<T>& tableau);
+
       SolutionType iterate(SimplexTableau<T>& tableau);
 
       SolutionType iterate(
@@ -88,6 +265,14 @@ namespace LinearProgramming
         const SimplexTableau<T>& tableau, DenseIndex pivotColIdx
       ) const;
 
+      bool isLexicographicallyLess(
+        const SimplexTableau<T>& tableau, DenseIndex pivotColIdx,
+        DenseIndex rowIdx, DenseIndex minRowIdx
+      ) const;
+
+      pair<SolutionType, MaybeIndex2D>
+      computeDualPivotIdx(const SimplexTableau<T>& tableau) const;
+
       void transformTableau(
         SimplexTableau<T>& tableau, DenseIndex rowIdx, DenseIndex colIdx
       );
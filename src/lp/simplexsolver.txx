@@ -9,17 +9,21 @@
 #include <algorithm>
 #include <functional>
 #include <iostream>
-#include <list>
+#include <memory>
+#include <random>
 #include <utility>
 #include <vector>
 
-#include <QDebug>
-
 #include "boost/optional.hpp"
 #include "eigen3/Eigen/Core"
 
+#include "basiscache.hxx"
 #include "linearprogramdata.hxx"
+#include "linearprogrammingutils.hxx"
 #include "linearprogramsolution.hxx"
+#include "optimizationgoaltype.hxx"
+#include "rowsense.hxx"
+#include "sensitivityanalysis.hxx"
 #include "simplextableau.hxx"
 #include "solutiontype.hxx"
 #include "../math/mathutils.hxx"
@@ -36,18 +40,24 @@ namespace LinearProgramming
   using Eigen::DenseIndex;
   using Eigen::Dynamic;
   using Eigen::Matrix;
+  using LinearProgrammingUtils::reducedRowEchelonForm;
+  using LinearProgrammingUtils::RREF;
+  using MathUtils::absoluteValue;
   using MathUtils::isEqual;
   using MathUtils::isEqualToZero;
-  using MathUtils::isGreaterThanOrEqualToZero;
+  using MathUtils::isGreaterThan;
   using MathUtils::isGreaterThanZero;
   using MathUtils::isLessThan;
   using MathUtils::isLessThanZero;
+  using NumericTypes::integer_t;
   using NumericTypes::rational_t;
   using NumericTypes::real_t;
-  using std::list;
+  using std::invalid_argument;
   using std::make_pair;
   using std::pair;
   using std::ref;
+  using std::shared_ptr;
+  using std::vector;
   using Utils::makeString;
 
 
@@ -123,6 +133,7 @@ namespace LinearProgramming
   )
   {
     linearProgramData_ = linearProgramData;
+    discardTableau();
   }
 
 
@@ -137,6 +148,7 @@ namespace LinearProgramming
   )
   {
     linearProgramData_ = std::move(linearProgramData);
+    discardTableau();
   }
 
 
@@ -164,12 +176,41 @@ namespace LinearProgramming
   pair<SolutionType, optional<LinearProgramSolution<T>>>
   SimplexSolver<T>::solve()
   {
-    //Reset internal state
-    reset();
-
     //For result
     optional<LinearProgramSolution<T>> ret;
 
+    LinearProgramSolution<T> linearProgramSolution;
+    const SolutionType solutionType(solve(linearProgramSolution));
+
+    if (solutionType == SolutionType::Optimal)
+    {
+      ret = std::move(linearProgramSolution);
+    }
+
+    return make_pair(solutionType, std::move(ret));
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::solve
+   * Solves the program (see above) in the workspace of the solver.
+   * Neither the workspace nor `linearProgramSolution' are reallocated
+   * if the program is of the same size as the previous one, so nothing
+   * is allocated by the repeated solves (unless the basis cache is set).
+   * @param linearProgramSolution Solution to store the extreme point `x*'
+   * and the extreme value `F*' to, it is left unchanged unless
+   * the solution is optimal.
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::solve(LinearProgramSolution<T>& linearProgramSolution)
+  {
+    //Reset internal state
+    reset();
+    statistics_ = SimplexStatistics();
+    discardTableau();
+
     LOG(
       "c == \n{0},\nA ==\n{1},\nb ==\n{2}",
       linearProgramData_.objectiveFunctionCoeffs,
@@ -177,125 +218,1486 @@ namespace LinearProgramming
       linearProgramData_.constraintsRHS
     );
 
-    //Make a new Phase-1 tableau
-    SimplexTableau<T> phase1Tableau(
-      SimplexTableau<T>::makePhaseOne(linearProgramData_)
+    //NOTE: The automatic dualization is off when the sensitivity
+    //analysis is requested, as the dual tableau doesn't provide it
+    if (
+      dualizationMode_ == DualizationMode::Always ||
+      (
+        dualizationMode_ == DualizationMode::Automatic &&
+        !isSensitivityAnalysisEnabled_ && isDualCheaper()
+      )
+    )
+    {
+      const SolutionType dualSolutionType(solveDual(linearProgramSolution));
+
+      if (dualSolutionType == SolutionType::Optimal)
+      {
+        return SolutionType::Optimal;
+      }
+
+      //The program is infeasible if its dual is unbounded, but it is
+      //either infeasible or unbounded if its dual is infeasible
+      if (dualSolutionType == SolutionType::Unbounded)
+      {
+        return SolutionType::Infeasible;
+      }
+
+      LOG(
+        "Dual program is not solved after {0} iterations, "
+        "solving the given one",
+        iterCount_
+      );
+
+      reset();
+    }
+
+    return solveWithStrategy(linearProgramSolution);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::addConstraint
+   * Adds the constraint ((α[M], x) R β[M]) to the program and solves it
+   * starting from the optimal tableau of the last solve (or edit):
+   * the row of the new basic variable is expressed in terms of the basis,
+   * which stays dual feasible, so it only takes the dual Simplex method.
+   * The inequality gets its slack variable `x[N]' (w/ c[N] == 0),
+   * the equality is added w/ the artificial one, which is driven out
+   * of the basis right away.
+   * The program is solved from scratch if there is no such tableau.
+   * @param coeffs `α[M]'.
+   * @param sense `R'.
+   * @param rhs `β[M]'.
+   * @param linearProgramSolution Solution to store the result to
+   * (see `solve').
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::addConstraint(
+    const Matrix<T, 1, Dynamic>& coeffs, RowSense sense, const T& rhs,
+    LinearProgramSolution<T>& linearProgramSolution
+  ) throw(invalid_argument)
+  {
+    const DenseIndex rowsCount(linearProgramData_.constraintsCount());
+    const DenseIndex varsCount(linearProgramData_.variablesCount());
+
+    if (coeffs.cols() != varsCount)
+    {
+      throw invalid_argument("`coeffs' don't fit the program");
+    }
+
+    reset();
+    statistics_ = SimplexStatistics();
+
+    SimplexTableau<T>* const tableau(editableTableau());
+
+    //(α[M], x) + σ * x[N] == β[M]
+    const bool hasSlack(sense != RowSense::Equal);
+    const T slackCoeff(
+      sense == RowSense::GreaterThanOrEqual ? T(-1) : T(1)
     );
 
-    LOG(
-      "~X({0}) ==\n{1},\n~x == {2},\n x == {3}",
-      iterCount_,
-      phase1Tableau.entries(),
-      makeString(phase1Tableau.basicVars()),
-      makeString(phase1Tableau.freeVars())
+    linearProgramData_.constraintsCoeffs.conservativeResize(
+      rowsCount + 1, varsCount + (hasSlack ? 1 : 0)
+    );
+    linearProgramData_.constraintsCoeffs.row(rowsCount).head(varsCount) =
+      coeffs;
+    linearProgramData_.constraintsRHS.conservativeResize(rowsCount + 1);
+    linearProgramData_.constraintsRHS(rowsCount) = rhs;
+
+    if (hasSlack)
+    {
+      linearProgramData_.constraintsCoeffs.col(varsCount).setZero();
+      linearProgramData_.constraintsCoeffs(rowsCount, varsCount) = slackCoeff;
+      linearProgramData_.objectiveFunctionCoeffs.conservativeResize(
+        varsCount + 1
+      );
+      linearProgramData_.objectiveFunctionCoeffs(varsCount) = T(0);
+    }
+
+    if (tableau == nullptr)
+    {
+      return solve(linearProgramSolution);
+    }
+
+    //The row of `x[N]' is σ * (α[M] - α[M, B] * X) (where `X' are
+    //the rows of the tableau), so is its row of `B^-1'
+    const DenseIndex rhsColIdx(tableau->cols() - 1);
+
+    Matrix<T, 1, Dynamic> row(tableau->cols());
+    for (DenseIndex j(0); j < rhsColIdx; ++j)
+    {
+      row(j) = coeffs(tableau->freeVars()[j]);
+    }
+    row(rhsColIdx) = rhs;
+
+    Matrix<T, 1, Dynamic> inverseRow(
+      Matrix<T, 1, Dynamic>::Zero(rowsCount + 1)
+    );
+    inverseRow(rowsCount) = T(1);
+
+    for (DenseIndex i(0); i < rowsCount; ++i)
+    {
+      const T coeff(coeffs(tableau->basicVars()[i]));
+      if (coeff != T(0))
+      {
+        row -= tableau->row(i) * coeff;
+        inverseRow.head(rowsCount) -= basisInverse_.row(i) * coeff;
+      }
+    }
+
+    tableau->insertRow(varsCount, row * slackCoeff);
+
+    basisInverse_.conservativeResize(rowsCount + 2, rowsCount + 1);
+    basisInverse_.row(rowsCount + 1).head(rowsCount) =
+      basisInverse_.row(rowsCount).head(rowsCount);
+    basisInverse_.col(rowsCount).setZero();
+    basisInverse_.row(rowsCount) = inverseRow * slackCoeff;
+
+    //The artificial variable leaves the basis right away
+    if (!hasSlack)
+    {
+      const MaybeIndex1D pivotColIdx(
+        computeDriveOutColIdx(*tableau, rowsCount)
+      );
+
+      if (!pivotColIdx)
+      {
+        //If (∀s: α[M, s] == 0), the constraint is redundant
+        //(its row can't be kept w/o the artificial variable)
+        if (isEqualToZero<T>((*tableau)(rowsCount, rhsColIdx)))
+        {
+          return solve(linearProgramSolution);
+        }
+
+        discardTableau();
+
+        return SolutionType::Infeasible;
+      }
+
+      ++iterCount_;
+      transformTableau(*tableau, rowsCount, *pivotColIdx);
+      tableau->removeColumn(*pivotColIdx);
+    }
+
+    return reoptimize(*tableau, linearProgramSolution);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::removeConstraint
+   * Removes the constraint `i' from the program and solves it starting
+   * from the optimal tableau of the last solve (or edit): the variable
+   * (α[., u] == e[i], c[u] == 0) of either sign relaxes the constraint,
+   * it enters the basis by the ratio test (so the basis stays primal
+   * feasible), then its row is dropped along w/ it and it only takes
+   * the primal Simplex method.
+   * NOTE: The variables are kept, including the slack one (if any).
+   * The program is solved from scratch if there is no such tableau.
+   * @param rowIdx `i'.
+   * @param linearProgramSolution Solution to store the result to
+   * (see `solve').
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::removeConstraint(
+    DenseIndex rowIdx, LinearProgramSolution<T>& linearProgramSolution
+  ) throw(invalid_argument)
+  {
+    const DenseIndex rowsCount(linearProgramData_.constraintsCount());
+    const DenseIndex varsCount(linearProgramData_.variablesCount());
+
+    if (rowIdx < 0 || rowIdx >= rowsCount)
+    {
+      throw invalid_argument("`rowIdx' is out of range");
+    }
+
+    reset();
+    statistics_ = SimplexStatistics();
+
+    SimplexTableau<T>* const tableau(editableTableau());
+
+    for (DenseIndex i(rowIdx + 1); i < rowsCount; ++i)
+    {
+      linearProgramData_.constraintsCoeffs.row(i - 1) =
+        linearProgramData_.constraintsCoeffs.row(i);
+      linearProgramData_.constraintsRHS(i - 1) =
+        linearProgramData_.constraintsRHS(i);
+    }
+    linearProgramData_.constraintsCoeffs.conservativeResize(
+      rowsCount - 1, varsCount
+    );
+    linearProgramData_.constraintsRHS.conservativeResize(rowsCount - 1);
+
+    if (tableau == nullptr)
+    {
+      return solve(linearProgramSolution);
+    }
+
+    //The column of `u' is the one of `B^-1', it enters the basis in
+    //the direction where `F' decreases (or where it is bounded if `F'
+    //doesn't change)
+    Matrix<T, Dynamic, 1> column(basisInverse_.col(rowIdx));
+    if (
+      isGreaterThanZero<T>(column(rowsCount)) ||
+      (
+        isEqualToZero<T>(column(rowsCount)) &&
+        !column.head(rowsCount).unaryExpr(ref(isGreaterThanZero<T>)).any()
+      )
+    )
+    {
+      column *= T(-1);
+    }
+
+    const DenseIndex colIdx(tableau->cols() - 1);
+    tableau->insertColumn(varsCount, column);
+
+    const MaybeIndex1D pivotRowIdx(computePivotRowIdx(*tableau, colIdx));
+    if (!pivotRowIdx)
+    {
+      //If (∀i: α[i, u] <= 0) and (P[u] < 0), `F' is unbounded along `u'
+      discardTableau();
+
+      return SolutionType::Unbounded;
+    }
+
+    ++iterCount_;
+    transformTableau(*tableau, *pivotRowIdx, colIdx);
+
+    //`β[i]' only changes `u' now, so it is dropped from `B^-1' along w/
+    //the row of `u'
+    tableau->removeRow(*pivotRowIdx);
+
+    for (DenseIndex i(*pivotRowIdx + 1); i < basisInverse_.rows(); ++i)
+    {
+      basisInverse_.row(i - 1) = basisInverse_.row(i);
+    }
+    for (DenseIndex j(rowIdx + 1); j < basisInverse_.cols(); ++j)
+    {
+      basisInverse_.col(j - 1) = basisInverse_.col(j);
+    }
+    basisInverse_.conservativeResize(rowsCount, rowsCount - 1);
+
+    return reoptimize(*tableau, linearProgramSolution);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::removeVariable
+   * Removes the variable `x[j]' from the program and solves it starting
+   * from the optimal tableau of the last solve (or edit): the free one
+   * is just dropped (the basis stays optimal), the basic one is driven
+   * out of the basis as the artificial one (see `addConstraint') first,
+   * so it only takes the dual Simplex method.
+   * The next variables are shifted to fill the gap.
+   * The program is solved from scratch if there is no such tableau.
+   * @param varIdx `j'.
+   * @param linearProgramSolution Solution to store the result to
+   * (see `solve').
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::removeVariable(
+    DenseIndex varIdx, LinearProgramSolution<T>& linearProgramSolution
+  ) throw(invalid_argument)
+  {
+    const DenseIndex rowsCount(linearProgramData_.constraintsCount());
+    const DenseIndex varsCount(linearProgramData_.variablesCount());
+
+    if (varIdx < 0 || varIdx >= varsCount)
+    {
+      throw invalid_argument("`varIdx' is out of range");
+    }
+
+    reset();
+    statistics_ = SimplexStatistics();
+
+    SimplexTableau<T>* const tableau(editableTableau());
+
+    for (DenseIndex j(varIdx + 1); j < varsCount; ++j)
+    {
+      linearProgramData_.constraintsCoeffs.col(j - 1) =
+        linearProgramData_.constraintsCoeffs.col(j);
+      linearProgramData_.objectiveFunctionCoeffs(j - 1) =
+        linearProgramData_.objectiveFunctionCoeffs(j);
+    }
+    linearProgramData_.constraintsCoeffs.conservativeResize(
+      rowsCount, varsCount - 1
+    );
+    linearProgramData_.objectiveFunctionCoeffs.conservativeResize(
+      varsCount - 1
+    );
+
+    if (tableau == nullptr)
+    {
+      return solve(linearProgramSolution);
+    }
+
+    const auto basicVarIt(
+      std::find(
+        tableau->basicVars().cbegin(), tableau->basicVars().cend(), varIdx
+      )
+    );
+
+    if (basicVarIt != tableau->basicVars().cend())
+    {
+      const DenseIndex rowIdx(basicVarIt - tableau->basicVars().cbegin());
+      const MaybeIndex1D pivotColIdx(
+        computeDriveOutColIdx(*tableau, rowIdx)
+      );
+
+      if (!pivotColIdx)
+      {
+        //If (∀s: α[k, s] == 0), the variable is fixed at `β[k]'
+        //(w/o it the constraints are redundant if β[k] == 0)
+        if (isEqualToZero<T>((*tableau)(rowIdx, tableau->cols() - 1)))
+        {
+          return solve(linearProgramSolution);
+        }
+
+        discardTableau();
+
+        return SolutionType::Infeasible;
+      }
+
+      ++iterCount_;
+      transformTableau(*tableau, rowIdx, *pivotColIdx);
+    }
+
+    const DenseIndex colIdx(
+      std::find(
+        tableau->freeVars().cbegin(), tableau->freeVars().cend(), varIdx
+      ) -
+      tableau->freeVars().cbegin()
+    );
+    tableau->removeColumn(colIdx);
+
+    for (DenseIndex& idx : tableau->basicVars())
+    {
+      if (idx > varIdx)
+      {
+        --idx;
+      }
+    }
+    for (DenseIndex& idx : tableau->freeVars())
+    {
+      if (idx > varIdx)
+      {
+        --idx;
+      }
+    }
+
+    return reoptimize(*tableau, linearProgramSolution);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::setConstraintRHS
+   * Sets `β[i]' of the program and solves it starting from the optimal
+   * tableau of the last solve (or edit): the column `β' of the tableau
+   * moves along the column `i' of `B^-1', the basis stays dual feasible,
+   * so it only takes the dual Simplex method.
+   * The program is solved from scratch if there is no such tableau.
+   * @param rowIdx `i'.
+   * @param rhs
+   * @param linearProgramSolution Solution to store the result to
+   * (see `solve').
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::setConstraintRHS(
+    DenseIndex rowIdx, const T& rhs,
+    LinearProgramSolution<T>& linearProgramSolution
+  ) throw(invalid_argument)
+  {
+    if (rowIdx < 0 || rowIdx >= linearProgramData_.constraintsCount())
+    {
+      throw invalid_argument("`rowIdx' is out of range");
+    }
+
+    reset();
+    statistics_ = SimplexStatistics();
+
+    SimplexTableau<T>* const tableau(editableTableau());
+
+    const T delta(rhs - linearProgramData_.constraintsRHS(rowIdx));
+    linearProgramData_.constraintsRHS(rowIdx) = rhs;
+
+    if (tableau == nullptr)
+    {
+      return solve(linearProgramSolution);
+    }
+
+    tableau->col(tableau->cols() - 1) += basisInverse_.col(rowIdx) * delta;
+
+    return reoptimize(*tableau, linearProgramSolution);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::addVariable
+   * Adds the variable `x[N]' to the program and solves it starting from
+   * the optimal tableau of the last solve (or edit): the column of `x[N]'
+   * is priced out by `B^-1', the basis stays primal feasible, so it only
+   * takes the primal Simplex method (if P[N] < 0).
+   * The program is solved from scratch if there is no such tableau.
+   * @param coeffs `α[., N]'.
+   * @param objectiveFunctionCoeff `c[N]'.
+   * @param linearProgramSolution Solution to store the result to
+   * (see `solve').
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::addVariable(
+    const Matrix<T, Dynamic, 1>& coeffs, const T& objectiveFunctionCoeff,
+    LinearProgramSolution<T>& linearProgramSolution
+  ) throw(invalid_argument)
+  {
+    const DenseIndex rowsCount(linearProgramData_.constraintsCount());
+    const DenseIndex varsCount(linearProgramData_.variablesCount());
+
+    if (coeffs.rows() != rowsCount)
+    {
+      throw invalid_argument("`coeffs' don't fit the program");
+    }
+
+    reset();
+    statistics_ = SimplexStatistics();
+
+    SimplexTableau<T>* const tableau(editableTableau());
+
+    linearProgramData_.constraintsCoeffs.conservativeResize(
+      rowsCount, varsCount + 1
+    );
+    linearProgramData_.constraintsCoeffs.col(varsCount) = coeffs;
+    linearProgramData_.objectiveFunctionCoeffs.conservativeResize(
+      varsCount + 1
+    );
+    linearProgramData_.objectiveFunctionCoeffs(varsCount) =
+      objectiveFunctionCoeff;
+
+    if (tableau == nullptr)
+    {
+      return solve(linearProgramSolution);
+    }
+
+    //(B^-1 * α[., N]) w/ (P[N] == c[N] - c[B] * B^-1 * α[., N]) below
+    Matrix<T, Dynamic, 1> column(basisInverse_ * coeffs);
+    column(rowsCount) += objectiveFunctionCoeff;
+
+    tableau->insertColumn(varsCount, column);
+
+    return reoptimize(*tableau, linearProgramSolution);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::isDualCheaper
+   * Estimates whether the dual program (see `LinearProgramData<T>::dual')
+   * is cheaper to solve than the given one. A pivot takes the time
+   * proportional to the size of the tableau, and a program takes about
+   * as many pivots as it has rows plus the artificial variables left
+   * in the basis after the crash (the rows not covered by the unit columns),
+   * so the dual is taken for the tall programs (M > 2.4N or so).
+   * NOTE: The estimate is pessimistic for the given program if most of its
+   * rows are redundant (rank(α) << M), it takes about rank(α) pivots then.
+   * @return
+   */
+  bool
+  SimplexSolver<T>::isDualCheaper() const
+  {
+    const auto& A(linearProgramData_.constraintsCoeffs);
+    const auto& b(linearProgramData_.constraintsRHS);
+    const auto& c(linearProgramData_.objectiveFunctionCoeffs);
+
+    const DenseIndex rowsCount(linearProgramData_.constraintsCount());
+    const DenseIndex colsCount(linearProgramData_.variablesCount());
+
+    //Rows of the given program covered by its unit columns and the ones
+    //of the dual program covered by the unit columns of `s', `y' or `y''
+    vector<bool> isRowCovered(rowsCount, false);
+    vector<bool> isDualRowCovered(colsCount, false);
+    vector<DenseIndex> rowNonZerosCounts(rowsCount, 0);
+    vector<DenseIndex> rowNonZeroIdxs(rowsCount, 0);
+
+    for (DenseIndex j(0); j < colsCount; ++j)
+    {
+      DenseIndex nonZerosCount(0);
+      DenseIndex rowIdx(0);
+
+      for (DenseIndex i(0); i < rowsCount; ++i)
+      {
+        if (!isEqualToZero<T>(A(i, j)))
+        {
+          ++nonZerosCount;
+          rowIdx = i;
+
+          ++rowNonZerosCounts[i];
+          rowNonZeroIdxs[i] = j;
+        }
+      }
+
+      //NOTE: The rows w/ (β[i] < 0) are multiplied by (-1)
+      if (
+        nonZerosCount == 1 &&
+        (
+          isLessThanZero<T>(b(rowIdx)) ?
+          isLessThanZero<T>(A(rowIdx, j)) :
+          isGreaterThanZero<T>(A(rowIdx, j))
+        )
+      )
+      {
+        isRowCovered[rowIdx] = true;
+      }
+
+      isDualRowCovered[j] = !isLessThanZero<T>(c(j));
+    }
+
+    for (DenseIndex i(0); i < rowsCount; ++i)
+    {
+      if (rowNonZerosCounts[i] == 1)
+      {
+        isDualRowCovered[rowNonZeroIdxs[i]] = true;
+      }
+    }
+
+    const auto estimateCost(
+      [](DenseIndex rows, DenseIndex cols, DenseIndex artificialVarsCount)
+      {
+        return (rows + 1) * (cols + 1) * (rows + artificialVarsCount);
+      }
+    );
+
+    const DenseIndex cost(
+      estimateCost(
+        rowsCount, colsCount,
+        std::count(isRowCovered.cbegin(), isRowCovered.cend(), false)
+      )
+    );
+    const DenseIndex dualCost(
+      estimateCost(
+        colsCount, 2 * rowsCount + colsCount,
+        std::count(isDualRowCovered.cbegin(), isDualRowCovered.cend(), false)
+      )
+    );
+
+    LOG("Estimated cost == {0}, dual == {1}", cost, dualCost);
+
+    return (dualCost < cost);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::solveDual
+   * Solves the dual program in place of the given one, the solution
+   * of the given program is recovered from the optimal tableau
+   * (see `recoverPrimalSolution').
+   * @param linearProgramSolution
+   * @return The solution type of the dual program.
+   */
+  SolutionType
+  SimplexSolver<T>::solveDual(LinearProgramSolution<T>& linearProgramSolution)
+  {
+    LinearProgramData<T> linearProgramData(linearProgramData_.dual());
+    std::swap(linearProgramData_, linearProgramData);
+    isDualized_ = true;
+
+    LOG(
+      "Dual program: c == \n{0},\nA ==\n{1},\nb ==\n{2}",
+      linearProgramData_.objectiveFunctionCoeffs,
+      linearProgramData_.constraintsCoeffs,
+      linearProgramData_.constraintsRHS
+    );
+
+    SolutionType ret(SolutionType::Unknown);
+    try
+    {
+      ret = solveWithStrategy(linearProgramSolution);
+    }
+    catch (...)
+    {
+      isDualized_ = false;
+      std::swap(linearProgramData_, linearProgramData);
+
+      throw;
+    }
+
+    isDualized_ = false;
+    std::swap(linearProgramData_, linearProgramData);
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::recoverPrimalSolution
+   * Stores the solution of the given program made of the optimal tableau
+   * of its dual (see `LinearProgramData<T>::dual'): `x*[j]' is the reduced
+   * cost `P[j]' of the slack variable `s[j]' of the dual program (zero if
+   * it is basic) and `F*' is the negated extreme value of the dual program.
+   * @param tableau
+   * @param linearProgramSolution
+   */
+  void
+  SimplexSolver<T>::recoverPrimalSolution(
+    const SimplexTableau<T>& tableau,
+    LinearProgramSolution<T>& linearProgramSolution
+  ) const
+  {
+    //Count of the variables of the given program (its dual has N rows)
+    const DenseIndex varsCount(linearProgramData_.constraintsCount());
+    //Index of `s[0]' (the variables of the dual are `y'', `y''' and `s')
+    const DenseIndex slackVarsIdx(
+      linearProgramData_.variablesCount() - varsCount
+    );
+
+    Matrix<T, Dynamic, 1>& x(linearProgramSolution.extremePoint);
+    x.resize(varsCount);
+    x.setZero();
+
+    for (DenseIndex j(0); j < tableau.cols() - 1; ++j)
+    {
+      const DenseIndex varIdx(tableau.freeVars()[j]);
+
+      if (varIdx >= slackVarsIdx)
+      {
+        const T& value(tableau(tableau.rows() - 1, j));
+
+        x(varIdx - slackVarsIdx) = (
+          value < T(0) && !isLessThanZero<T>(value) ? T(0) : value
+        );
+      }
+    }
+
+    linearProgramSolution.extremeValue =
+      tableau.extremeValue(OptimizationGoalType::Maximize);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::solveWithStrategy
+   * Solves `linearProgramData_' w/ the degeneracy strategy set
+   * (see `DegeneracyStrategy').
+   * @param linearProgramSolution
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::solveWithStrategy(
+    LinearProgramSolution<T>& linearProgramSolution
+  )
+  {
+    if (degeneracyStrategy_ != DegeneracyStrategy::Perturbation)
+    {
+      return solveProgram(linearProgramSolution);
+    }
+
+    perturb();
+
+    SolutionType ret(solveProgram(linearProgramSolution));
+
+    //The perturbation is removed from the optimal tableau only
+    if (isPerturbed_)
+    {
+      restoreRHS();
+
+      //The perturbed program is feasible if the original one is,
+      //but not vice versa, so the unbounded one is solved again
+      if (ret == SolutionType::Unbounded)
+      {
+        LOG(
+          "Perturbed program is unbounded after {0} iterations, "
+          "solving the original one",
+          iterCount_
+        );
+
+        reset();
+        ret = solveProgram(linearProgramSolution);
+      }
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::solveTableau
+   * Solves `linearProgramData' as `solve' does (w/o the warm starts
+   * and the strategies), keeping the optimal Phase-2 tableau in
+   * `tableau' for the solvers that pivot it further on.
+   * NOTE: `statistics_' is not reset, so the callers can sum it up
+   * over several solves.
+   * @param linearProgramData
+   * @param tableau Storage of the tableau, reused if present.
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::solveTableau(
+    const LinearProgramData<T>& linearProgramData,
+    optional<SimplexTableau<T>>& tableau
+  )
+  {
+    reset();
+
+    if (tableau)
+    {
+      SimplexTableau<T>::makePhaseOne(linearProgramData, *tableau);
+    }
+    else
+    {
+      tableau = SimplexTableau<T>::makePhaseOne(linearProgramData);
+    }
+
+    SimplexTableau<T>::crash(linearProgramData, *tableau);
+
+    SolutionType solutionType(optimize(*tableau));
+
+    if (solutionType == SolutionType::Unbounded)
+    {
+      return SolutionType::Unknown;
+    }
+
+    if (solutionType == SolutionType::Optimal)
+    {
+      solutionType = checkPhase1Solution(*tableau);
+    }
+
+    if (solutionType != SolutionType::Optimal)
+    {
+      return solutionType;
+    }
+
+    SimplexTableau<T>::transformToPhaseTwo(linearProgramData, *tableau);
+
+    solutionType = optimize(*tableau);
+    if (solutionType == SolutionType::Optimal)
+    {
+      solutionType = checkPhase2Solution(*tableau);
+    }
+
+    return solutionType;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::solveProgram
+   * Solves `linearProgramData_' as it is (see `solve').
+   * @param linearProgramSolution
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::solveProgram(
+    LinearProgramSolution<T>& linearProgramSolution
+  )
+  {
+    //Try the cached basis of the same-structured program first
+    optional<BasisCache::Key> basisKey;
+    if (basisCache_)
+    {
+      basisKey = BasisCache::makeKey(linearProgramData_);
+
+      const optional<vector<DenseIndex>> basicVars(
+        basisCache_->find(*basisKey)
+      );
+
+      if (basicVars)
+      {
+        SimplexTableau<T>* const phase2Tableau(makeWarmTableau(*basicVars));
+
+        if (phase2Tableau != nullptr)
+        {
+          LOG("Warm start from ~x == {0}", makeString(*basicVars));
+
+          return
+            solvePhaseTwo(*phase2Tableau, basisKey, linearProgramSolution);
+        }
+
+        LOG("Cached basis ~x == {0} is rejected", makeString(*basicVars));
+
+        reset();
+      }
+    }
+
+    //Make a new Phase-1 tableau
+    SimplexTableau<T>& phase1Tableau(
+      workspace_.makePhaseOne(linearProgramData_)
+    );
+
+    //Start from the crash basis (e.g. of the slack variables)
+    SimplexTableau<T>::crash(linearProgramData_, phase1Tableau);
+
+    LOG(
+      "~X({0}) ==\n{1},\n~x == {2},\n x == {3}",
+      iterCount_,
+      phase1Tableau.entries(),
+      makeString(phase1Tableau.basicVars()),
+      makeString(phase1Tableau.freeVars())
+    );
+
+    //Solve Phase-1: do `iterate()' while the solution is not optimal
+    const SolutionType phase1SolutionType(optimize(phase1Tableau));
+
+    LOG(
+      "~X({0}) ==\n{1},\n~x == {2},\n x == {3}",
+      iterCount_,
+      phase1Tableau.entries(),
+      makeString(phase1Tableau.basicVars()),
+      makeString(phase1Tableau.freeVars())
+    );
+
+    //NOTE: The Phase-1 program is bounded (~F >= 0), so it can only be
+    //"unbounded" due to the rounding errors (e.g. P[s] == -1E-9)
+    if (phase1SolutionType == SolutionType::Unbounded)
+    {
+      return SolutionType::Unknown;
+    }
+
+    if (phase1SolutionType == SolutionType::Optimal)
+    {
+      //Recheck Phase-1 solution (~F* == 0) and try to solve the Phase-2
+      const SolutionType phase1SolutionType(
+        checkPhase1Solution(phase1Tableau)
+      );
+
+      if (phase1SolutionType == SolutionType::Optimal)
+      {
+        ++iterCount_;
+
+        SimplexTableau<T>& phase2Tableau(
+          workspace_.makePhaseTwo(linearProgramData_)
+        );
+
+        return solvePhaseTwo(phase2Tableau, basisKey, linearProgramSolution);
+      }
+      else
+      {
+        return phase1SolutionType;
+      }
+    }
+    else
+    {
+      return phase1SolutionType;
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::basisCache
+   * @return The cache of the optimal bases, `nullptr' if warm starts
+   * are disabled.
+   */
+  const shared_ptr<BasisCache>&
+  SimplexSolver<T>::basisCache() const
+  {
+    return basisCache_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::setBasisCache
+   * Enables the warm starts: the optimal basis of the program solved
+   * before whose constraints have the same structure is tried first.
+   * The optimal bases are stored to `basisCache'.
+   * @param basisCache The cache (possibly shared by the other solvers),
+   * `nullptr' disables the warm starts.
+   */
+  void
+  SimplexSolver<T>::setBasisCache(const shared_ptr<BasisCache>& basisCache)
+  {
+    basisCache_ = basisCache;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::degeneracyStrategy
+   * @return
+   */
+  DegeneracyStrategy
+  SimplexSolver<T>::degeneracyStrategy() const
+  {
+    return degeneracyStrategy_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::setDegeneracyStrategy
+   * Sets the way the next solves deal w/ the degenerate pivots
+   * (see `DegeneracyStrategy').
+   * @param degeneracyStrategy
+   */
+  void
+  SimplexSolver<T>::setDegeneracyStrategy(
+    DegeneracyStrategy degeneracyStrategy
+  )
+  {
+    degeneracyStrategy_ = degeneracyStrategy;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::dualizationMode
+   * @return
+   */
+  DualizationMode
+  SimplexSolver<T>::dualizationMode() const
+  {
+    return dualizationMode_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::setDualizationMode
+   * Sets whether the next solves solve the dual program instead
+   * (see `DualizationMode').
+   * @param dualizationMode
+   */
+  void
+  SimplexSolver<T>::setDualizationMode(DualizationMode dualizationMode)
+  {
+    dualizationMode_ = dualizationMode;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::isSensitivityAnalysisEnabled
+   * @return
+   */
+  bool
+  SimplexSolver<T>::isSensitivityAnalysisEnabled() const
+  {
+    return isSensitivityAnalysisEnabled_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::setSensitivityAnalysisEnabled
+   * Sets whether the next optimal solutions come w/ the sensitivity
+   * analysis (see `SensitivityAnalysis'). It is never made for the
+   * solutions obtained through the dual program.
+   * @param isEnabled
+   */
+  void
+  SimplexSolver<T>::setSensitivityAnalysisEnabled(bool isEnabled)
+  {
+    isSensitivityAnalysisEnabled_ = isEnabled;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::statistics
+   * @return Counters of the last solve.
+   */
+  const SimplexStatistics&
+  SimplexSolver<T>::statistics() const
+  {
+    return statistics_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::reset
+   * Resets the internal state of the object.
+   */
+  void
+  SimplexSolver<T>::reset()
+  {
+    iterCount_ = 0;
+    cycleDetector_.reset();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::editableTableau
+   * Provides the optimal tableau of the last solve (or edit) to edit,
+   * computing `basisInverse_' of its basis if it is not yet:
+   *   [α[., B] | I] ~ [I | B^-1].
+   * @return The tableau, `nullptr' if there is none, or if it lacks
+   * the rows of the redundant constraints (then its basis is not
+   * the basis of the program, so the edited one is solved from scratch).
+   */
+  SimplexTableau<T>*
+  SimplexSolver<T>::editableTableau()
+  {
+    SimplexTableau<T>* const tableau(workspace_.tableau());
+    const DenseIndex rowsCount(linearProgramData_.constraintsCount());
+
+    if (
+      !isTableauOptimal_ || tableau == nullptr ||
+      DenseIndex(tableau->basicVarsCount()) != rowsCount
+    )
+    {
+      return nullptr;
+    }
+
+    if (basisInverse_.size() == 0)
+    {
+      Matrix<T, Dynamic, Dynamic> system(rowsCount, rowsCount * 2);
+      for (DenseIndex i(0); i < rowsCount; ++i)
+      {
+        system.col(i) =
+          linearProgramData_.constraintsCoeffs.col(tableau->basicVars()[i]);
+      }
+      system.rightCols(rowsCount).setIdentity();
+
+      const RREF<T> rref(reducedRowEchelonForm<T>(system));
+
+      basisInverse_.resize(rowsCount + 1, rowsCount);
+      basisInverse_.topRows(rowsCount) = rref.rref.rightCols(rowsCount);
+      basisInverse_.row(rowsCount).setZero();
+      for (DenseIndex i(0); i < rowsCount; ++i)
+      {
+        basisInverse_.row(rowsCount) -=
+          basisInverse_.row(i) *
+          linearProgramData_.objectiveFunctionCoeffs(tableau->basicVars()[i]);
+      }
+    }
+
+    return tableau;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::computeDriveOutColIdx
+   * Computes the column `s' of the variable to replace the basic one
+   * of the row `k' that has to be zero (e.g. the artificial one):
+   * `α[k, s]' is of the same sign as `β[k]' (so x[s] >= 0), either one
+   * if (β[k] == 0), and the least `P[s] / |α[k, s]|' keeps (P >= (0))
+   * once the column of the leaving variable is dropped.
+   * @param tableau
+   * @param rowIdx `k'.
+   * @return (optional) `s', `none' if (β[k] != 0) can't be made zero
+   * or if (∀s: α[k, s] == 0).
+   */
+  MaybeIndex1D
+  SimplexSolver<T>::computeDriveOutColIdx(
+    const SimplexTableau<T>& tableau, DenseIndex rowIdx
+  ) const
+  {
+    MaybeIndex1D ret;
+
+    const T& value(tableau(rowIdx, tableau.cols() - 1));
+
+    T minRatio(NumericLimits::max<T>());
+    for (DenseIndex colIdx(0); colIdx < tableau.cols() - 1; ++colIdx)
+    {
+      const T& coeff(tableau(rowIdx, colIdx));
+
+      if (
+        isEqualToZero<T>(coeff) ||
+        (isGreaterThanZero<T>(value) && coeff < T(0)) ||
+        (isLessThanZero<T>(value) && coeff > T(0))
+      )
+      {
+        continue;
+      }
+
+      const T ratio(
+        tableau(tableau.rows() - 1, colIdx) / absoluteValue<T>(coeff)
+      ); //!
+
+      if (isLessThan<T>(ratio, minRatio))
+      {
+        minRatio = ratio;
+        ret = colIdx;
+      }
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::discardTableau
+   * Marks the tableau in `workspace_' as not the optimal one,
+   * so the next edit solves the program from scratch.
+   */
+  void
+  SimplexSolver<T>::discardTableau()
+  {
+    isTableauOptimal_ = false;
+    basisInverse_.resize(0, 0);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::reoptimize
+   * Makes the edited tableau optimal again: every edit leaves it either
+   * primal (β >= (0)) or dual (P >= (0)) feasible, so it takes the dual
+   * Simplex method (if any) and then the primal one (see `solvePhaseTwo').
+   * @param tableau
+   * @param linearProgramSolution Solution to store the result to.
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::reoptimize(
+    SimplexTableau<T>& tableau,
+    LinearProgramSolution<T>& linearProgramSolution
+  )
+  {
+    SolutionType solutionType(SolutionType::Optimal);
+    if (checkPhase2Solution(tableau) != SolutionType::Optimal)
+    {
+      solutionType = dualOptimize(tableau);
+    }
+
+    if (solutionType == SolutionType::Optimal)
+    {
+      solutionType = optimize(tableau);
+    }
+
+    if (solutionType == SolutionType::Optimal)
+    {
+      solutionType = checkPhase2Solution(tableau);
+    }
+
+    if (solutionType != SolutionType::Optimal)
+    {
+      discardTableau();
+
+      return solutionType;
+    }
+
+    tableau.extremePoint(linearProgramSolution.extremePoint);
+    linearProgramSolution.extremeValue = tableau.extremeValue();
+    linearProgramSolution.sensitivityAnalysis = (
+      isSensitivityAnalysisEnabled_ ?
+      SensitivityAnalysis<T>::make(linearProgramData_, tableau) :
+      boost::none
+    );
+
+    LOG(
+      "x* == {0},\nF* == {1}",
+      linearProgramSolution.extremePoint,
+      linearProgramSolution.extremeValue
+    );
+
+    return solutionType;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::perturb
+   * Perturbs the program against the degeneracy: the lower bounds of
+   * the variables are shifted to (x >= -δ), where `δ[j]' are the small
+   * pseudorandom values, i.e. (x + δ) is the variable of the program
+   *   αx = β + αδ.
+   * Unlike the perturbation of `β' itself it keeps the redundant
+   * constraints consistent, and the program stays feasible if it was.
+   * The basic values of the same basis rarely coincide, so the ratio
+   * test hardly ever ties (see `removePerturbation').
+   */
+  void
+  SimplexSolver<T>::perturb()
+  {
+    const DenseIndex varsCount(linearProgramData_.variablesCount());
+
+    //NOTE: The same seed makes the solution reproducible
+    std::minstd_rand random(PerturbationSeed);
+
+    perturbation_.resize(varsCount);
+    for (DenseIndex j(0); j < varsCount; ++j)
+    {
+      //δ[j] is in [1; 2) / PerturbationScale
+      perturbation_(j) =
+        T(integer_t(PerturbationScale + random() % PerturbationScale)) /
+        T(integer_t(PerturbationScale) * integer_t(PerturbationScale));
+    }
+
+    unperturbedRHS_ = linearProgramData_.constraintsRHS;
+    linearProgramData_.constraintsRHS.noalias() +=
+      linearProgramData_.constraintsCoeffs * perturbation_;
+
+    isPerturbed_ = true;
+
+    LOG("Perturbed b ==\n{0}", linearProgramData_.constraintsRHS);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::removePerturbation
+   * Replaces the values of the basic variables of the Phase-2 tableau
+   * of the perturbed program (see `perturb') w/ the ones of the original
+   * program in the same basis:
+   *   x[B] = (x + δ)[B] - δ[B] - α[., N] * δ[N],
+   * where `α[., N]' are the columns of the free variables of the tableau,
+   * the objective function value is recomputed for them.
+   * `P' stays as is, so the basis stays dual feasible (if it was).
+   * @param tableau
+   */
+  void
+  SimplexSolver<T>::removePerturbation(SimplexTableau<T>& tableau)
+  {
+    const DenseIndex rhsColIdx(tableau.cols() - 1);
+
+    T objFuncValue(0);
+    for (DenseIndex i(0); i < tableau.rows() - 1; ++i)
+    {
+      const DenseIndex varIdx(tableau.basicVars()[i]);
+
+      T shift(perturbation_(varIdx));
+      for (DenseIndex j(0); j < rhsColIdx; ++j)
+      {
+        shift += tableau(i, j) * perturbation_(tableau.freeVars()[j]);
+      }
+
+      tableau(i, rhsColIdx) -= shift;
+
+      objFuncValue += linearProgramData_.objectiveFunctionCoeffs(varIdx) *
+                      tableau(i, rhsColIdx);
+    }
+
+    //-P[0] == F*
+    tableau(tableau.rows() - 1, rhsColIdx) = objFuncValue * T(-1);
+
+    restoreRHS();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::restoreRHS
+   * Restores `β' of the perturbed program (see `perturb').
+   */
+  void
+  SimplexSolver<T>::restoreRHS()
+  {
+    linearProgramData_.constraintsRHS = unperturbedRHS_;
+    isPerturbed_ = false;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::makeWarmTableau
+   * Constructs the Phase-2 tableau of the given basis by pivoting its
+   * variables into the Phase-1 tableau in place of the artificial ones
+   * (the largest pivot in the column is taken).
+   * @param basicVars Basic variables indices in the order of the rows.
+   * @return The tableau (in the workspace), `nullptr' if the basis
+   * is not the basis of the program (it is singular or malformed)
+   * or it is neither primal (β >= (0)) nor dual (P >= (0)) feasible.
+   */
+  SimplexTableau<T>*
+  SimplexSolver<T>::makeWarmTableau(const vector<DenseIndex>& basicVars)
+  {
+    SimplexTableau<T>* ret(nullptr);
+
+    const DenseIndex varsCount(linearProgramData_.variablesCount());
+    if (
+      DenseIndex(basicVars.size()) != linearProgramData_.constraintsCount()
+    )
+    {
+      return ret;
+    }
+
+    SimplexTableau<T>& phase1Tableau(
+      workspace_.makePhaseOne(linearProgramData_)
+    );
+
+    for (const DenseIndex varIdx : basicVars)
+    {
+      if (varIdx < 0 || varIdx >= varsCount)
+      {
+        return ret;
+      }
+
+      //The variable must still be free (so the basis has no duplicates)
+      const auto freeVarIt(
+        std::find(
+          phase1Tableau.freeVars().cbegin(), phase1Tableau.freeVars().cend(),
+          varIdx
+        )
+      );
+
+      if (freeVarIt == phase1Tableau.freeVars().cend())
+      {
+        return ret;
+      }
+
+      const DenseIndex colIdx(freeVarIt - phase1Tableau.freeVars().cbegin());
+
+      //Only the artificial variables `~x[i]' (i >= N) can leave
+      MaybeIndex1D rowIdx;
+      T maxPivot(0);
+      for (DenseIndex i(0); i < phase1Tableau.rows() - 1; ++i)
+      {
+        if (phase1Tableau.basicVars()[i] >= varsCount)
+        {
+          const T pivot(absoluteValue<T>(phase1Tableau(i, colIdx)));
+          if (isGreaterThan<T>(pivot, maxPivot))
+          {
+            maxPivot = pivot;
+            rowIdx = i;
+          }
+        }
+      }
+
+      //If (∀i: α[i, s] == 0), the basis matrix is singular
+      if (!rowIdx)
+      {
+        return ret;
+      }
+
+      if (
+        iterate(phase1Tableau, make_pair(*rowIdx, colIdx)) !=
+        SolutionType::Incomplete
+      )
+      {
+        return ret;
+      }
+    }
+
+    //All the artificial variables are free (i.e. zero) now,
+    //so the tableau is the one of the optimal Phase-1
+    SimplexTableau<T>& phase2Tableau(
+      workspace_.makePhaseTwo(linearProgramData_)
     );
 
-    //Solve Phase-1: do `iterate()' while the solution is not optimal
-    const SolutionType phase1SolutionType(optimize(phase1Tableau));
+    if (
+      checkPhase2Solution(phase2Tableau) == SolutionType::Optimal ||
+      !computePivotColIdx(phase2Tableau)
+    )
+    {
+      ret = &phase2Tableau;
+    }
+
+    return ret;
+  }
 
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::solvePhaseTwo
+   * Solves the Phase-2 starting from the given tableau, which is either
+   * primal (β >= (0)) or dual (P >= (0)) feasible. The dual feasible
+   * one is made primal feasible by the dual Simplex method first.
+   * @param tableau
+   * @param basisKey Key to store the optimal basis under (if any).
+   * @param linearProgramSolution Solution to store the result to.
+   * @return
+   */
+  SolutionType
+  SimplexSolver<T>::solvePhaseTwo(
+    SimplexTableau<T>& tableau, const optional<BasisCache::Key>& basisKey,
+    LinearProgramSolution<T>& linearProgramSolution
+  )
+  {
     LOG(
-      "~X({0}) ==\n{1},\n~x == {2},\n x == {3}",
+      "X({0}) ==\n{1},\n~x == {2},\n x == {3}",
       iterCount_,
-      phase1Tableau.entries(),
-      makeString(phase1Tableau.basicVars()),
-      makeString(phase1Tableau.freeVars())
+      tableau.entries(),
+      makeString(tableau.basicVars()),
+      makeString(tableau.freeVars())
     );
 
-    //TODO: [2;2] Workaround.
-    if (iterCount_ == 0)
+    //Solve Phase-2: do `iterate()' while the solution is not optimal
+    SolutionType phase2SolutionType(SolutionType::Optimal);
+    if (checkPhase2Solution(tableau) != SolutionType::Optimal)
     {
-      return make_pair(SolutionType::Unknown, ret);
+      phase2SolutionType = dualOptimize(tableau);
     }
 
-    if (phase1SolutionType == SolutionType::Optimal)
+    if (phase2SolutionType == SolutionType::Optimal)
     {
-      //Recheck Phase-1 solution (~F* == 0) and try to solve the Phase-2
-      const SolutionType phase1SolutionType(
-        checkPhase1Solution(phase1Tableau)
-      );
+      phase2SolutionType = optimize(tableau);
+    }
 
-      if (phase1SolutionType == SolutionType::Optimal)
-      {
-        ++iterCount_;
+    //The basis optimal for the perturbed program is dual feasible for
+    //the original one, so it only takes the dual Simplex method (if any)
+    if (isPerturbed_ && phase2SolutionType == SolutionType::Optimal)
+    {
+      removePerturbation(tableau);
 
-        SimplexTableau<T> phase2Tableau(
-          SimplexTableau<T>::makePhaseTwo(linearProgramData_, phase1Tableau)
-        );
+      if (checkPhase2Solution(tableau) != SolutionType::Optimal)
+      {
+        phase2SolutionType = dualOptimize(tableau);
 
-        LOG(
-          "X({0}) ==\n{1},\n~x == {2},\n x == {3}",
-          iterCount_,
-          phase2Tableau.entries(),
-          makeString(phase2Tableau.basicVars()),
-          makeString(phase2Tableau.freeVars())
-        );
+        if (phase2SolutionType == SolutionType::Optimal)
+        {
+          phase2SolutionType = optimize(tableau);
+        }
+      }
+    }
 
-        //Solve Phase-2: do `iterate()' while the solution is not optimal
-        const SolutionType phase2SolutionType(optimize(phase2Tableau));
+    LOG(
+      "X({0}) ==\n{1},\n~x == {2},\n x == {3}",
+      iterCount_,
+      tableau.entries(),
+      makeString(tableau.basicVars()),
+      makeString(tableau.freeVars())
+    );
 
-        LOG(
-          "X({0}) ==\n{1},\n~x == {2},\n x == {3}",
-          iterCount_,
-          phase2Tableau.entries(),
-          makeString(phase2Tableau.basicVars()),
-          makeString(phase2Tableau.freeVars())
-        );
+    if (phase2SolutionType == SolutionType::Optimal)
+    {
+      //Recheck Phase-2 solution (x* >= (0))
+      phase2SolutionType = checkPhase2Solution(tableau);
 
-        if (phase2SolutionType == SolutionType::Optimal)
+      if (phase2SolutionType == SolutionType::Optimal)
+      {
+        if (isDualized_)
+        {
+          recoverPrimalSolution(tableau, linearProgramSolution);
+          linearProgramSolution.sensitivityAnalysis = boost::none;
+        }
+        else
         {
-          //Recheck Phase-2 solution (x* >= (0))
-          const SolutionType phase2SolutionType(
-            checkPhase2Solution(phase2Tableau)
+          tableau.extremePoint(linearProgramSolution.extremePoint);
+          linearProgramSolution.extremeValue = tableau.extremeValue();
+          linearProgramSolution.sensitivityAnalysis = (
+            isSensitivityAnalysisEnabled_ ?
+            SensitivityAnalysis<T>::make(linearProgramData_, tableau) :
+            boost::none
           );
 
-          if (phase2SolutionType == SolutionType::Optimal)
-          {
-            const LinearProgramSolution<T> linearProgramSolution(
-              phase2Tableau.extremePoint(),
-              phase2Tableau.extremeValue()
-            );
-
-            LOG(
-              "x* == {0},\nF* == {1}",
-              linearProgramSolution.extremePoint,
-              linearProgramSolution.extremeValue
-            );
+          isTableauOptimal_ = true;
+        }
 
-            ret = linearProgramSolution;
+        LOG(
+          "x* == {0},\nF* == {1}",
+          linearProgramSolution.extremePoint,
+          linearProgramSolution.extremeValue
+        );
 
-            return make_pair(phase2SolutionType, ret);
-          }
-          else
-          {
-            return make_pair(phase2SolutionType, ret);
-          }
-        }
-        else
+        //NOTE: The basis w/o the rows of the redundant constraints
+        //is not the basis of the program
+        if (
+          basisKey &&
+          DenseIndex(tableau.basicVarsCount()) ==
+          linearProgramData_.constraintsCount()
+        )
         {
-          return make_pair(phase2SolutionType, ret);
+          basisCache_->insert(*basisKey, tableau.basicVars());
         }
       }
-      else
-      {
-        return make_pair(phase1SolutionType, ret);
-      }
-    }
-    else
-    {
-      return make_pair(phase1SolutionType, ret);
     }
-  }
-
 
-  template<typename T>
-  /**
-   * @brief SimplexSolver<T>::reset
-   * Resets the internal state of the object.
-   */
-  void
-  SimplexSolver<T>::reset()
-  {
-    iterCount_ = 0;
+    return phase2SolutionType;
   }
 
 
@@ -309,32 +1711,74 @@ namespace LinearProgramming
   SolutionType
   SimplexSolver<T>::optimize(SimplexTableau<T>& tableau)
   {
+    //Start w/ the fast pivot rule from the basis of the given tableau
+    cycleDetector_.reset();
+
+    //The order of the lexicographic rule is the one of the starting
+    //basis, so the rows of [β | α[., B0]] are lexicographically positive
+    if (degeneracyStrategy_ == DegeneracyStrategy::Lexicographic)
+    {
+      lexicographicVars_ = tableau.basicVars();
+
+      varsPositions_.resize(tableau.basicVarsCount() + tableau.freeVarsCount());
+      for (DenseIndex i(0); i < tableau.rows() - 1; ++i)
+      {
+        varsPositions_[tableau.basicVars()[i]] = -1 - i;
+      }
+      for (DenseIndex j(0); j < tableau.cols() - 1; ++j)
+      {
+        varsPositions_[tableau.freeVars()[j]] = j;
+      }
+    }
+
     //Iterate while the solution is incomplete, stop if
     //the program is unsolvable, return value decribing why it is
-    while (true)
+    SolutionType solutionType(SolutionType::Incomplete);
+    while (solutionType == SolutionType::Incomplete)
     {
-      const SolutionType solutionType(iterate(tableau));
+      solutionType = iterate(tableau);
+    }
 
-      switch (solutionType)
-      {
-        case SolutionType::Optimal:
-          return solutionType;
+    //NOTE: It keeps the storage
+    lexicographicVars_.clear();
 
-        case SolutionType::Unbounded:
-          return solutionType;
+    return solutionType;
+  }
 
-        case SolutionType::Infeasible:
-          return solutionType;
 
-        case SolutionType::Incomplete:
-          break;
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::dualOptimize
+   * Performs the dual Simplex method steps on the given dual feasible
+   * (P >= (0)) tableau until it is primal feasible (β >= (0)) as well.
+   * @param tableau
+   * @return `SolutionType::Optimal' if the tableau is optimal,
+   * `SolutionType::Infeasible' if the program is infeasible.
+   */
+  SolutionType
+  SimplexSolver<T>::dualOptimize(SimplexTableau<T>& tableau)
+  {
+    while (true)
+    {
+      if (iterCount_ >= MaxSimplexIterations)
+      {
+        return SolutionType::Unknown;
+      }
 
-        case SolutionType::Unknown:
-          return solutionType;
+      const pair<SolutionType, MaybeIndex2D> pivotIdx(
+        computeDualPivotIdx(tableau)
+      );
 
-        default:
-          break;
+      if (!pivotIdx.second)
+      {
+        return pivotIdx.first;
       }
+
+      ++iterCount_;
+
+      transformTableau(
+        tableau, (*pivotIdx.second).first, (*pivotIdx.second).second
+      );
     }
   }
 
@@ -464,6 +1908,8 @@ namespace LinearProgramming
    *   or
    *  min{s} for all `s' where (P[s] < 0) (Bland's pivot selection rule that
    * prevents cycling).
+   * Bland's rule converges slowly, so it is only used while the cycling
+   * is suspected (see `CycleDetector'), if `LP_WITH_BLAND_RULE' is set.
    */
   MaybeIndex1D
   SimplexSolver<T>::computePivotColIdx(
@@ -476,50 +1922,59 @@ namespace LinearProgramming
     bool haveNegativeCoeffs(false);
 
 #ifdef LP_WITH_BLAND_RULE
-    //Find min{s} for all `s' where (∃s: P[s] < 0)
-    DenseIndex minVarIdx(
-      tableau.freeVarsCount() + tableau.basicVarsCount()
-    );
+    const bool isBlandRule(cycleDetector_.isAntiCycling());
+#else // LP_WITH_BLAND_RULE
+    const bool isBlandRule(false);
+#endif // LP_WITH_BLAND_RULE
 
-    for (DenseIndex colIdx(0); colIdx < tableau.cols() - 1; ++colIdx)
+    if (isBlandRule)
     {
-      const DenseIndex currVarIdx(tableau.freeVars()[colIdx]);
-      const T currCoeff(tableau(tableau.rows() - 1, colIdx));
+      //Find min{s} for all `s' where (∃s: P[s] < 0)
+      DenseIndex minVarIdx(
+        tableau.freeVarsCount() + tableau.basicVarsCount()
+      );
 
-      //Pick only negative `P[j]'
-      if (isLessThanZero<T>(currCoeff))
+      for (DenseIndex colIdx(0); colIdx < tableau.cols() - 1; ++colIdx)
       {
-        haveNegativeCoeffs = true;
+        const DenseIndex currVarIdx(tableau.freeVars()[colIdx]);
+        const T currCoeff(tableau(tableau.rows() - 1, colIdx));
 
-        //Update w/ the new found index
-        if (currVarIdx < minVarIdx)
+        //Pick only negative `P[j]'
+        if (isLessThanZero<T>(currCoeff))
         {
-          minVarIdx = currVarIdx;
-          minCoeffColIdx = colIdx;
+          haveNegativeCoeffs = true;
+
+          //Update w/ the new found index
+          if (currVarIdx < minVarIdx)
+          {
+            minVarIdx = currVarIdx;
+            minCoeffColIdx = colIdx;
+          }
         }
       }
     }
-#else // LP_WITH_BLAND_RULE
-    //Find argmin{P[s]} for all `s' where (P[s] < 0)
-    T minCoeff(0);
-
-    //Find the most negative coeff `P[s]' at the bottom row
-    for (DenseIndex colIdx(0); colIdx < tableau.cols() - 1; ++colIdx)
+    else
     {
-      const T currCoeff(tableau(tableau.rows() - 1, colIdx));
-      //Pick only negative `P[j]'
-      if (isLessThanZero<T>(currCoeff))
+      //Find argmin{P[s]} for all `s' where (P[s] < 0)
+      T minCoeff(0);
+
+      //Find the most negative coeff `P[s]' at the bottom row
+      for (DenseIndex colIdx(0); colIdx < tableau.cols() - 1; ++colIdx)
       {
-        haveNegativeCoeffs = true;
-        //Update w/ new found index
-        if (currCoeff < minCoeff)
+        const T currCoeff(tableau(tableau.rows() - 1, colIdx));
+        //Pick only negative `P[j]'
+        if (isLessThanZero<T>(currCoeff))
         {
-          minCoeff = currCoeff;
-          minCoeffColIdx = colIdx;
+          haveNegativeCoeffs = true;
+          //Update w/ new found index
+          if (currCoeff < minCoeff)
+          {
+            minCoeff = currCoeff;
+            minCoeffColIdx = colIdx;
+          }
         }
       }
     }
-#endif // LP_WITH_BLAND_RULE
 
     if (haveNegativeCoeffs)
     {
@@ -548,12 +2003,24 @@ namespace LinearProgramming
   {
     MaybeIndex1D ret;
 
+    DenseIndex minRatioRowIdx(0);
+
 #ifdef LP_WITH_BLAND_RULE
-    list<DenseIndex> minRatioRowsIndices;
+    //Bland's rule is only used while the cycling is suspected
+    const bool isBlandRule(cycleDetector_.isAntiCycling());
 #else // LP_WITH_BLAND_RULE
-    DenseIndex minRatioRowIdx(0);
+    const bool isBlandRule(false);
 #endif // LP_WITH_BLAND_RULE
 
+    //The lexicographic rule (if any) overrides Bland's one
+    const bool isLexicographicRule(!lexicographicVars_.empty());
+
+    //NOTE: The ties are resolved on the fly, so that nothing is allocated
+    //per iteration: the row of the least basic variable among them
+    //is taken (the first one if all the variables are >= M)
+    const DenseIndex basicVarsCount(tableau.basicVarsCount());
+    DenseIndex minRatioVarIdx(basicVarsCount);
+
     T minRatio(NumericLimits::max<T>());
     bool havePositiveCoeffs(false);
 
@@ -572,68 +2039,198 @@ namespace LinearProgramming
           tableau(rowIdx, pivotColIdx)
         );
 
-#ifdef LP_WITH_BLAND_RULE
-        if (isEqual<T>(currRatio, minRatio))
+        if (isLexicographicRule)
+        {
+          if (isEqual<T>(currRatio, minRatio))
+          {
+            if (
+              isLexicographicallyLess(
+                tableau, pivotColIdx, rowIdx, minRatioRowIdx
+              )
+            )
+            {
+              minRatioRowIdx = rowIdx;
+            }
+          }
+          else
+          {
+            if (isLessThan<T>(currRatio, minRatio))
+            {
+              minRatio = currRatio;
+              minRatioRowIdx = rowIdx;
+            }
+          }
+        }
+        else if (isBlandRule)
         {
-          minRatioRowsIndices.push_back(rowIdx);
+          const DenseIndex currVarIdx(tableau.basicVars()[rowIdx]);
+
+          if (isEqual<T>(currRatio, minRatio))
+          {
+            if (currVarIdx < minRatioVarIdx)
+            {
+              minRatioVarIdx = currVarIdx;
+              minRatioRowIdx = rowIdx;
+            }
+          }
+          else
+          {
+            if (isLessThan<T>(currRatio, minRatio))
+            {
+              minRatio = currRatio;
+              minRatioRowIdx = rowIdx;
+              minRatioVarIdx = std::min(currVarIdx, basicVarsCount);
+            }
+          }
         }
         else
         {
+          //Update w/ new found minimum
           if (isLessThan<T>(currRatio, minRatio))
           {
-            minRatioRowsIndices.clear();
-            minRatioRowsIndices.push_back(rowIdx);
             minRatio = currRatio;
+            minRatioRowIdx = rowIdx;
           }
         }
-#else // LP_WITH_BLAND_RULE
-        //Update w/ new found minimum
-        if (isLessThan<T>(currRatio, minRatio))
-        {
-          minRatio = currRatio;
-          minRatioRowIdx = rowIdx;
-        }
-#endif // LP_WITH_BLAND_RULE
       }
     }
 
-#ifdef LP_WITH_BLAND_RULE
     if (havePositiveCoeffs)
     {
-      if (minRatioRowsIndices.size() == 1)
+      ret = minRatioRowIdx;
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::isLexicographicallyLess
+   * Compares the rows of the minimum ratio test tie by the lexicographic
+   * rule: the rows `k' of [α[., B0]] / α[k, s] (where `B0' are
+   * the variables that were basic at the start, see `optimize') are
+   * compared element by element. These rows are linearly independent,
+   * so the rule always picks the single row, and the rows of [β | α[., B0]]
+   * stay lexicographically positive, so no basis can repeat.
+   * @param tableau
+   * @param pivotColIdx
+   * @param rowIdx
+   * @param minRowIdx
+   * @return `true' if the row `rowIdx' is less than the row `minRowIdx'.
+   */
+  bool
+  SimplexSolver<T>::isLexicographicallyLess(
+    const SimplexTableau<T>& tableau, DenseIndex pivotColIdx,
+    DenseIndex rowIdx, DenseIndex minRowIdx
+  ) const
+  {
+    const T& pivot(tableau(rowIdx, pivotColIdx));
+    const T& minPivot(tableau(minRowIdx, pivotColIdx));
+
+    for (const DenseIndex varIdx : lexicographicVars_)
+    {
+      const DenseIndex position(varsPositions_[varIdx]);
+
+      T coeff(0);
+      T minCoeff(0);
+      if (position >= 0)
       {
-        ret = minRatioRowsIndices.front();
+        coeff = tableau(rowIdx, position);
+        minCoeff = tableau(minRowIdx, position);
       }
       else
       {
-        if (minRatioRowsIndices.size() > 1)
-        {
-          DenseIndex minRatioRowIdx(minRatioRowsIndices.front());
-          DenseIndex minRatioVarIdx(tableau.basicVarsCount());
+        //The column of the basic variable is the unit one
+        coeff = T(-1 - position == rowIdx ? 1 : 0);
+        minCoeff = T(-1 - position == minRowIdx ? 1 : 0);
+      }
 
-          for (DenseIndex rowIdx : minRatioRowsIndices)
-          {
-            const DenseIndex currVarIdx(tableau.basicVars()[rowIdx]);
+      const T ratio(coeff / pivot); //!
+      const T minRatio(minCoeff / minPivot); //!
 
-            if (currVarIdx < minRatioVarIdx)
-            {
-              minRatioVarIdx = currVarIdx;
-              minRatioRowIdx = rowIdx;
-            }
-          }
+      if (!isEqual<T>(ratio, minRatio))
+      {
+        return isLessThan<T>(ratio, minRatio);
+      }
+    }
+
+    return false;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexSolver<T>::computeDualPivotIdx
+   * Computes the pivot element position of the dual Simplex method:
+   * the leaving row `k' is the one of the least basic variable among
+   * the ones where (β[k] < 0) (Bland's rule), the entering column `s'
+   * is argmin{P[s] / -α[k, s]} for all `s' where (α[k, s] < 0)
+   * (the least free variable among the ties).
+   * @param tableau
+   * @return
+   */
+  pair<SolutionType, MaybeIndex2D>
+  SimplexSolver<T>::computeDualPivotIdx(
+    const SimplexTableau<T>& tableau
+  ) const
+  {
+    MaybeIndex2D idx;
+
+    MaybeIndex1D pivotRowIdx;
+    for (DenseIndex rowIdx(0); rowIdx < tableau.rows() - 1; ++rowIdx)
+    {
+      if (
+        isLessThanZero<T>(tableau(rowIdx, tableau.cols() - 1)) &&
+        (
+          !pivotRowIdx ||
+          tableau.basicVars()[rowIdx] < tableau.basicVars()[*pivotRowIdx]
+        )
+      )
+      {
+        pivotRowIdx = rowIdx;
+      }
+    }
+
+    //If (∀k: β[k] >= 0), the tableau is primal feasible
+    if (!pivotRowIdx)
+    {
+      return make_pair(SolutionType::Optimal, idx);
+    }
 
-          ret = minRatioRowIdx;
+    MaybeIndex1D pivotColIdx;
+    T minRatio(NumericLimits::max<T>());
+    for (DenseIndex colIdx(0); colIdx < tableau.cols() - 1; ++colIdx)
+    {
+      const T coeff(tableau(*pivotRowIdx, colIdx));
+      if (isLessThanZero<T>(coeff))
+      {
+        const T currRatio(tableau(tableau.rows() - 1, colIdx) / -coeff); //!
+
+        if (
+          isLessThan<T>(currRatio, minRatio) ||
+          (
+            pivotColIdx && isEqual<T>(currRatio, minRatio) &&
+            tableau.freeVars()[colIdx] < tableau.freeVars()[*pivotColIdx]
+          )
+        )
+        {
+          minRatio = currRatio;
+          pivotColIdx = colIdx;
         }
       }
     }
-#else // LP_WITH_BLAND_RULE
-    if (havePositiveCoeffs)
+
+    //If (∃k: β[k] < 0) ∧ (∀s: α[k, s] >= 0), the `k'-th constraint
+    //cannot be satisfied
+    if (!pivotColIdx)
     {
-      ret = minRatioRowIdx;
+      return make_pair(SolutionType::Infeasible, idx);
     }
-#endif // LP_WITH_BLAND_RULE
 
-    return ret;
+    idx = make_pair(*pivotRowIdx, *pivotColIdx);
+
+    return make_pair(SolutionType::Incomplete, idx);
   }
 
 
@@ -654,59 +2251,50 @@ namespace LinearProgramming
     SimplexTableau<T>& tableau, DenseIndex rowIdx, DenseIndex colIdx
   )
   {
-    //Cache the value of the pivot element `α[k, s]'
-    const T pivotElement(tableau(rowIdx, colIdx));
-
     LOG(
       "pivotElement == {2}, rowIdx == {0}, colIdx == {1}, swap ~x{3} <> x{4}",
-      rowIdx, colIdx, pivotElement,
+      rowIdx, colIdx, tableau(rowIdx, colIdx),
       tableau.basicVars()[rowIdx], tableau.freeVars()[colIdx]
     );
 
-    //Swap the free and basic variable ~x[k] ↔ x[s]
-    std::swap(tableau.basicVars()[rowIdx], tableau.freeVars()[colIdx]);
+    const bool isDegenerate(
+      isEqualToZero<T>(tableau(rowIdx, tableau.cols() - 1))
+    );
 
-    //For the new row at the pivot position
-    //(new pivot row) = (old pivot row) / (old pivot)
-    for (DenseIndex j(0); j < tableau.cols(); ++j)
+    ++statistics_.pivotsCount;
+    if (isDegenerate)
     {
-      if (j != colIdx) //Skip pivot column
-      {
-        tableau(rowIdx, j) /= pivotElement; //!
-      }
+      ++statistics_.degeneratePivotsCount;
     }
 
-    //For the new pivot element value
-    //(new pivot) = 1 / (old pivot)
-    tableau(rowIdx, colIdx) = T(1) / pivotElement; //!
+    //Watch the bases for cycling (see `computePivotColIdx')
+    cycleDetector_.update(
+      tableau.basicVars()[rowIdx], tableau.freeVars()[colIdx], isDegenerate
+    );
 
-    //For each row above and below the pivot row
-    for (DenseIndex i(0); i < tableau.rows(); ++i)
+    if (!lexicographicVars_.empty())
     {
-      if (i != rowIdx) //Skip pivot row
-      {
-        const T factor(tableau(i, colIdx));
-        for (DenseIndex j(0); j < tableau.cols(); ++j)
-        {
-          if (j != colIdx) //Skip pivot column
-          {
-            //(new row) = (old row) - (factor) * (pivot row)
-            tableau(i, j) -= factor * tableau(rowIdx, j);
-          }
-        }
-      }
+      varsPositions_[tableau.basicVars()[rowIdx]] = colIdx;
+      varsPositions_[tableau.freeVars()[colIdx]] = -1 - rowIdx;
     }
 
-    //For the new column at the pivot position
-    //(new pivot column) = (old pivot column) / ((-1) * (old pivot))
-    for (DenseIndex i(0); i < tableau.rows(); ++i)
+    //`B^-1' is transformed as the column `β' (see `editableTableau')
+    if (basisInverse_.size() != 0)
     {
-      if (i != rowIdx) //Skip pivot row
+      basisInverse_.row(rowIdx) /= tableau(rowIdx, colIdx); //!
+      for (DenseIndex i(0); i < tableau.rows(); ++i)
       {
-        tableau(i, colIdx) /= pivotElement * T(-1); //!
+        if (i != rowIdx && tableau(i, colIdx) != T(0))
+        {
+          basisInverse_.row(i) -=
+            basisInverse_.row(rowIdx) * tableau(i, colIdx);
+        }
       }
     }
 
+    //See `SimplexTableau<T>::pivot'
+    tableau.pivot(rowIdx, colIdx);
+
     LOG(
       "T({0}) ==\n{1},\n~x == {2},\n x == {3}",
       iterCount_, tableau.entries(),
@@ -759,6 +2347,8 @@ namespace LinearProgramming
   /**
    * @brief SimplexSolver<T>::checkPhase2Solution
    * Checks if the solution obtained at the Phase-2 is valid.
+   * NOTE: The degenerate pivots can leave the rounding errors
+   * (e.g. -1E-16) in place of the zero `β[i]', so they are tolerated.
    * @param tableau
    * @return `true' if (β >= (0)), `false' otherwise.
    */
@@ -768,10 +2358,10 @@ namespace LinearProgramming
   ) const
   {
     if (
-      tableau.col(tableau.cols() - 1).
+      !tableau.col(tableau.cols() - 1).
       head(tableau.rows() - 1).
-      unaryExpr(ref(isGreaterThanOrEqualToZero<T>)).
-      all()
+      unaryExpr(ref(isLessThanZero<T>)).
+      any()
     )
     {
       return SolutionType::Optimal;
@@ -781,6 +2371,13 @@ namespace LinearProgramming
       return SolutionType::Infeasible;
     }
   }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `simplexsolver.cxx'
+  extern template class SimplexSolver<NumericTypes::real_t>;
+  extern template class SimplexSolver<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
 }
 
 
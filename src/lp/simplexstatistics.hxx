@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#ifndef SIMPLEXSTATISTICS_HXX
+#define SIMPLEXSTATISTICS_HXX
+
+
+#include <cstdint>
+
+
+namespace LinearProgramming
+{
+  /**
+   * @brief The SimplexStatistics struct
+   * Counters of the last solve of `SimplexSolver<T>'
+   * (or `BoundedSimplexSolver<T>').
+   */
+  struct SimplexStatistics
+  {
+    //Pivots of both phases (including the ones of the warm start)
+    uint32_t pivotsCount = 0;
+
+    //Pivots that left `x*' as is (β[k] == 0)
+    uint32_t degeneratePivotsCount = 0;
+
+    //Iterations that moved the free variable to its other bound w/o pivot
+    uint32_t boundFlipsCount = 0;
+  };
+}
+
+
+#endif // SIMPLEXSTATISTICS_HXX
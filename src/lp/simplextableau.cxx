@@ -0,0 +1,12 @@
+﻿#include "simplextableau.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class SimplexTableau<NumericTypes::real_t>;
+  template class SimplexTableau<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
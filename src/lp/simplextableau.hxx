@@ -12,6 +12,7 @@
 
 #include "simplexsolver_fwd.hxx"
 #include "simplexsolvercontroller_fwd.hxx"
+#include "boundedprogramdata.hxx"
 #include "linearprogramdata.hxx"
 #include "optimizationgoaltype.hxx"
 #include "solutionphase.hxx"
@@ -49,6 +50,11 @@ namespace LinearProgramming
       SimplexTableau(const SimplexTableau<T>& simplexTableau);
       SimplexTableau(SimplexTableau<T>&& simplexTableau);
 
+      const SimplexTableau<T>& operator =(
+        const SimplexTableau<T>& simplexTableau
+      );
+      const SimplexTableau<T>& operator =(SimplexTableau<T>&& simplexTableau);
+
       T& operator ()(DenseIndex rowIdx, DenseIndex colIdx);
       const T& operator ()(DenseIndex rowIdx, DenseIndex colIdx) const;
 
@@ -56,15 +62,13 @@ namespace LinearProgramming
       const Block<const Matrix<T, Dynamic, Dynamic>, Dynamic, Dynamic>
       entries() const;
 
-      typename
-      Matrix<T, Dynamic, Dynamic>::RowXpr row(DenseIndex rowIdx);
-      typename
-      Matrix<T, Dynamic, Dynamic>::ConstRowXpr row(DenseIndex rowIdx) const;
+      Block<Matrix<T, Dynamic, Dynamic>, 1, Dynamic> row(DenseIndex rowIdx);
+      const Block<const Matrix<T, Dynamic, Dynamic>, 1, Dynamic>
+      row(DenseIndex rowIdx) const;
 
-      typename
-      Matrix<T, Dynamic, Dynamic>::ColXpr col(DenseIndex colIdx);
-      typename
-      Matrix<T, Dynamic, Dynamic>::ConstColXpr col(DenseIndex colIdx) const;
+      Block<Matrix<T, Dynamic, Dynamic>, Dynamic, 1> col(DenseIndex colIdx);
+      const Block<const Matrix<T, Dynamic, Dynamic>, Dynamic, 1>
+      col(DenseIndex colIdx) const;
 
       DenseIndex rows() const;
 
@@ -83,21 +87,60 @@ namespace LinearProgramming
       size_t freeVarsCount() const;
 
       Matrix<T, Dynamic, 1> extremePoint() const;
+      void extremePoint(Matrix<T, Dynamic, 1>& extremePoint) const;
 
       T extremeValue(
         OptimizationGoalType goalType = OptimizationGoalType::Minimize
       ) const;
 
+      void pivot(DenseIndex rowIdx, DenseIndex colIdx);
+
+      void insertRow(DenseIndex basicVarIdx, const Matrix<T, 1, Dynamic>& row);
+
+      void insertColumn(
+        DenseIndex freeVarIdx, const Matrix<T, Dynamic, 1>& column
+      );
+
+      void removeRow(DenseIndex rowIdx);
+
+      void removeColumn(DenseIndex colIdx);
+
 
       static SimplexTableau<T> makePhaseOne(
         const LinearProgramData<T>& linearProgramData
       );
+      static void makePhaseOne(
+        const LinearProgramData<T>& linearProgramData,
+        SimplexTableau<T>& phase1Tableau
+      );
+
+      static SimplexTableau<T> makePhaseOne(
+        const BoundedProgramData<T>& boundedProgramData
+      );
+      static void makePhaseOne(
+        const BoundedProgramData<T>& boundedProgramData,
+        SimplexTableau<T>& phase1Tableau
+      );
+
+      static DenseIndex crash(
+        const LinearProgramData<T>& linearProgramData,
+        SimplexTableau<T>& phase1Tableau
+      ) throw(invalid_argument);
 
       static SimplexTableau<T> makePhaseTwo(
         const LinearProgramData<T>& linearProgramData,
         const SimplexTableau<T>& phase1Tableau
       ) throw(invalid_argument);
 
+      static void transformToPhaseTwo(
+        const LinearProgramData<T>& linearProgramData,
+        SimplexTableau<T>& tableau
+      ) throw(invalid_argument);
+      static void transformToPhaseTwo(
+        const Matrix<T, 1, Dynamic>& objectiveFunctionCoeffs,
+        SimplexTableau<T>& tableau
+      ) throw(invalid_argument);
+
 
     private:
       /**
@@ -121,9 +164,23 @@ namespace LinearProgramming
 
       /**
        * @brief entries_
-       * Stores all the entries of the tableau.
+       * Stores all the entries of the tableau in its top-left corner.
+       * NOTE: The storage can be larger than the tableau
+       * (see `transformToPhaseTwo').
        */
       Matrix<T, Dynamic, Dynamic> entries_;
+
+      /**
+       * @brief rows_
+       * Rows count of the tableau.
+       */
+      DenseIndex rows_;
+
+      /**
+       * @brief cols_
+       * Columns count of the tableau.
+       */
+      DenseIndex cols_;
   };
 }
 
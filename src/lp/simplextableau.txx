@@ -14,20 +14,27 @@
 #include <utility>
 #include <vector>
 
+#include "boost/optional.hpp"
 #include "eigen3/Eigen/Core"
 
+#include "boundedprogramdata.hxx"
 #include "linearprogramdata.hxx"
 #include "optimizationgoaltype.hxx"
 #include "solutionphase.hxx"
 #include "../math/mathutils.hxx"
+#include "../misc/eigenextensions.hxx"
 
 
 namespace LinearProgramming
 {
+  using boost::optional;
   using Eigen::Block;
   using Eigen::DenseIndex;
   using Eigen::Dynamic;
   using Eigen::Matrix;
+  using MathUtils::absoluteValue;
+  using MathUtils::isGreaterThan;
+  using MathUtils::isGreaterThanZero;
   using MathUtils::isLessThanZero;
   using std::invalid_argument;
 
@@ -52,7 +59,9 @@ namespace LinearProgramming
     phase_(simplexTableau.phase_),
     basicVars_(simplexTableau.basicVars_),
     freeVars_(simplexTableau.freeVars_),
-    entries_(simplexTableau.entries_)
+    entries_(simplexTableau.entries_),
+    rows_(simplexTableau.rows_),
+    cols_(simplexTableau.cols_)
   { }
 
 
@@ -66,10 +75,61 @@ namespace LinearProgramming
     phase_(simplexTableau.phase_),
     basicVars_(std::move(simplexTableau.basicVars_)),
     freeVars_(std::move(simplexTableau.freeVars_)),
-    entries_(std::move(simplexTableau.entries_))
+    entries_(std::move(simplexTableau.entries_)),
+    rows_(simplexTableau.rows_),
+    cols_(simplexTableau.cols_)
   { }
 
 
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::operator =
+   * Copy-assignment operator, the storage is reused if it has
+   * the same size.
+   * @param simplexTableau
+   * @return
+   */
+  const SimplexTableau<T>&
+  SimplexTableau<T>::operator =(const SimplexTableau<T>& simplexTableau)
+  {
+    if (this != &simplexTableau)
+    {
+      phase_ = simplexTableau.phase_;
+      basicVars_ = simplexTableau.basicVars_;
+      freeVars_ = simplexTableau.freeVars_;
+      entries_ = simplexTableau.entries_;
+      rows_ = simplexTableau.rows_;
+      cols_ = simplexTableau.cols_;
+    }
+
+    return *this;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::operator =
+   * Move-assignment operator.
+   * @param simplexTableau
+   * @return
+   */
+  const SimplexTableau<T>&
+  SimplexTableau<T>::operator =(SimplexTableau<T>&& simplexTableau)
+  {
+    if (this != &simplexTableau)
+    {
+      phase_ = simplexTableau.phase_;
+      basicVars_ = std::move(simplexTableau.basicVars_);
+      freeVars_ = std::move(simplexTableau.freeVars_);
+      entries_ = std::move(simplexTableau.entries_);
+      rows_ = simplexTableau.rows_;
+      cols_ = simplexTableau.cols_;
+    }
+
+    return *this;
+  }
+
+
   template<typename T>
   /**
    * @brief SimplexTableau<T>::operator ()
@@ -110,7 +170,7 @@ namespace LinearProgramming
   Block<Matrix<T, Dynamic, Dynamic>, Dynamic, Dynamic>
   SimplexTableau<T>::entries()
   {
-    return entries_.block(0, 0, entries_.rows(), entries_.cols());
+    return entries_.block(0, 0, rows_, cols_);
   }
 
 
@@ -123,7 +183,7 @@ namespace LinearProgramming
   const Block<const Matrix<T, Dynamic, Dynamic>, Dynamic, Dynamic>
   SimplexTableau<T>::entries() const
   {
-    return entries_.block(0, 0, entries_.rows(), entries_.cols());
+    return entries_.block(0, 0, rows_, cols_);
   }
 
 
@@ -131,15 +191,15 @@ namespace LinearProgramming
   /**
    * @brief SimplexTableau<T>::row
    * Provides read-write access to the particular tableau row.
-   * NOTE: `RowXpr' is the special case of a `Block' expression,
-   * which can give optimization opportunities.
    * @param rowIdx
    * @return
    */
-  typename Matrix<T, Dynamic, Dynamic>::RowXpr
+  Block<Matrix<T, Dynamic, Dynamic>, 1, Dynamic>
   SimplexTableau<T>::row(DenseIndex rowIdx)
   {
-    return entries_.row(rowIdx);
+    return Block<Matrix<T, Dynamic, Dynamic>, 1, Dynamic>(
+      entries_, rowIdx, 0, 1, cols_
+    );
   }
 
 
@@ -150,10 +210,12 @@ namespace LinearProgramming
    * @param rowIdx
    * @return
    */
-  typename Matrix<T, Dynamic, Dynamic>::ConstRowXpr
+  const Block<const Matrix<T, Dynamic, Dynamic>, 1, Dynamic>
   SimplexTableau<T>::row(DenseIndex rowIdx) const
   {
-    return entries_.row(rowIdx);
+    return Block<const Matrix<T, Dynamic, Dynamic>, 1, Dynamic>(
+      entries_, rowIdx, 0, 1, cols_
+    );
   }
 
 
@@ -164,10 +226,12 @@ namespace LinearProgramming
    * @param colIdx
    * @return
    */
-  typename Matrix<T, Dynamic, Dynamic>::ColXpr
+  Block<Matrix<T, Dynamic, Dynamic>, Dynamic, 1>
   SimplexTableau<T>::col(DenseIndex colIdx)
   {
-    return entries_.col(colIdx);
+    return Block<Matrix<T, Dynamic, Dynamic>, Dynamic, 1>(
+      entries_, 0, colIdx, rows_, 1
+    );
   }
 
 
@@ -178,10 +242,12 @@ namespace LinearProgramming
    * @param colIdx
    * @return
    */
-  typename Matrix<T, Dynamic, Dynamic>::ConstColXpr
+  const Block<const Matrix<T, Dynamic, Dynamic>, Dynamic, 1>
   SimplexTableau<T>::col(DenseIndex colIdx) const
   {
-    return entries_.col(colIdx);
+    return Block<const Matrix<T, Dynamic, Dynamic>, Dynamic, 1>(
+      entries_, 0, colIdx, rows_, 1
+    );
   }
 
 
@@ -194,7 +260,7 @@ namespace LinearProgramming
   DenseIndex
   SimplexTableau<T>::rows() const
   {
-    return entries_.rows();
+    return rows_;
   }
 
 
@@ -207,7 +273,7 @@ namespace LinearProgramming
   DenseIndex
   SimplexTableau<T>::cols() const
   {
-    return entries_.cols();
+    return cols_;
   }
 
 
@@ -314,21 +380,42 @@ namespace LinearProgramming
   Matrix<T, Dynamic, 1>
   SimplexTableau<T>::extremePoint() const
   {
-    Matrix<T, Dynamic, 1> x_(basicVars_.size() + freeVars_.size(), 1);
+    Matrix<T, Dynamic, 1> x_;
+    extremePoint(x_);
+
+    return x_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::extremePoint
+   * Stores the current solution `x*' (see above) to `extremePoint',
+   * its storage is reused if it has the same size.
+   * NOTE: The rounding errors left by the degenerate pivots in place of
+   * the zero values (e.g. -1E-16) are stored as zeros.
+   * @param extremePoint
+   */
+  void
+  SimplexTableau<T>::extremePoint(Matrix<T, Dynamic, 1>& extremePoint) const
+  {
+    extremePoint.resize(basicVars_.size() + freeVars_.size());
 
-    for (DenseIndex i(0); i < entries_.rows() - 1; ++i)
+    for (DenseIndex i(0); i < rows_ - 1; ++i)
     {
       const DenseIndex varIdx(basicVars_[i]);
-      x_(varIdx) = entries_(i, entries_.cols() - 1);
+      const T& value(entries_(i, cols_ - 1));
+
+      extremePoint(varIdx) = (
+        value < T(0) && !isLessThanZero<T>(value) ? T(0) : value
+      );
     }
 
-    for (DenseIndex j(0); j < entries_.cols() - 1; j++)
+    for (DenseIndex j(0); j < cols_ - 1; j++)
     {
       const DenseIndex varIdx(freeVars_[j]);
-      x_(varIdx) = T(0);
+      extremePoint(varIdx) = T(0);
     }
-
-    return x_;
   }
 
 
@@ -342,10 +429,10 @@ namespace LinearProgramming
   {
     switch (goalType) {
       case OptimizationGoalType::Minimize:
-        return (entries_(entries_.rows() - 1, entries_.cols() - 1) * T(-1));
+        return (entries_(rows_ - 1, cols_ - 1) * T(-1));
 
       case OptimizationGoalType::Maximize:
-        return entries_(entries_.rows() - 1, entries_.cols() - 1);
+        return entries_(rows_ - 1, cols_ - 1);
 
       default:
         return T(0);
@@ -353,6 +440,166 @@ namespace LinearProgramming
   }
 
 
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::pivot
+   * Performs transforming operations using chosen
+   * pivot row `k' and column `s' of the tableau.
+   * `k' is the leaving variable index,
+   * `s' is the entering variable index.
+   * The pivot element is `α[k, s]'.
+   * @param rowIdx
+   * @param colIdx
+   */
+  void
+  SimplexTableau<T>::pivot(DenseIndex rowIdx, DenseIndex colIdx)
+  {
+    //Cache the value of the pivot element `α[k, s]'
+    const T pivotElement(entries_(rowIdx, colIdx));
+
+    //Swap the free and basic variable ~x[k] ↔ x[s]
+    std::swap(basicVars_[rowIdx], freeVars_[colIdx]);
+
+    //For the new row at the pivot position
+    //(new pivot row) = (old pivot row) / (old pivot)
+    for (DenseIndex j(0); j < cols_; ++j)
+    {
+      if (j != colIdx) //Skip pivot column
+      {
+        entries_(rowIdx, j) /= pivotElement; //!
+      }
+    }
+
+    //For the new pivot element value
+    //(new pivot) = 1 / (old pivot)
+    entries_(rowIdx, colIdx) = T(1) / pivotElement; //!
+
+    //For each row above and below the pivot row
+    for (DenseIndex i(0); i < rows_; ++i)
+    {
+      if (i != rowIdx) //Skip pivot row
+      {
+        const T factor(entries_(i, colIdx));
+        if (factor == T(0)) //The row is left unchanged
+        {
+          continue;
+        }
+
+        for (DenseIndex j(0); j < cols_; ++j)
+        {
+          if (j != colIdx) //Skip pivot column
+          {
+            //(new row) = (old row) - (factor) * (pivot row)
+            entries_(i, j) -= factor * entries_(rowIdx, j);
+          }
+        }
+      }
+    }
+
+    //For the new column at the pivot position
+    //(new pivot column) = (old pivot column) / ((-1) * (old pivot))
+    for (DenseIndex i(0); i < rows_; ++i)
+    {
+      if (i != rowIdx) //Skip pivot row
+      {
+        entries_(i, colIdx) /= pivotElement * T(-1); //!
+      }
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::insertRow
+   * Inserts the row of the new basic variable above `P'.
+   * The storage only grows if it has no spare row.
+   * @param basicVarIdx
+   * @param row The entries of the row, `β[k]' included.
+   */
+  void
+  SimplexTableau<T>::insertRow(
+    DenseIndex basicVarIdx, const Matrix<T, 1, Dynamic>& row
+  )
+  {
+    if (entries_.rows() <= rows_)
+    {
+      entries_.conservativeResize(rows_ + 1, entries_.cols());
+    }
+
+    entries_.row(rows_).head(cols_) = entries_.row(rows_ - 1).head(cols_);
+    entries_.row(rows_ - 1).head(cols_) = row;
+
+    basicVars_.push_back(basicVarIdx);
+    ++rows_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::insertColumn
+   * Inserts the column of the new free variable left of `β'.
+   * The storage only grows if it has no spare column.
+   * @param freeVarIdx
+   * @param column The entries of the column, `P[s]' included.
+   */
+  void
+  SimplexTableau<T>::insertColumn(
+    DenseIndex freeVarIdx, const Matrix<T, Dynamic, 1>& column
+  )
+  {
+    if (entries_.cols() <= cols_)
+    {
+      entries_.conservativeResize(entries_.rows(), cols_ + 1);
+    }
+
+    entries_.col(cols_).head(rows_) = entries_.col(cols_ - 1).head(rows_);
+    entries_.col(cols_ - 1).head(rows_) = column;
+
+    freeVars_.push_back(freeVarIdx);
+    ++cols_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::removeRow
+   * Removes the row of the basic variable (along w/ the variable),
+   * the storage is kept.
+   * @param rowIdx
+   */
+  void
+  SimplexTableau<T>::removeRow(DenseIndex rowIdx)
+  {
+    for (DenseIndex i(rowIdx + 1); i < rows_; ++i)
+    {
+      entries_.row(i - 1).head(cols_) = entries_.row(i).head(cols_);
+    }
+
+    basicVars_.erase(basicVars_.begin() + rowIdx);
+    --rows_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::removeColumn
+   * Removes the column of the free variable (along w/ the variable),
+   * the storage is kept.
+   * @param colIdx
+   */
+  void
+  SimplexTableau<T>::removeColumn(DenseIndex colIdx)
+  {
+    for (DenseIndex j(colIdx + 1); j < cols_; ++j)
+    {
+      entries_.col(j - 1).head(rows_) = entries_.col(j).head(rows_);
+    }
+
+    freeVars_.erase(freeVars_.begin() + colIdx);
+    --cols_;
+  }
+
+
   template<typename T>
   /**
    * @brief SimplexTableau<T>::SimplexTableau
@@ -388,27 +635,47 @@ namespace LinearProgramming
    */
   SimplexTableau<T>
   SimplexTableau<T>::makePhaseOne(const LinearProgramData<T> &linearProgramData)
+  {
+    //Make a new tableau for the Phase-1
+    SimplexTableau<T> phase1Tableau;
+    makePhaseOne(linearProgramData, phase1Tableau);
+
+    return phase1Tableau;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::makePhaseOne
+   * Constructs the Phase-1 tableau (see above) in place of `phase1Tableau'.
+   * Its storage is reused, so nothing is allocated if it is the tableau
+   * of the program of the same size.
+   * @param linearProgramData
+   * @param phase1Tableau
+   */
+  void
+  SimplexTableau<T>::makePhaseOne(
+    const LinearProgramData<T>& linearProgramData,
+    SimplexTableau<T>& phase1Tableau
+  )
   {
     //Count of artificial basic vars `~x' (== M) for the Phase-1 tableau
     const DenseIndex basicVarsCount(linearProgramData.constraintsCount());
     //Count of decision free vars `x' (== N) for the Phase-1 tableau
     const DenseIndex freeVarsCount(linearProgramData.variablesCount());
 
-    //Make a new tableau for the Phase-1
-    SimplexTableau<T> phase1Tableau;
-
     //Set phase to `One'
     phase1Tableau.phase_ = SolutionPhase::One;
 
     //Initialize vectors w/ variables indices
-    phase1Tableau.basicVars_ = vector<DenseIndex>(basicVarsCount);
+    phase1Tableau.basicVars_.resize(basicVarsCount);
     //For the basic artificial vars `~x[i]' where `i' in [N; N + M)
     for (DenseIndex i(freeVarsCount); i < freeVarsCount + basicVarsCount; ++i)
     {
       phase1Tableau.basicVars_[i - freeVarsCount] = i;
     }
 
-    phase1Tableau.freeVars_ = vector<DenseIndex>(freeVarsCount);
+    phase1Tableau.freeVars_.resize(freeVarsCount);
     //For the free decision vars `x[i]' where i in [0; N)
     for (DenseIndex i(0); i < freeVarsCount; ++i)
     {
@@ -419,9 +686,9 @@ namespace LinearProgramming
     //Initialize some of its entries (constraints coeffs matrix `α'
     //and right-hand-side column-vector `β' ) directly
     //from `linearProgramData'. `P' is left unintialized.
-    phase1Tableau.entries_ = Matrix<T, Dynamic, Dynamic>(
-      basicVarsCount + 1, freeVarsCount + 1
-    );
+    phase1Tableau.entries_.resize(basicVarsCount + 1, freeVarsCount + 1);
+    phase1Tableau.rows_ = basicVarsCount + 1;
+    phase1Tableau.cols_ = freeVarsCount + 1;
     phase1Tableau.entries_.block(0, 0, basicVarsCount, freeVarsCount) =
     linearProgramData.constraintsCoeffs;
     phase1Tableau.entries_.block(0, freeVarsCount, basicVarsCount, 1) =
@@ -448,19 +715,267 @@ namespace LinearProgramming
       phase1Tableau.entries_(phase1Tableau.entries_.rows() - 1, j) =
         phase1Tableau.entries_.col(j).head(basicVarsCount).sum() * T(-1);
     }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::makePhaseOne
+   * Constructs the Phase-1 tableau f/ the program w/ the implicit slacks
+   * (see `BoundedProgramData<T>'). Variables are indexed as follows:
+   *   `x[j]' are in [0; N), the slacks `s[i]' are in [N; N + M),
+   * the artificial variables are in [N + M; N + 2M).
+   * The slack `s[i]' is basic in the row `i' if it is feasible there
+   * (0 <= σ[i] * β[i] <= v[i]), the row is multiplied by `σ[i]' then.
+   * The rest of the rows get the artificial variables (and their slacks,
+   * if any, are the free variables), so the tableau is
+   * the (M+1) × (N+K+1) matrix, where `K' is the count of such slacks,
+   * and `P' is summed over the rows of the artificial variables only.
+   * @param boundedProgramData
+   * @return
+   */
+  SimplexTableau<T>
+  SimplexTableau<T>::makePhaseOne(
+    const BoundedProgramData<T>& boundedProgramData
+  )
+  {
+    //Make a new tableau for the Phase-1
+    SimplexTableau<T> phase1Tableau;
+    makePhaseOne(boundedProgramData, phase1Tableau);
 
     return phase1Tableau;
   }
 
 
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::makePhaseOne
+   * Constructs the Phase-1 tableau (see above) in place of `phase1Tableau'.
+   * @param boundedProgramData
+   * @param phase1Tableau
+   */
+  void
+  SimplexTableau<T>::makePhaseOne(
+    const BoundedProgramData<T>& boundedProgramData,
+    SimplexTableau<T>& phase1Tableau
+  )
+  {
+    const LinearProgramData<T>& linearProgramData(
+      boundedProgramData.linearProgramData
+    );
+    const Matrix<T, Dynamic, 1>& slackCoeffs(boundedProgramData.slackCoeffs);
+
+    //Count of the rows (== M) and of the decision vars `x' (== N)
+    const DenseIndex rowsCount(linearProgramData.constraintsCount());
+    const DenseIndex varsCount(linearProgramData.variablesCount());
+
+    phase1Tableau.phase_ = SolutionPhase::One;
+
+    //Pick the basic variable of each row
+    phase1Tableau.basicVars_.resize(rowsCount);
+    phase1Tableau.freeVars_.resize(varsCount);
+    for (DenseIndex j(0); j < varsCount; ++j)
+    {
+      phase1Tableau.freeVars_[j] = j;
+    }
+
+    for (DenseIndex i(0); i < rowsCount; ++i)
+    {
+      const DenseIndex slackIdx(varsCount + i);
+      const T& slackCoeff(slackCoeffs(i));
+      const T rhs(slackCoeff * linearProgramData.constraintsRHS(i));
+      const optional<T>& slackBound(boundedProgramData.upperBounds[slackIdx]);
+
+      if (
+        slackCoeff != T(0) && !isLessThanZero<T>(rhs) &&
+        (!slackBound || rhs <= *slackBound)
+      )
+      {
+        phase1Tableau.basicVars_[i] = slackIdx;
+      }
+      else
+      {
+        phase1Tableau.basicVars_[i] = varsCount + rowsCount + i;
+
+        if (slackCoeff != T(0))
+        {
+          phase1Tableau.freeVars_.push_back(slackIdx);
+        }
+      }
+    }
+
+    const DenseIndex colsCount(phase1Tableau.freeVars_.size());
+
+    phase1Tableau.entries_.resize(rowsCount + 1, colsCount + 1);
+    phase1Tableau.rows_ = rowsCount + 1;
+    phase1Tableau.cols_ = colsCount + 1;
+    phase1Tableau.entries_.rightCols(colsCount + 1 - varsCount).setZero();
+    phase1Tableau.entries_.row(rowsCount).setZero();
+
+    //The free slacks are in the order of their rows
+    DenseIndex slackColIdx(varsCount);
+    for (DenseIndex i(0); i < rowsCount; ++i)
+    {
+      const T& slackCoeff(slackCoeffs(i));
+      const T& rhs(linearProgramData.constraintsRHS(i));
+      const bool isArtificial(
+        phase1Tableau.basicVars_[i] >= varsCount + rowsCount
+      );
+
+      //The row of the slack is multiplied by `σ[i]', the one
+      //of the artificial variable is made (β[i] >= 0)
+      const T sign(
+        isArtificial ? (isLessThanZero<T>(rhs) ? T(-1) : T(1)) : slackCoeff
+      );
+
+      phase1Tableau.entries_.row(i).head(varsCount) =
+        linearProgramData.constraintsCoeffs.row(i) * sign;
+
+      T& rhsEntry(phase1Tableau.entries_(i, colsCount));
+      rhsEntry = rhs * sign;
+
+      if (!isArtificial)
+      {
+        //The rounding errors (e.g. -1E-16) are stored as zeros
+        if (rhsEntry < T(0))
+        {
+          rhsEntry = T(0);
+        }
+
+        continue;
+      }
+
+      if (slackCoeff != T(0))
+      {
+        phase1Tableau.entries_(i, slackColIdx++) = slackCoeff * sign;
+      }
+
+      //Each `P[j]' is the negative sum of the column above it
+      //over the rows of the artificial variables
+      phase1Tableau.entries_.row(rowsCount) -= phase1Tableau.entries_.row(i);
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::crash
+   * Replaces the artificial variables of the initial Phase-1 tableau
+   * w/ the decision ones where it keeps the tableau feasible, so
+   * the Phase-1 starts from the (partially) crashed basis.
+   * The column `α.col[j]' is pivoted into the row `i' if its only
+   * nonzero among the rows of the artificial variables is the pivot
+   * `α[i, j] > 0' and no other basic variable becomes negative,
+   * i.e. the basis matrix stays triangular. The slack-like (unit)
+   * columns are the simplest case: they only touch their own rows.
+   * Artificial variables are left only for the rows that can't be
+   * covered this way, if there are none, (~F* == 0) already.
+   * @param linearProgramData
+   * @param phase1Tableau
+   * @return Count of the artificial variables replaced.
+   */
+  DenseIndex
+  SimplexTableau<T>::crash(
+    const LinearProgramData<T>& linearProgramData,
+    SimplexTableau<T>& phase1Tableau
+  ) throw(invalid_argument)
+  {
+    if (phase1Tableau.phase_ != SolutionPhase::One)
+    {
+      throw invalid_argument("Tableau is not a Phase-1 tableau");
+    }
+
+    //Count of decision vars `x' (N), the artificial ones are >= N
+    const DenseIndex varsCount(linearProgramData.variablesCount());
+    const DenseIndex rhsColIdx(phase1Tableau.cols_ - 1);
+
+    DenseIndex ret(0);
+    //Pivoting a column can't change the rows of the artificial
+    //variables, but it can make the next column triangular, so repeat
+    //while anything is pivoted
+    for (bool isPivoted(true); isPivoted; )
+    {
+      isPivoted = false;
+
+      for (DenseIndex j(0); j < rhsColIdx; ++j)
+      {
+        if (phase1Tableau.freeVars_[j] >= varsCount)
+        {
+          continue;
+        }
+
+        //Find the only nonzero `α[i, j]' of the artificial vars rows
+        DenseIndex rowIdx(-1);
+        bool isTriangular(true);
+        for (DenseIndex i(0); i < phase1Tableau.rows_ - 1; ++i)
+        {
+          if (
+            phase1Tableau.basicVars_[i] >= varsCount &&
+            phase1Tableau.entries_(i, j) != T(0)
+          )
+          {
+            isTriangular = (rowIdx < 0);
+            if (!isTriangular)
+            {
+              break;
+            }
+
+            rowIdx = i;
+          }
+        }
+
+        if (
+          !isTriangular || rowIdx < 0 ||
+          !isGreaterThanZero<T>(phase1Tableau.entries_(rowIdx, j))
+        )
+        {
+          continue;
+        }
+
+        //(β[k] - α[k, j] * β[i] / α[i, j] >= 0) for the other rows
+        const T pivot(phase1Tableau.entries_(rowIdx, j));
+        const T rhs(phase1Tableau.entries_(rowIdx, rhsColIdx));
+        bool isFeasible(true);
+        for (DenseIndex k(0); k < phase1Tableau.rows_ - 1; ++k)
+        {
+          const T coeff(phase1Tableau.entries_(k, j));
+          if (
+            k != rowIdx && coeff > T(0) &&
+            phase1Tableau.entries_(k, rhsColIdx) * pivot < rhs * coeff
+          )
+          {
+            isFeasible = false;
+            break;
+          }
+        }
+
+        if (isFeasible)
+        {
+          phase1Tableau.pivot(rowIdx, j);
+          isPivoted = true;
+          ++ret;
+
+          //The ties of the ratios leave the rounding errors only
+          for (DenseIndex k(0); k < phase1Tableau.rows_ - 1; ++k)
+          {
+            if (phase1Tableau.entries_(k, rhsColIdx) < T(0))
+            {
+              phase1Tableau.entries_(k, rhsColIdx) = T(0);
+            }
+          }
+        }
+      }
+    }
+
+    return ret;
+  }
+
+
   template<typename T>
   /**
    * @brief SimplexTableau<T>::makePhase2
    * Constructs the Phase-2 tableau from the given optimal Phase-1 tableau
-   * by dropping all the columns corresponding to the basic artificial
-   * variables that was forced out of the basis at the Phase-1 of
-   * the Simplex algorithm.
-   * TODO: [2;2] Add support for degenerate cases.
+   * (see `transformToPhaseTwo').
    * @param linearProgramData
    * @param phase1Tableau
    * @return
@@ -471,131 +986,185 @@ namespace LinearProgramming
     const SimplexTableau<T>& phase1Tableau
   ) throw(invalid_argument)
   {
-    if (phase1Tableau.phase_ != SolutionPhase::One)
+    //Make a new Phase-2 tableau
+    SimplexTableau<T> phase2Tableau(phase1Tableau);
+    transformToPhaseTwo(linearProgramData, phase2Tableau);
+
+    return phase2Tableau;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::transformToPhaseTwo
+   * Transforms the given optimal Phase-1 tableau to the Phase-2 one
+   * in place:
+   *   the artificial variables left in the (degenerate) basis at
+   * the zero level are driven out of it by the degenerate pivots
+   * (the largest pivot among the decision variables is taken),
+   *   the rows where it is impossible (i.e. the ones of the redundant
+   * constraints) are dropped,
+   *   the columns of the (now free) artificial variables are dropped,
+   *   the objective function row `P' is recomputed for `c'.
+   * The tableau is compacted within its storage, nothing is allocated.
+   * @param linearProgramData
+   * @param tableau
+   */
+  void
+  SimplexTableau<T>::transformToPhaseTwo(
+    const LinearProgramData<T>& linearProgramData,
+    SimplexTableau<T>& tableau
+  ) throw(invalid_argument)
+  {
+    transformToPhaseTwo(linearProgramData.objectiveFunctionCoeffs, tableau);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexTableau<T>::transformToPhaseTwo
+   * Transforms the given optimal Phase-1 tableau to the Phase-2 one
+   * (see above) for the objective function coefficients `c' of all
+   * the non-artificial variables, i.e. the ones w/ the indices < `c.cols()'
+   * (e.g. `x' and `s' of `BoundedProgramData<T>').
+   * @param objectiveFunctionCoeffs
+   * @param tableau
+   */
+  void
+  SimplexTableau<T>::transformToPhaseTwo(
+    const Matrix<T, 1, Dynamic>& objectiveFunctionCoeffs,
+    SimplexTableau<T>& tableau
+  ) throw(invalid_argument)
+  {
+    if (tableau.phase_ != SolutionPhase::One)
     {
       throw invalid_argument("Tableau is not a Phase-1 tableau");
     }
 
-    //Count of free decision vars `x' (~N) in the Phase-1 tableau
-    const DenseIndex phase1FreeVarsCount(phase1Tableau.freeVarsCount());
-    //Count of basic vars `~x' (M) in the Phase-2 tableau
-    //is equal to the one of Phase-1 tableau (~M)
-    const DenseIndex phase2BasicVarsCount(phase1Tableau.basicVarsCount());
-    //Count of free vars `x' (N) in the Phase-2 tableau
-    //is equal to ~M - ~N
-    const DenseIndex phase2FreeVarsCount(
-      phase1FreeVarsCount - phase2BasicVarsCount
-    );
+    //Count of decision vars `x' (N), the artificial ones are >= N
+    const DenseIndex varsCount(objectiveFunctionCoeffs.cols());
 
-    //Make a new Phase-2 tableau
-    SimplexTableau<T> phase2Tableau;
+    //Drive the artificial variables `~x[i]' out of the basis
+    for (DenseIndex i(0); i < tableau.rows_ - 1; ++i)
+    {
+      if (tableau.basicVars_[i] >= varsCount)
+      {
+        DenseIndex pivotColIdx(-1);
+        T maxPivot(0);
 
-    //Set phase to `Two'
-    phase2Tableau.phase_ = SolutionPhase::Two;
+        for (DenseIndex j(0); j < tableau.cols_ - 1; ++j)
+        {
+          if (tableau.freeVars_[j] < varsCount)
+          {
+            const T pivot(absoluteValue<T>(tableau.entries_(i, j)));
+            if (isGreaterThan<T>(pivot, maxPivot))
+            {
+              maxPivot = pivot;
+              pivotColIdx = j;
+            }
+          }
+        }
 
-    //Initialize vectors w/ variables indices
-    //Copy all the basic variables `~x' from the Phase-1 tableau
-    phase2Tableau.basicVars_ = vector<DenseIndex>(phase2BasicVarsCount);
-    std::copy(
-      phase1Tableau.basicVars_.begin(),
-      phase1Tableau.basicVars_.end(),
-      phase2Tableau.basicVars_.begin()
-    );
+        //If (∀j < N: α[i, j] == 0), the `i'-th constraint is redundant
+        if (pivotColIdx >= 0)
+        {
+          //The artificial variable is at the zero level (~F* == 0),
+          //so is the entering one
+          tableau.entries_(i, tableau.cols_ - 1) = T(0);
+          tableau.pivot(i, pivotColIdx);
+        }
+      }
+    }
 
-    //Copy all the free variables `x[i]' except those vars
-    //that was forced out of the basis at the Phase-1 (artificial)
-    phase2Tableau.freeVars_ = vector<DenseIndex>(phase2FreeVarsCount);
-    size_t varsCount(0);
-    std::copy_if(
-      phase1Tableau.freeVars_.begin(),
-      phase1Tableau.freeVars_.end(),
-      phase2Tableau.freeVars_.begin(),
-      [phase1FreeVarsCount, phase2FreeVarsCount, &varsCount]
-      (DenseIndex varIdx)
+    //Drop the rows where the artificial variables are still basic
+    DenseIndex rowsCount(0);
+    for (DenseIndex i(0); i < tableau.rows_ - 1; ++i)
+    {
+      if (tableau.basicVars_[i] < varsCount)
       {
-        return (
-          varIdx < phase1FreeVarsCount &&
-          ++varsCount <= size_t(phase2FreeVarsCount)
-        );
+        if (rowsCount != i)
+        {
+          tableau.entries_.row(rowsCount).head(tableau.cols_) =
+            tableau.entries_.row(i).head(tableau.cols_);
+          tableau.basicVars_[rowsCount] = tableau.basicVars_[i];
+        }
+
+        ++rowsCount;
       }
-    );
+    }
 
-    //Fill the coeffs matrix `α' using the Phase-1 tableau
-    phase2Tableau.entries_ = Matrix<T, Dynamic, Dynamic>(
-      phase2BasicVarsCount + 1, phase2FreeVarsCount + 1
-    );
+    tableau.basicVars_.resize(rowsCount);
 
-    //Copy only necessary coeffs `α' from the Phase-1 tableau
-    //From the columns corresponding to the free variables
-    DenseIndex colIdx(0);
-    for (DenseIndex j(0); j < phase1Tableau.entries_.cols() - 1; ++j)
+    //Drop the columns of the artificial variables
+    //(`β' is the last column, it is kept)
+    DenseIndex colsCount(0);
+    for (DenseIndex j(0); j < tableau.cols_; ++j)
     {
-      if (colIdx < phase2FreeVarsCount)
+      const bool isRhs(j == tableau.cols_ - 1);
+
+      if (isRhs || tableau.freeVars_[j] < varsCount)
       {
-        //If it is the column corresponding to the free variable
-        if (phase1Tableau.freeVars_[j] < phase1FreeVarsCount)
+        if (colsCount != j)
         {
-          //Copy this column w/o the last element to the Phase-2 tableau
-          for (DenseIndex i(0); i < phase2Tableau.entries_.rows() - 1; ++i)
+          tableau.entries_.col(colsCount).head(rowsCount) =
+            tableau.entries_.col(j).head(rowsCount);
+
+          if (!isRhs)
           {
-            phase2Tableau.entries_(i, colIdx) =
-              phase1Tableau.entries_(i, j);
+            tableau.freeVars_[colsCount] = tableau.freeVars_[j];
           }
-          ++colIdx;
         }
-      }
-      else
-      {
-        break;
+
+        ++colsCount;
       }
     }
 
-    //Fill the RHS vector `β' (the last column)
-    //Copy its entries from the Phase-1 tableau w/o the last element
-    for (DenseIndex i(0); i < phase1Tableau.entries_.rows() - 1; ++i)
-    {
-      phase2Tableau.entries_(i, phase2Tableau.entries_.cols() - 1) =
-        phase1Tableau.entries_(i, phase1Tableau.entries_.cols() - 1);
-    }
+    tableau.freeVars_.resize(colsCount - 1);
+
+    tableau.phase_ = SolutionPhase::Two;
+    tableau.rows_ = rowsCount + 1;
+    tableau.cols_ = colsCount;
 
     //Fill the objective function coeffs `P[j]' (row at the bottom)
-    for (DenseIndex j(0); j < phase2Tableau.entries_.cols() - 1; ++j)
+    for (DenseIndex j(0); j < tableau.cols_ - 1; ++j)
     {
       T sum(0); //Dot product of `c' and `-α.col[j]'
       //(free variable x[j] in `α.col[j]' is set to -1,
       //other free vars are set to 0)
-      for (DenseIndex i(0); i < phase2Tableau.entries_.rows() - 1; ++i)
+      for (DenseIndex i(0); i < tableau.rows_ - 1; ++i)
       {
-        const DenseIndex varIdx(phase2Tableau.basicVars_[i]);
-        sum += linearProgramData.objectiveFunctionCoeffs(varIdx) *
-               phase2Tableau.entries_(i, j) *
+        const DenseIndex varIdx(tableau.basicVars_[i]);
+        sum += objectiveFunctionCoeffs(varIdx) *
+               tableau.entries_(i, j) *
                T(-1);
       }
 
-      const DenseIndex varIdx(phase2Tableau.freeVars_[j]);
-      sum += linearProgramData.objectiveFunctionCoeffs(varIdx);
+      const DenseIndex varIdx(tableau.freeVars_[j]);
+      sum += objectiveFunctionCoeffs(varIdx);
 
-      phase2Tableau.entries_(phase2Tableau.entries_.rows() - 1, j) = sum;
+      tableau.entries_(tableau.rows_ - 1, j) = sum;
     }
 
     //Set objective function value P[0] (the rightmost bottom element)
     T sum(0); //Dot product of `c' and `-β'
     //(all free vars in `β' are set to 0)
-    for (DenseIndex i(0); i < phase2Tableau.entries_.rows() - 1; ++i)
+    for (DenseIndex i(0); i < tableau.rows_ - 1; ++i)
     {
-      const DenseIndex varIdx(phase2Tableau.basicVars_[i]);
-      sum += linearProgramData.objectiveFunctionCoeffs(varIdx) *
-             phase2Tableau.entries_(i, phase2Tableau.entries_.cols() - 1) *
+      const DenseIndex varIdx(tableau.basicVars_[i]);
+      sum += objectiveFunctionCoeffs(varIdx) *
+             tableau.entries_(i, tableau.cols_ - 1) *
              T(-1);
     }
 
-    phase2Tableau.entries_(
-      phase2Tableau.entries_.rows() - 1,
-      phase2Tableau.entries_.cols() - 1
-    ) = sum;
-
-    return phase2Tableau;
+    tableau.entries_(tableau.rows_ - 1, tableau.cols_ - 1) = sum;
   }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `simplextableau.cxx'
+  extern template class SimplexTableau<NumericTypes::real_t>;
+  extern template class SimplexTableau<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
 }
 
 
@@ -0,0 +1,12 @@
+﻿#include "simplexworkspace.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class SimplexWorkspace<NumericTypes::real_t>;
+  template class SimplexWorkspace<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
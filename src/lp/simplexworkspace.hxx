@@ -0,0 +1,57 @@
+﻿#pragma once
+
+#ifndef SIMPLEXWORKSPACE_HXX
+#define SIMPLEXWORKSPACE_HXX
+
+
+#include <stdexcept>
+
+#include "boost/optional.hpp"
+
+#include "linearprogramdata.hxx"
+#include "simplextableau.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using NumericTypes::real_t;
+  using std::invalid_argument;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The SimplexWorkspace class
+   * Owns the tableau of `SimplexSolver<T>', so that it is only allocated
+   * once: every next program of the same size is solved in the same
+   * storage. The Phase-2 tableau is made of the Phase-1 one in place.
+   */
+  class SimplexWorkspace
+  {
+    public:
+      SimplexWorkspace() = default;
+
+      SimplexTableau<T>& makePhaseOne(
+        const LinearProgramData<T>& linearProgramData
+      );
+
+      SimplexTableau<T>& makePhaseTwo(
+        const LinearProgramData<T>& linearProgramData
+      ) throw(invalid_argument);
+
+      SimplexTableau<T>* tableau();
+
+      void clear();
+
+
+    private:
+      optional<SimplexTableau<T>> tableau_;
+  };
+}
+
+
+#include "simplexworkspace.txx"
+
+
+#endif // SIMPLEXWORKSPACE_HXX
@@ -0,0 +1,107 @@
+﻿#pragma once
+
+#ifndef SIMPLEXWORKSPACE_TXX
+#define SIMPLEXWORKSPACE_TXX
+
+
+#include "simplexworkspace.hxx"
+
+#include <stdexcept>
+
+#include "boost/optional.hpp"
+
+#include "linearprogramdata.hxx"
+#include "simplextableau.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::none;
+  using std::invalid_argument;
+
+
+  template<typename T>
+  /**
+   * @brief SimplexWorkspace<T>::makePhaseOne
+   * Constructs the Phase-1 tableau of the program
+   * (see `SimplexTableau<T>::makePhaseOne').
+   * @param linearProgramData
+   * @return The tableau, it is valid until the next `makePhaseOne'
+   * or `clear'.
+   */
+  SimplexTableau<T>&
+  SimplexWorkspace<T>::makePhaseOne(
+    const LinearProgramData<T>& linearProgramData
+  )
+  {
+    if (tableau_)
+    {
+      SimplexTableau<T>::makePhaseOne(linearProgramData, *tableau_);
+    }
+    else
+    {
+      tableau_ = SimplexTableau<T>::makePhaseOne(linearProgramData);
+    }
+
+    return *tableau_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexWorkspace<T>::makePhaseTwo
+   * Transforms the current (optimal) Phase-1 tableau to the Phase-2 one
+   * (see `SimplexTableau<T>::transformToPhaseTwo').
+   * @param linearProgramData
+   * @return The same tableau as `makePhaseOne' returned.
+   */
+  SimplexTableau<T>&
+  SimplexWorkspace<T>::makePhaseTwo(
+    const LinearProgramData<T>& linearProgramData
+  ) throw(invalid_argument)
+  {
+    if (!tableau_)
+    {
+      throw invalid_argument("There is no Phase-1 tableau");
+    }
+
+    SimplexTableau<T>::transformToPhaseTwo(linearProgramData, *tableau_);
+
+    return *tableau_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexWorkspace<T>::tableau
+   * @return The last tableau made (as it was left by the solver),
+   * `nullptr' if there is none.
+   */
+  SimplexTableau<T>*
+  SimplexWorkspace<T>::tableau()
+  {
+    return (tableau_ ? &*tableau_ : nullptr);
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SimplexWorkspace<T>::clear
+   * Releases the storage of the tableau.
+   */
+  void
+  SimplexWorkspace<T>::clear()
+  {
+    tableau_ = none;
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `simplexworkspace.cxx'
+  extern template class SimplexWorkspace<NumericTypes::real_t>;
+  extern template class SimplexWorkspace<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // SIMPLEXWORKSPACE_TXX
@@ -0,0 +1,12 @@
+﻿#include "solutioncache.hxx"
+
+#include "../math/numerictypes.hxx"
+
+
+namespace LinearProgramming
+{
+#ifndef LP_WITH_MULTIPRECISION
+  template class SolutionCache<NumericTypes::real_t>;
+  template class SolutionCache<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
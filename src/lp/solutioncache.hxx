@@ -0,0 +1,164 @@
+﻿#pragma once
+
+#ifndef SOLUTIONCACHE_HXX
+#define SOLUTIONCACHE_HXX
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#include "boost/optional.hpp"
+
+#include "degeneracystrategy.hxx"
+#include "dualizationmode.hxx"
+#include "linearprogramdata.hxx"
+#include "linearprogramsolution.hxx"
+#include "simplexsolver.hxx"
+#include "solutiontype.hxx"
+#include "solvertype.hxx"
+#include "../math/numerictypes.hxx"
+#include "../misc/hasher.hxx"
+#include "../misc/lrucache.hxx"
+#include "../misc/utils.hxx"
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using NumericTypes::real_t;
+  using std::istream;
+  using std::mutex;
+  using std::ostream;
+  using std::pair;
+  using std::size_t;
+  using std::string;
+  using Utils::AlwaysFalse;
+  using Utils::Digest;
+  using Utils::DigestHash;
+  using Utils::Hasher;
+  using Utils::LruCache;
+
+
+  template<typename T = real_t>
+  /**
+   * @brief The SolutionCache class
+   * Content-addressed cache of the solutions. The key is the hash of
+   * the canonical form of the program (see `makeKey'), so the same
+   * program gives the same key whichever front-end has built it.
+   * The recently used solutions are kept in memory, the persistent tier
+   * (if the directory is given) keeps every solution in its own file,
+   * so that it is shared by the processes and outlives them.
+   * All the members are thread-safe.
+   */
+  class SolutionCache
+  {
+    public:
+      using Key = Digest;
+
+      using Result = pair<SolutionType, optional<LinearProgramSolution<T>>>;
+
+
+      explicit SolutionCache(
+        size_t capacity = SolutionCacheCapacity,
+        const string& directoryName = string()
+      );
+
+      SolutionCache(const SolutionCache&) = delete;
+
+      SolutionCache& operator =(const SolutionCache&) = delete;
+
+      const string& directoryName() const;
+
+      static Key makeKey(
+        const LinearProgramData<T>& linearProgramData,
+        SolverType solverType = SolverType::Simplex,
+        DegeneracyStrategy degeneracyStrategy = DegeneracyStrategy::None,
+        DualizationMode dualizationMode = DualizationMode::Never,
+        bool isWarmStarted = false
+      );
+
+      optional<Result> find(const Key& key);
+
+      void insert(const Key& key, const Result& result);
+
+      Result solve(SimplexSolver<T>& solver);
+
+      void clear();
+
+
+    private:
+      string directoryName_;
+
+      //Guards everything below
+      mutex mutex_;
+
+      LruCache<Key, Result, DigestHash> entries_;
+
+
+      string fileName(const Key& key) const;
+
+      optional<Result> readFile(const Key& key) const;
+
+      void writeFile(const Key& key, const Result& result) const;
+  };
+
+
+  namespace Detail
+  {
+    template<typename T = real_t>
+    /**
+     * @brief hashValue
+     * Adds the canonical form of `value' to `hasher'.
+     * @param hasher
+     * @param value
+     */
+    void
+    hashValue(Hasher& hasher, const T& value)
+    {
+      static_assert(
+        AlwaysFalse<T>::value,
+        "LinearProgramming::Detail::hashValue<T>: "
+        "You can only use one of the specified template specializations!"
+      );
+    }
+
+
+    template<typename T = real_t>
+    void
+    writeCachedValue(ostream& stream, const T& value)
+    {
+      static_assert(
+        AlwaysFalse<T>::value,
+        "LinearProgramming::Detail::writeCachedValue<T>: "
+        "You can only use one of the specified template specializations!"
+      );
+    }
+
+
+    template<typename T = real_t>
+    bool
+    readCachedValue(istream& stream, T& value)
+    {
+      static_assert(
+        AlwaysFalse<T>::value,
+        "LinearProgramming::Detail::readCachedValue<T>: "
+        "You can only use one of the specified template specializations!"
+      );
+
+      return false;
+    }
+  }
+}
+
+
+#include "solutioncache.txx"
+
+
+#endif // SOLUTIONCACHE_HXX
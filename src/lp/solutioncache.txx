@@ -0,0 +1,557 @@
+﻿#pragma once
+
+#ifndef SOLUTIONCACHE_TXX
+#define SOLUTIONCACHE_TXX
+
+
+#include "solutioncache.hxx"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <fstream>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "boost/optional.hpp"
+#include "eigen3/Eigen/Core"
+#include "fmt/format.h"
+
+#include "dualizationmode.hxx"
+#include "linearprogramdata.hxx"
+#include "linearprogramsolution.hxx"
+#include "simplexsolver.hxx"
+#include "solutiontype.hxx"
+#include "solvertype.hxx"
+#include "../math/numerictypes.hxx"
+#include "../misc/hasher.hxx"
+#include "../config.hxx"
+
+
+namespace LinearProgramming
+{
+  using boost::optional;
+  using namespace Config::LinearProgramming;
+  using Eigen::DenseIndex;
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using NumericTypes::Field;
+  using NumericTypes::integer_t;
+  using NumericTypes::rational_t;
+  using NumericTypes::real_t;
+  using std::ifstream;
+  using std::istream;
+  using std::lock_guard;
+  using std::ofstream;
+  using std::ostream;
+  using std::size_t;
+  using std::string;
+  using Utils::Hasher;
+
+
+  namespace Detail
+  {
+    //NOTE: `LPSC' in the little-endian byte order
+    constexpr uint32_t SolutionCacheMagic = 0x4353504c;
+
+
+    inline void
+    writeCachedWord(ostream& stream, uint64_t word)
+    {
+      stream.write(reinterpret_cast<const char*>(&word), sizeof(word));
+    }
+
+
+    inline bool
+    readCachedWord(istream& stream, uint64_t& word)
+    {
+      return bool(stream.read(reinterpret_cast<char*>(&word), sizeof(word)));
+    }
+
+
+    template<typename T>
+    /**
+     * @brief cachedField
+     * @return Field of `T' (the part of the keys and of the files).
+     */
+    Field
+    cachedField();
+
+
+#ifndef LP_WITH_MULTIPRECISION
+    template<>
+    inline Field
+    cachedField<real_t>()
+    {
+      return Field::Real;
+    }
+
+
+    template<>
+    inline Field
+    cachedField<rational_t>()
+    {
+      return Field::Rational;
+    }
+
+
+    template<>
+    inline void
+    hashValue<real_t>(Hasher& hasher, const real_t& value)
+    {
+      //NOTE: `-0' and `0' are the same coefficient
+      uint64_t bits(0);
+      if (value != real_t(0))
+      {
+        std::memcpy(&bits, &value, sizeof(bits));
+      }
+
+      hasher.add(bits);
+    }
+
+
+    template<>
+    inline void
+    hashValue<rational_t>(Hasher& hasher, const rational_t& value)
+    {
+      //NOTE: `boost::rational' is always in lowest terms w/ the positive
+      //denominator, so the pair is canonical
+      hasher.add(uint64_t(value.numerator()));
+      hasher.add(uint64_t(value.denominator()));
+    }
+
+
+    template<>
+    inline void
+    writeCachedValue<real_t>(ostream& stream, const real_t& value)
+    {
+      uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+
+      writeCachedWord(stream, bits);
+    }
+
+
+    template<>
+    inline void
+    writeCachedValue<rational_t>(ostream& stream, const rational_t& value)
+    {
+      writeCachedWord(stream, uint64_t(value.numerator()));
+      writeCachedWord(stream, uint64_t(value.denominator()));
+    }
+
+
+    template<>
+    inline bool
+    readCachedValue<real_t>(istream& stream, real_t& value)
+    {
+      uint64_t bits;
+      if (!readCachedWord(stream, bits))
+      {
+        return false;
+      }
+
+      std::memcpy(&value, &bits, sizeof(value));
+
+      return true;
+    }
+
+
+    template<>
+    inline bool
+    readCachedValue<rational_t>(istream& stream, rational_t& value)
+    {
+      uint64_t numerator;
+      uint64_t denominator;
+      if (
+        !readCachedWord(stream, numerator) ||
+        !readCachedWord(stream, denominator) ||
+        integer_t(denominator) <= integer_t(0)
+      )
+      {
+        return false;
+      }
+
+      value.assign(integer_t(numerator), integer_t(denominator));
+
+      return true;
+    }
+#endif // LP_WITH_MULTIPRECISION
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SolutionCache<T>::SolutionCache
+   * @param capacity Count of the solutions kept in memory.
+   * @param directoryName Existing directory of the persistent tier,
+   * the empty one disables it.
+   */
+  SolutionCache<T>::SolutionCache(
+    size_t capacity, const string& directoryName
+  ) :
+    directoryName_(directoryName),
+    entries_(capacity)
+  { }
+
+
+  template<typename T>
+  const string&
+  SolutionCache<T>::directoryName() const
+  {
+    return directoryName_;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SolutionCache<T>::makeKey
+   * Hashes everything the solution depends on: the field, the solver,
+   * the pivoting rule, the degeneracy strategy, the dualization mode
+   * and whether the solve may start from the cached basis (any of them
+   * may end up at the other optimal vertex), the iterations limit
+   * and the coefficients (row by row, w/o regard to the storage order
+   * of the matrices).
+   * @param linearProgramData
+   * @param solverType
+   * @param degeneracyStrategy
+   * @param dualizationMode
+   * @param isWarmStarted Whether the solver has got the basis cache.
+   * @return
+   */
+  typename SolutionCache<T>::Key
+  SolutionCache<T>::makeKey(
+    const LinearProgramData<T>& linearProgramData, SolverType solverType,
+    DegeneracyStrategy degeneracyStrategy, DualizationMode dualizationMode,
+    bool isWarmStarted
+  )
+  {
+    const auto& objective(linearProgramData.objectiveFunctionCoeffs);
+    const auto& constraints(linearProgramData.constraintsCoeffs);
+    const auto& rhs(linearProgramData.constraintsRHS);
+
+    Hasher hasher(SolutionCacheFormatVersion);
+
+    hasher.add(uint64_t(Detail::cachedField<T>()));
+    hasher.add(uint64_t(solverType));
+#ifdef LP_WITH_BLAND_RULE
+    //NOTE: It was `1' while Bland's rule was used for every pivot
+    hasher.add(uint64_t(2));
+#else // LP_WITH_BLAND_RULE
+    hasher.add(uint64_t(0));
+#endif // LP_WITH_BLAND_RULE
+    hasher.add(uint64_t(degeneracyStrategy));
+    hasher.add(uint64_t(dualizationMode));
+    hasher.add(uint64_t(isWarmStarted));
+    hasher.add(uint64_t(MaxSimplexIterations));
+
+    hasher.add(uint64_t(constraints.rows()));
+    hasher.add(uint64_t(constraints.cols()));
+
+    for (DenseIndex j(0); j < objective.cols(); ++j)
+    {
+      Detail::hashValue<T>(hasher, objective(j));
+    }
+
+    for (DenseIndex i(0); i < constraints.rows(); ++i)
+    {
+      for (DenseIndex j(0); j < constraints.cols(); ++j)
+      {
+        Detail::hashValue<T>(hasher, constraints(i, j));
+      }
+    }
+
+    for (DenseIndex i(0); i < rhs.rows(); ++i)
+    {
+      Detail::hashValue<T>(hasher, rhs(i));
+    }
+
+    return hasher.digest();
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SolutionCache<T>::find
+   * Looks the solution up in memory, then in the persistent tier.
+   * @param key
+   * @return (optional) The cached result.
+   */
+  optional<typename SolutionCache<T>::Result>
+  SolutionCache<T>::find(const Key& key)
+  {
+    {
+      lock_guard<mutex> lock(mutex_);
+
+      const Result* const result(entries_.find(key));
+      if (result != nullptr)
+      {
+        return *result;
+      }
+    }
+
+    optional<Result> ret;
+
+    if (!directoryName_.empty())
+    {
+      ret = readFile(key);
+      if (ret)
+      {
+        lock_guard<mutex> lock(mutex_);
+        entries_.insert(key, *ret);
+      }
+    }
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SolutionCache<T>::insert
+   * @param key
+   * @param result
+   */
+  void
+  SolutionCache<T>::insert(const Key& key, const Result& result)
+  {
+    {
+      lock_guard<mutex> lock(mutex_);
+      entries_.insert(key, result);
+    }
+
+    if (!directoryName_.empty())
+    {
+      writeFile(key, result);
+    }
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SolutionCache<T>::solve
+   * Solves the program of `solver' unless its solution is cached.
+   * The files don't keep the sensitivity analysis, so the optimal
+   * solution w/o one is solved again if `solver' is to make it.
+   * @param solver
+   * @return
+   */
+  typename SolutionCache<T>::Result
+  SolutionCache<T>::solve(SimplexSolver<T>& solver)
+  {
+    const Key key(
+      makeKey(
+        solver.linearProgramData(), SolverType::Simplex,
+        solver.degeneracyStrategy(), solver.dualizationMode(),
+        bool(solver.basisCache())
+      )
+    );
+
+    optional<Result> ret(find(key));
+    if (
+      ret && solver.isSensitivityAnalysisEnabled() &&
+      solver.dualizationMode() != DualizationMode::Always &&
+      ret->second && !ret->second->sensitivityAnalysis
+    )
+    {
+      ret = boost::none;
+    }
+
+    if (!ret)
+    {
+      ret = solver.solve();
+      insert(key, *ret);
+    }
+
+    return *ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SolutionCache<T>::clear
+   * Drops the solutions kept in memory, the files are left intact.
+   */
+  void
+  SolutionCache<T>::clear()
+  {
+    lock_guard<mutex> lock(mutex_);
+    entries_.clear();
+  }
+
+
+  template<typename T>
+  string
+  SolutionCache<T>::fileName(const Key& key) const
+  {
+    return fmt::format("{}/{}.lpsc", directoryName_, key.toString());
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SolutionCache<T>::readFile
+   * NOTE: The files are written in the native byte order, so the tier
+   * is only shared by the machines of the same architecture.
+   * @param key
+   * @return (optional) The result, `none' if the file is missing,
+   * corrupted or stale.
+   */
+  optional<typename SolutionCache<T>::Result>
+  SolutionCache<T>::readFile(const Key& key) const
+  {
+    optional<Result> ret;
+
+    ifstream stream(fileName(key), std::ios::binary);
+    if (!stream)
+    {
+      return ret;
+    }
+
+    uint64_t header;
+    uint64_t field;
+    uint64_t high;
+    uint64_t low;
+    uint64_t type;
+    uint64_t size;
+    if (
+      !Detail::readCachedWord(stream, header) ||
+      header != (
+        uint64_t(SolutionCacheFormatVersion) << 32 | Detail::SolutionCacheMagic
+      ) ||
+      !Detail::readCachedWord(stream, field) ||
+      field != uint64_t(Detail::cachedField<T>()) ||
+      !Detail::readCachedWord(stream, high) || high != key.high ||
+      !Detail::readCachedWord(stream, low) || low != key.low ||
+      !Detail::readCachedWord(stream, type) ||
+      !Detail::readCachedWord(stream, size)
+    )
+    {
+      return ret;
+    }
+
+    Result result(
+      static_cast<SolutionType>(type), optional<LinearProgramSolution<T>>()
+    );
+
+    //NOTE: The size is `~0' if there is no solution
+    if (size != ~uint64_t(0))
+    {
+      //Every value takes at least a word, a corrupted size must not make
+      //us allocate more than the file holds
+      const auto offset(stream.tellg());
+      stream.seekg(0, std::ios::end);
+      const auto fileSize(stream.tellg());
+      stream.seekg(offset);
+
+      if (size >= uint64_t(fileSize - offset) / sizeof(uint64_t))
+      {
+        return ret;
+      }
+
+      T extremeValue;
+      Matrix<T, Dynamic, 1> extremePoint(static_cast<DenseIndex>(size));
+
+      if (!Detail::readCachedValue<T>(stream, extremeValue))
+      {
+        return ret;
+      }
+
+      for (DenseIndex i(0); i < extremePoint.rows(); ++i)
+      {
+        if (!Detail::readCachedValue<T>(stream, extremePoint(i)))
+        {
+          return ret;
+        }
+      }
+
+      result.second =
+        LinearProgramSolution<T>(std::move(extremePoint), extremeValue);
+    }
+
+    ret = std::move(result);
+
+    return ret;
+  }
+
+
+  template<typename T>
+  /**
+   * @brief SolutionCache<T>::writeFile
+   * Writes the temporary file and renames it, so that the readers
+   * (of this or the other processes) never see the partial file.
+   * The failures are ignored, the solution is only not persisted then.
+   * @param key
+   * @param result
+   */
+  void
+  SolutionCache<T>::writeFile(const Key& key, const Result& result) const
+  {
+    const string name(fileName(key));
+    const string temporaryName(
+      fmt::format("{}.{:016x}.tmp", name, uint64_t(std::random_device()()))
+    );
+
+    {
+      ofstream stream(temporaryName, std::ios::binary | std::ios::trunc);
+      if (!stream)
+      {
+        return;
+      }
+
+      Detail::writeCachedWord(
+        stream,
+        uint64_t(SolutionCacheFormatVersion) << 32 | Detail::SolutionCacheMagic
+      );
+      Detail::writeCachedWord(stream, uint64_t(Detail::cachedField<T>()));
+      Detail::writeCachedWord(stream, key.high);
+      Detail::writeCachedWord(stream, key.low);
+      Detail::writeCachedWord(stream, uint64_t(result.first));
+
+      if (result.second)
+      {
+        const auto& extremePoint(result.second->extremePoint);
+
+        Detail::writeCachedWord(stream, uint64_t(extremePoint.rows()));
+        Detail::writeCachedValue<T>(stream, result.second->extremeValue);
+        for (DenseIndex i(0); i < extremePoint.rows(); ++i)
+        {
+          Detail::writeCachedValue<T>(stream, extremePoint(i));
+        }
+      }
+      else
+      {
+        Detail::writeCachedWord(stream, ~uint64_t(0));
+      }
+
+      if (!stream.flush())
+      {
+        stream.close();
+        std::remove(temporaryName.c_str());
+
+        return;
+      }
+    }
+
+    if (std::rename(temporaryName.c_str(), name.c_str()) != 0)
+    {
+      std::remove(temporaryName.c_str());
+    }
+  }
+
+
+#ifndef LP_WITH_MULTIPRECISION
+  //NOTE: Both fields are instantiated once, in `solutioncache.cxx'
+  extern template class SolutionCache<NumericTypes::real_t>;
+  extern template class SolutionCache<NumericTypes::rational_t>;
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+#endif // SOLUTIONCACHE_TXX
@@ -0,0 +1,22 @@
+﻿#pragma once
+
+#ifndef SOLVERTYPE_HXX
+#define SOLVERTYPE_HXX
+
+
+namespace LinearProgramming
+{
+  /**
+   * @brief The SolverType enum
+   * NOTE: The values are the part of the cached solutions' keys,
+   * do not renumber them.
+   */
+  enum struct SolverType : int
+  {
+    Simplex = 1,
+    Graphical2D = 2
+  };
+}
+
+
+#endif // SOLVERTYPE_HXX
@@ -1,4 +1,5 @@
 ﻿#ifdef LP_TEST_MODE
+#include "test/iotest.hxx"
 #include "test/test.hxx"
 #else // LP_TEST_MODE
 #include <clocale>
@@ -27,6 +28,19 @@ main(int argc, char** argv)
 //  Test::testSolvers();
 //  Test::testUtilities();
   Test::testRREF();
+  Test::testAllocations();
+  Test::testSolutionCache();
+  Test::testBasisCache();
+  Test::testBoundedSimplexSolver();
+  Test::testParametricSolver();
+  Test::testMultiRHSSolver();
+  Test::testIncrementalEdits();
+  Test::testColumnGenerator();
+  Test::testMpsWriter();
+  Test::testLpReader();
+  Test::testBinaryProgram();
+  Test::testJsonReader();
+  Test::testCompressedFiles();
 #else // LP_TEST_MODE
   using namespace Config::App;
 
@@ -184,6 +184,28 @@ namespace MathUtils
 
     return false;
   }
+
+
+  template<typename R, typename T>
+  /**
+   * @brief numericCast
+   * Converts between the numeric types (e.g. to plot the rational
+   * solution), see `DataConvertors' for the conversions to/from
+   * the strings.
+   * @param from
+   * @return
+   */
+  R
+  numericCast(const T& from)
+  {
+    static_assert(
+      AlwaysFalse<R, T>::value,
+      "MathUtils::numericCast<R, T>: "
+      "You can only use one of the specified template specializations!"
+    );
+
+    return R(0);
+  }
 }
 
 
@@ -8,21 +8,18 @@
 
 #include <cmath>
 
-#include <QDebug>
-
 #include <algorithm>
 #include <type_traits>
 #include <utility>
 
 #include "mathutils.hxx"
 #include "../misc/boostextensions.hxx"
-#include "../misc/boostqtinterop.hxx"
+#include "../misc/logsink.hxx"
 #include "numerictypes.hxx"
 
 
 namespace MathUtils
 {
-  using namespace BoostQtInterop;
 #ifdef LP_WITH_MULTIPRECISION
   namespace mp = NumericTypes::mp;
 #endif // LP_WITH_MULTIPRECISION
@@ -36,6 +33,8 @@ namespace MathUtils
   using std::max;
   using std::pair;
   using std::trunc;
+  using Utils::LogLevel;
+  using Utils::writeLog;
 
 
 #ifdef LP_WITH_MULTIPRECISION
@@ -137,8 +136,10 @@ namespace MathUtils
     //Check for overflow (assuming that values range of `T' is larger than `R')
     if (r1_integerPart > T(NumericLimits::max<R>()))
     {
-      qWarning() << "MathUtils::rationalize<R, T>:"
-                    " overflow at the upper bound of `R'";
+      writeLog(
+        LogLevel::Warning,
+        "MathUtils::rationalize<R, T>: overflow at the upper bound of `R'"
+      );
 
       return make_pair(NumericLimits::max<R>(), R(1));
     }
@@ -146,8 +147,10 @@ namespace MathUtils
     {
       if (r1_integerPart < T(NumericLimits::min<R>()))
       {
-        qWarning() << "MathUtils::rationalize<R, T>:"
-                      " overflow at the lower bound of `R'";
+        writeLog(
+          LogLevel::Warning,
+          "MathUtils::rationalize<R, T>: overflow at the lower bound of `R'"
+        );
 
         return make_pair(NumericLimits::min<R>(), R(1));
       }
@@ -594,6 +597,80 @@ namespace MathUtils
   {
     return (x >= rational_t(0));
   }
+
+
+  template<>
+  inline real_t
+  numericCast<real_t, real_t>(const real_t& from)
+  {
+    return from;
+  }
+
+
+  template<>
+  inline rational_t
+  numericCast<rational_t, rational_t>(const rational_t& from)
+  {
+    return from;
+  }
+
+
+  using NumericTypes::boost_rational_t;
+
+
+#ifdef LP_WITH_MULTIPRECISION
+  template<>
+  inline boost_real_t
+  numericCast<boost_real_t, boost_rational_t>(const boost_rational_t& from)
+  {
+    const boost_real_t value(
+      boost_real_t(numerator(from)) / boost_real_t(denominator(from))
+    );
+
+    return value;
+  }
+
+
+  template<>
+  inline boost_rational_t
+  numericCast<boost_rational_t, boost_real_t>(const boost_real_t& from)
+  {
+    const pair<boost_integer_t, boost_integer_t> rationalized(
+      rationalize<boost_integer_t, boost_real_t>(
+        from, Epsilon,
+        MaxRationalizeDenominator, MaxRationalizeIterations
+      )
+    );
+
+    return boost_rational_t(rationalized.first, rationalized.second);
+  }
+#else // LP_WITH_MULTIPRECISION
+  template<>
+  inline builtin_real_t
+  numericCast<builtin_real_t, boost_rational_t>(const boost_rational_t& from)
+  {
+    const builtin_real_t value(
+      builtin_real_t(from.numerator()) / builtin_real_t(from.denominator())
+    );
+
+    return value;
+  }
+
+
+  template<>
+  inline boost_rational_t
+  numericCast<boost_rational_t, builtin_real_t>(const builtin_real_t& from)
+  {
+    const pair<builtin_integer_t, builtin_integer_t> rationalized =
+      rationalize<builtin_integer_t, builtin_real_t>(
+        from, Epsilon,
+        MaxRationalizeDenominator,
+        MaxRationalizeIterations
+      );
+
+    return boost_rational_t(rationalized.first, rationalized.second);
+  }
+#endif // LP_WITH_MULTIPRECISION
 }
 
 
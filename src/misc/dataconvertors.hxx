@@ -7,11 +7,13 @@
 #include <QString>
 
 #include "utils.hxx"
+#include "../math/mathutils.hxx"
 
 
 //TODO: [0;1] Merge w/ `NumericTypes'.
 namespace DataConvertors
 {
+  using MathUtils::numericCast;
   using Utils::AlwaysFalse;
 
 
@@ -27,19 +29,6 @@ namespace DataConvertors
 
     return R(0);
   }
-
-
-  template<typename R, typename T>
-  R numericCast(const T& from)
-  {
-    static_assert(
-      AlwaysFalse<R, T>::value,
-      "DataConvertors::numericCast<R, T>: "
-      "You can only use one of the specified template specializations!"
-    );
-
-    return R(0);
-  }
 }
 
 
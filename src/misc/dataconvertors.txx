@@ -31,72 +31,64 @@
 #include "../config.hxx"
 
 
-namespace DataConvertors
+//NOTE: The numeric conversions live in `MathUtils' (so do the solvers),
+//the string ones below are its specializations
+namespace MathUtils
 {
-  using namespace Config::MathUtils;
-  using Config::App::Locale;
-  using fmt::format;
-  using MathUtils::rationalize;
-  using NumericTypes::rational_t;
-  using NumericTypes::real_t;
-  using std::pair;
-
-
-  template<>
-  inline real_t
-  numericCast<real_t, real_t>(const real_t& from)
-  {
-    return from;
-  }
-
-
-  template<>
-  inline rational_t
-  numericCast<rational_t, rational_t>(const rational_t& from)
-  {
-    return from;
-  }
-
-
 #ifdef LP_WITH_MULTIPRECISION
   using NumericTypes::boost_real_t;
   using NumericTypes::boost_integer_t;
   using NumericTypes::boost_rational_t;
-  using std::runtime_error;
 
 
   template<>
-  inline boost_real_t
-  numericCast<boost_real_t, boost_rational_t>(const boost_rational_t& from)
+  inline QString
+  numericCast<QString, boost_real_t>(const boost_real_t& from)
   {
-    const boost_real_t value(
-      boost_real_t(numerator(from)) / boost_real_t(denominator(from))
-    );
+    const QString value(QString::fromStdString(fmt::format("{}", from)));
 
     return value;
   }
 
 
   template<>
-  inline boost_rational_t
-  numericCast<boost_rational_t, boost_real_t>(const boost_real_t& from)
+  inline QString
+  numericCast<QString, boost_rational_t>(const boost_rational_t& from)
   {
-    const pair<boost_integer_t, boost_integer_t> rationalized(
-      rationalize<boost_integer_t, boost_real_t>(
-        from, Epsilon,
-        MaxRationalizeDenominator, MaxRationalizeIterations
-      )
-    );
-
-    return boost_rational_t(rationalized.first, rationalized.second);
+    QString value; //TODO: [0;0] Remove assignment, just construct-and-return.
+
+    if (denominator(from) == boost_integer_t(1))
+    {
+      value = QString::fromStdString(fmt::format("{}", numerator(from)));
+    }
+    else
+    {
+      if (numerator(from) == boost_integer_t(0))
+      {
+        value = QStringLiteral("0");
+      }
+      else
+      {
+        value =
+          QString::fromStdString(
+            fmt::format("{}/{}", numerator(from), denominator(from))
+          );
+      }
+    }
+
+    return value;
   }
+#else // LP_WITH_MULTIPRECISION
+  using NumericTypes::builtin_real_t;
+  using NumericTypes::builtin_integer_t;
+  using NumericTypes::boost_rational_t;
 
 
   template<>
   inline QString
-  numericCast<QString, boost_real_t>(const boost_real_t& from)
+  numericCast<QString, builtin_real_t>(const builtin_real_t& from)
   {
-    const QString value(QString::fromStdString(format("{}", from)));
+    const QString value(QString::fromStdString(fmt::format("{}", from)));
 
     return value;
   }
@@ -108,13 +100,13 @@ namespace DataConvertors
   {
     QString value; //TODO: [0;0] Remove assignment, just construct-and-return.
 
-    if (denominator(from) == boost_integer_t(1))
+    if (from.denominator() == builtin_integer_t(1))
     {
-      value = QString::fromStdString(format("{}", numerator(from)));
+      value = QString::fromStdString(fmt::format("{}", from.numerator()));
     }
     else
     {
-      if (numerator(from) == boost_integer_t(0))
+      if (from.numerator() == builtin_integer_t(0))
       {
         value = QStringLiteral("0");
       }
@@ -122,13 +114,31 @@ namespace DataConvertors
       {
         value =
           QString::fromStdString(
-            format("{}/{}", numerator(from), denominator(from))
+            fmt::format("{}/{}", from.numerator(), from.denominator())
           );
       }
     }
 
     return value;
   }
+#endif // LP_WITH_MULTIPRECISION
+}
+
+
+namespace DataConvertors
+{
+  using Config::App::Locale;
+  using fmt::format;
+  using NumericTypes::rational_t;
+  using NumericTypes::real_t;
+  using std::pair;
+
+
+#ifdef LP_WITH_MULTIPRECISION
+  using NumericTypes::boost_real_t;
+  using NumericTypes::boost_integer_t;
+  using NumericTypes::boost_rational_t;
+  using std::runtime_error;
 
 
   template<>
@@ -186,72 +196,6 @@ namespace DataConvertors
   using NumericTypes::boost_rational_t;
 
 
-  template<>
-  inline builtin_real_t
-  numericCast<builtin_real_t, boost_rational_t>(const boost_rational_t& from)
-  {
-    const builtin_real_t value(
-      builtin_real_t(from.numerator()) / builtin_real_t(from.denominator())
-    );
-
-    return value;
-  }
-
-
-  template<>
-  inline boost_rational_t
-  numericCast<boost_rational_t, builtin_real_t>(const builtin_real_t& from)
-  {
-    const pair<builtin_integer_t, builtin_integer_t> rationalized =
-      rationalize<builtin_integer_t, builtin_real_t>(
-        from, Epsilon,
-        MaxRationalizeDenominator,
-        MaxRationalizeIterations
-      );
-
-    return boost_rational_t(rationalized.first, rationalized.second);
-  }
-
-
-  template<>
-  inline QString
-  numericCast<QString, builtin_real_t>(const builtin_real_t& from)
-  {
-    const QString value(QString::fromStdString(format("{}", from)));
-
-    return value;
-  }
-
-
-  template<>
-  inline QString
-  numericCast<QString, boost_rational_t>(const boost_rational_t& from)
-  {
-    QString value; //TODO: [0;0] Remove assignment, just construct-and-return.
-
-    if (from.denominator() == builtin_integer_t(1))
-    {
-      value = QString::fromStdString(format("{}", from.numerator()));
-    }
-    else
-    {
-      if (from.numerator() == builtin_integer_t(0))
-      {
-        value = QStringLiteral("0");
-      }
-      else
-      {
-        value =
-          QString::fromStdString(
-            format("{}/{}", from.numerator(), from.denominator())
-          );
-      }
-    }
-
-    return value;
-  }
-
-
   template<>
   inline builtin_real_t
   numericCast<builtin_real_t>(const QString& from)
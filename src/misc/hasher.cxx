@@ -0,0 +1,127 @@
+﻿#include "hasher.hxx"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+
+#include "fmt/format.h"
+
+
+namespace Utils
+{
+  using std::size_t;
+  using std::string;
+
+
+  namespace
+  {
+    constexpr uint64_t C1 = 0x87c37b91114253d5ULL;
+    constexpr uint64_t C2 = 0x4cf5ad432745937fULL;
+
+
+    inline uint64_t
+    rotl(uint64_t x, int r)
+    {
+      return ((x << r) | (x >> (64 - r)));
+    }
+
+
+    inline uint64_t
+    fmix(uint64_t k)
+    {
+      k ^= k >> 33;
+      k *= 0xff51afd7ed558ccdULL;
+      k ^= k >> 33;
+      k *= 0xc4ceb9fe1a85ec53ULL;
+      k ^= k >> 33;
+
+      return k;
+    }
+  }
+
+
+  bool
+  Digest::operator ==(const Digest& other) const
+  {
+    return (high == other.high && low == other.low);
+  }
+
+
+  bool
+  Digest::operator !=(const Digest& other) const
+  {
+    return !(*this == other);
+  }
+
+
+  /**
+   * @brief Digest::toString
+   * @return 32 lowercase hex digits.
+   */
+  string
+  Digest::toString() const
+  {
+    return fmt::format("{:016x}{:016x}", high, low);
+  }
+
+
+  size_t
+  DigestHash::operator ()(const Digest& digest) const
+  {
+    //NOTE: The digest bits are uniform already
+    return size_t(digest.low ^ digest.high);
+  }
+
+
+  Hasher::Hasher(uint64_t seed) :
+    high_(seed),
+    low_(seed)
+  { }
+
+
+  /**
+   * @brief Hasher::add
+   * Mixes `word' into both lanes.
+   * @param word
+   * @return
+   */
+  Hasher&
+  Hasher::add(uint64_t word)
+  {
+    high_ ^= rotl(word * C1, 31) * C2;
+    high_ = rotl(high_, 27) + low_;
+    high_ = high_ * 5 + 0x52dce729;
+
+    low_ ^= rotl(word * C2, 33) * C1;
+    low_ = rotl(low_, 31) + high_;
+    low_ = low_ * 5 + 0x38495ab5;
+
+    ++length_;
+
+    return *this;
+  }
+
+
+  Digest
+  Hasher::digest() const
+  {
+    uint64_t high(high_ ^ length_);
+    uint64_t low(low_ ^ length_);
+
+    high += low;
+    low += high;
+
+    high = fmix(high);
+    low = fmix(low);
+
+    high += low;
+    low += high;
+
+    Digest ret;
+    ret.high = high;
+    ret.low = low;
+
+    return ret;
+  }
+}
@@ -0,0 +1,74 @@
+﻿#pragma once
+
+#ifndef HASHER_HXX
+#define HASHER_HXX
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+
+
+namespace Utils
+{
+  using std::size_t;
+  using std::string;
+
+
+  /**
+   * @brief The Digest struct
+   * 128-bit hash value.
+   */
+  struct Digest
+  {
+    uint64_t high = 0;
+
+    uint64_t low = 0;
+
+
+    bool operator ==(const Digest& other) const;
+    bool operator !=(const Digest& other) const;
+
+    string toString() const;
+  };
+
+
+  /**
+   * @brief The DigestHash struct
+   * Lets `Digest' be the key of the unordered containers.
+   */
+  struct DigestHash
+  {
+    size_t operator ()(const Digest& digest) const;
+  };
+
+
+  /**
+   * @brief The Hasher class
+   * Streaming 128-bit hash of the sequence of 64-bit words (two
+   * MurmurHash3-like lanes w/ the 64-bit finalizer). It is not
+   * a cryptographic hash, but it only depends on the words given,
+   * so the digests are the same across the runs and the processes.
+   */
+  class Hasher
+  {
+    public:
+      explicit Hasher(uint64_t seed = 0);
+
+      Hasher& add(uint64_t word);
+
+      Digest digest() const;
+
+
+    private:
+      uint64_t high_;
+
+      uint64_t low_;
+
+      uint64_t length_ = 0;
+  };
+}
+
+
+#endif // HASHER_HXX
@@ -0,0 +1,83 @@
+﻿#include "logsink.hxx"
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+
+namespace Utils
+{
+  using std::string;
+
+
+  namespace
+  {
+    /**
+     * @brief writeToStandardError
+     * The default log sink.
+     * @param level
+     * @param message
+     */
+    void
+    writeToStandardError(LogLevel level, const string& message)
+    {
+      switch (level)
+      {
+        case LogLevel::Warning:
+          std::cerr << "Warning: ";
+          break;
+
+        case LogLevel::Critical:
+          std::cerr << "Critical: ";
+          break;
+
+        default:
+          break;
+      }
+
+      std::cerr << message << std::endl;
+    }
+
+
+    LogSink& currentLogSink()
+    {
+      static LogSink sink(writeToStandardError);
+
+      return sink;
+    }
+  }
+
+
+  /**
+   * @brief setLogSink
+   * Replaces the log sink. This is meant to be done once,
+   * before any solver runs: `writeLog' doesn't synchronize
+   * with it.
+   * @param sink The new sink, empty one drops all messages.
+   * @return The previous sink.
+   */
+  LogSink
+  setLogSink(LogSink sink)
+  {
+    std::swap(currentLogSink(), sink);
+
+    return sink;
+  }
+
+
+  /**
+   * @brief writeLog
+   * Passes `message' to the current log sink.
+   * @param level
+   * @param message
+   */
+  void
+  writeLog(LogLevel level, const string& message)
+  {
+    const LogSink& sink(currentLogSink());
+    if (sink)
+    {
+      sink(level, message);
+    }
+  }
+}
@@ -0,0 +1,42 @@
+﻿#pragma once
+
+#ifndef LOGSINK_HXX
+#define LOGSINK_HXX
+
+
+#include <functional>
+#include <string>
+
+
+namespace Utils
+{
+  using std::function;
+  using std::string;
+
+
+  /**
+   * @brief The LogLevel enum
+   */
+  enum struct LogLevel : int
+  {
+    Debug = 0,
+    Warning = 1,
+    Critical = 2
+  };
+
+
+  /**
+   * @brief LogSink
+   * Receives the log messages of the solvers. The default one writes
+   * them to `std::cerr', the empty one drops them.
+   */
+  using LogSink = function<void(LogLevel, const string&)>;
+
+
+  LogSink setLogSink(LogSink sink);
+
+  void writeLog(LogLevel level, const string& message);
+}
+
+
+#endif // LOGSINK_HXX
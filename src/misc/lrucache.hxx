@@ -0,0 +1,70 @@
+﻿#pragma once
+
+#ifndef LRUCACHE_HXX
+#define LRUCACHE_HXX
+
+
+#include <cstddef>
+
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+
+namespace Utils
+{
+  using std::list;
+  using std::pair;
+  using std::size_t;
+  using std::unordered_map;
+
+
+  template<typename TKey, typename TValue, typename THash = std::hash<TKey>>
+  /**
+   * @brief The LruCache class
+   * Keeps up to `capacity' values, the least recently used one is dropped
+   * to make room for the new one. Not thread-safe.
+   */
+  class LruCache
+  {
+    public:
+      explicit LruCache(size_t capacity);
+
+      LruCache(const LruCache&) = delete;
+
+      LruCache& operator =(const LruCache&) = delete;
+
+      size_t capacity() const;
+
+      size_t size() const;
+
+      const TValue* find(const TKey& key);
+
+      void insert(const TKey& key, const TValue& value);
+      void insert(const TKey& key, TValue&& value);
+
+      void clear();
+
+
+    private:
+      using Entry = pair<TKey, TValue>;
+
+
+      size_t capacity_;
+
+      //Most recently used first
+      list<Entry> entries_;
+
+      unordered_map<TKey, typename list<Entry>::iterator, THash> index_;
+
+
+      void evict();
+  };
+}
+
+
+#include "lrucache.txx"
+
+
+#endif // LRUCACHE_HXX
@@ -0,0 +1,135 @@
+﻿#pragma once
+
+#ifndef LRUCACHE_TXX
+#define LRUCACHE_TXX
+
+
+#include "lrucache.hxx"
+
+#include <cstddef>
+
+#include <utility>
+
+
+namespace Utils
+{
+  using std::size_t;
+
+
+  template<typename TKey, typename TValue, typename THash>
+  /**
+   * @brief LruCache<TKey, TValue, THash>::LruCache
+   * @param capacity Values count, `0' disables the cache.
+   */
+  LruCache<TKey, TValue, THash>::LruCache(size_t capacity) :
+    capacity_(capacity)
+  {
+    index_.reserve(capacity_);
+  }
+
+
+  template<typename TKey, typename TValue, typename THash>
+  size_t
+  LruCache<TKey, TValue, THash>::capacity() const
+  {
+    return capacity_;
+  }
+
+
+  template<typename TKey, typename TValue, typename THash>
+  size_t
+  LruCache<TKey, TValue, THash>::size() const
+  {
+    return entries_.size();
+  }
+
+
+  template<typename TKey, typename TValue, typename THash>
+  /**
+   * @brief LruCache<TKey, TValue, THash>::find
+   * Marks the value of `key' (if any) as the most recently used one.
+   * @param key
+   * @return The value, it is valid until the next `insert' or `clear',
+   * `nullptr' if there is none.
+   */
+  const TValue*
+  LruCache<TKey, TValue, THash>::find(const TKey& key)
+  {
+    const auto it(index_.find(key));
+    if (it == index_.end())
+    {
+      return nullptr;
+    }
+
+    entries_.splice(entries_.begin(), entries_, it->second);
+
+    return &it->second->second;
+  }
+
+
+  template<typename TKey, typename TValue, typename THash>
+  /**
+   * @brief LruCache<TKey, TValue, THash>::insert
+   * Inserts or replaces the value of `key'.
+   * @param key
+   * @param value
+   */
+  void
+  LruCache<TKey, TValue, THash>::insert(const TKey& key, const TValue& value)
+  {
+    insert(key, TValue(value));
+  }
+
+
+  template<typename TKey, typename TValue, typename THash>
+  void
+  LruCache<TKey, TValue, THash>::insert(const TKey& key, TValue&& value)
+  {
+    if (capacity_ == 0)
+    {
+      return;
+    }
+
+    const auto it(index_.find(key));
+    if (it != index_.end())
+    {
+      it->second->second = std::move(value);
+      entries_.splice(entries_.begin(), entries_, it->second);
+
+      return;
+    }
+
+    evict();
+
+    entries_.emplace_front(key, std::move(value));
+    index_.emplace(key, entries_.begin());
+  }
+
+
+  template<typename TKey, typename TValue, typename THash>
+  void
+  LruCache<TKey, TValue, THash>::clear()
+  {
+    index_.clear();
+    entries_.clear();
+  }
+
+
+  template<typename TKey, typename TValue, typename THash>
+  /**
+   * @brief LruCache<TKey, TValue, THash>::evict
+   * Drops the least recently used values until there is room for one more.
+   */
+  void
+  LruCache<TKey, TValue, THash>::evict()
+  {
+    while (entries_.size() >= capacity_)
+    {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+  }
+}
+
+
+#endif // LRUCACHE_TXX
@@ -0,0 +1,558 @@
+﻿#include "processpool.hxx"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif // __linux__
+
+#include "../config.hxx"
+
+
+namespace Utils
+{
+  using boost::none;
+  using std::make_pair;
+  using std::runtime_error;
+  using std::size_t;
+  using std::string;
+  using std::thread;
+  using std::vector;
+  using namespace std::chrono;
+
+
+  namespace
+  {
+    /**
+     * @brief The ReplyHeader struct
+     * Leads the output of the task sent by the worker.
+     */
+    struct ReplyHeader
+    {
+      uint64_t status;
+      uint64_t size;
+    };
+
+
+    bool
+    readAll(int socket, void* data, size_t size)
+    {
+      char* first(static_cast<char*>(data));
+
+      while (size > 0)
+      {
+        const ssize_t count(::read(socket, first, size));
+        if (count < 0 && errno == EINTR)
+        {
+          continue;
+        }
+
+        if (count <= 0)
+        {
+          return false;
+        }
+
+        first += count;
+        size -= size_t(count);
+      }
+
+      return true;
+    }
+
+
+    bool
+    writeAll(int socket, const void* data, size_t size)
+    {
+      const char* first(static_cast<const char*>(data));
+
+      while (size > 0)
+      {
+        //NOTE: The peer may be dead already, no SIGPIPE is wanted then
+        const ssize_t count(::send(socket, first, size, MSG_NOSIGNAL));
+        if (count < 0 && errno == EINTR)
+        {
+          continue;
+        }
+
+        if (count <= 0)
+        {
+          return false;
+        }
+
+        first += count;
+        size -= size_t(count);
+      }
+
+      return true;
+    }
+
+
+    string
+    describeExitStatus(int exitStatus)
+    {
+      if (WIFSIGNALED(exitStatus))
+      {
+        return
+          "Worker process was killed by signal " +
+          std::to_string(WTERMSIG(exitStatus)) +
+          " (" + ::strsignal(WTERMSIG(exitStatus)) + ")";
+      }
+
+      if (WIFEXITED(exitStatus))
+      {
+        return
+          "Worker process exited w/ code " +
+          std::to_string(WEXITSTATUS(exitStatus));
+      }
+
+      return "Worker process was lost";
+    }
+  }
+
+
+  /**
+   * @brief ProcessPool::ProcessPool
+   * @param processesCount Workers count, `0' stands for the number
+   * of the hardware threads.
+   * @param timeout Time limit of the single task, `0' for none.
+   */
+  ProcessPool::ProcessPool(size_t processesCount, seconds timeout) :
+    processesCount_(
+      processesCount > 0 ?
+      processesCount :
+      std::max<size_t>(thread::hardware_concurrency(), 1)
+    ),
+    timeout_(timeout)
+  { }
+
+
+  size_t
+  ProcessPool::processesCount() const
+  {
+    return processesCount_;
+  }
+
+
+  /**
+   * @brief ProcessPool::run
+   * Calls `task' in the worker processes for every index
+   * in [0; tasksCount) and `handler' in the calling process
+   * for each of the results, as soon as all the preceding ones
+   * are handled. The workers are stopped before it returns.
+   * NOTE: Nothing but `task' runs in the workers, and they leave w/o
+   * flushing the inherited buffers or calling the `atexit' handlers.
+   * @param tasksCount
+   * @param task
+   * @param handler
+   */
+  void
+  ProcessPool::run(
+    size_t tasksCount, const Task& task, const Handler& handler
+  ) throw(runtime_error)
+  {
+    if (tasksCount == 0)
+    {
+      return;
+    }
+
+    task_ = &task;
+    handler_ = &handler;
+
+    workers_.assign(std::min(processesCount_, tasksCount), Worker());
+    pendingTasks_.clear();
+    for (size_t taskIdx(0); taskIdx < tasksCount; ++taskIdx)
+    {
+      pendingTasks_.push_back(taskIdx);
+    }
+    attemptsCounts_.assign(tasksCount, 0);
+    results_.assign(tasksCount, none);
+    nextResultIdx_ = 0;
+
+    try
+    {
+      vector<pollfd> fds;
+      vector<size_t> fdsWorkers;
+
+      while (nextResultIdx_ < tasksCount)
+      {
+        //Hand out the pending tasks to the idle workers
+        for (Worker& worker : workers_)
+        {
+          if (!worker.taskIdx && !pendingTasks_.empty())
+          {
+            dispatch(worker);
+          }
+        }
+
+        //Wait for the replies of the busy ones
+        fds.clear();
+        fdsWorkers.clear();
+        int timeout(-1);
+        const Clock::time_point now(Clock::now());
+
+        for (size_t workerIdx(0); workerIdx < workers_.size(); ++workerIdx)
+        {
+          const Worker& worker(workers_[workerIdx]);
+          if (!worker.taskIdx)
+          {
+            continue;
+          }
+
+          fds.push_back(pollfd{worker.socket, POLLIN, 0});
+          fdsWorkers.push_back(workerIdx);
+
+          if (timeout_ > seconds::zero())
+          {
+            const int timeLeft(
+              int(
+                std::max<milliseconds::rep>(
+                  duration_cast<milliseconds>(worker.deadline - now).count(),
+                  0
+                )
+              )
+            );
+
+            timeout = (timeout < 0 ? timeLeft : std::min(timeout, timeLeft));
+          }
+        }
+
+        if (::poll(fds.data(), fds.size(), timeout) < 0)
+        {
+          if (errno == EINTR)
+          {
+            continue;
+          }
+
+          throw runtime_error("Couldn't wait for the worker processes");
+        }
+
+        for (size_t fdIdx(0); fdIdx < fds.size(); ++fdIdx)
+        {
+          if (fds[fdIdx].revents != 0)
+          {
+            receive(workers_[fdsWorkers[fdIdx]]);
+          }
+        }
+
+        //Kill the workers that are out of time
+        if (timeout_ > seconds::zero())
+        {
+          for (Worker& worker : workers_)
+          {
+            if (worker.taskIdx && worker.deadline <= Clock::now())
+            {
+              stop(worker, true);
+              abort(
+                worker, TaskStatus::TimedOut,
+                "Timed out after " + std::to_string(timeout_.count()) + " s"
+              );
+            }
+          }
+        }
+      }
+    }
+    catch (...)
+    {
+      for (Worker& worker : workers_)
+      {
+        if (worker.pid >= 0)
+        {
+          stop(worker, true);
+        }
+      }
+
+      throw;
+    }
+
+    //NOTE: The workers leave as soon as their sockets are closed
+    for (Worker& worker : workers_)
+    {
+      if (worker.pid >= 0)
+      {
+        stop(worker, false);
+      }
+    }
+  }
+
+
+  /**
+   * @brief ProcessPool::spawn
+   * Forks the new worker process.
+   * @param worker
+   */
+  void
+  ProcessPool::spawn(Worker& worker) throw(runtime_error)
+  {
+    int sockets[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0)
+    {
+      throw runtime_error("Couldn't create the worker process socket");
+    }
+
+    //NOTE: Nothing buffered may be inherited by the worker
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+
+    const pid_t pid(::fork());
+    if (pid < 0)
+    {
+      ::close(sockets[0]);
+      ::close(sockets[1]);
+
+      throw runtime_error("Couldn't fork the worker process");
+    }
+
+    if (pid == 0)
+    {
+#ifdef __linux__
+      //NOTE: Workers must not outlive the coordinator
+      ::prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif // __linux__
+
+      //NOTE: The other workers must see EOF when their sockets are closed
+      ::close(sockets[0]);
+      for (const Worker& other : workers_)
+      {
+        if (other.socket >= 0)
+        {
+          ::close(other.socket);
+        }
+      }
+
+      serve(sockets[1]);
+    }
+
+    ::close(sockets[1]);
+
+    worker.pid = pid;
+    worker.socket = sockets[0];
+  }
+
+
+  /**
+   * @brief ProcessPool::dispatch
+   * Gives the next pending task to the idle worker, starting the worker
+   * if it is not running.
+   * @param worker
+   */
+  void
+  ProcessPool::dispatch(Worker& worker) throw(runtime_error)
+  {
+    if (worker.pid < 0)
+    {
+      spawn(worker);
+    }
+
+    const size_t taskIdx(pendingTasks_.front());
+    const uint64_t message(taskIdx);
+
+    if (!writeAll(worker.socket, &message, sizeof(message)))
+    {
+      //The idle worker is gone, the task has not been started yet
+      stop(worker, true);
+      spawn(worker);
+
+      if (!writeAll(worker.socket, &message, sizeof(message)))
+      {
+        throw runtime_error("Couldn't hand the task to the worker process");
+      }
+    }
+
+    pendingTasks_.pop_front();
+    ++attemptsCounts_[taskIdx];
+
+    worker.taskIdx = taskIdx;
+    worker.deadline = Clock::now() + timeout_;
+    worker.reply.clear();
+  }
+
+
+  /**
+   * @brief ProcessPool::receive
+   * Reads the available part of the reply of the busy worker.
+   * @param worker
+   */
+  void
+  ProcessPool::receive(Worker& worker)
+  {
+    char buffer[1 << 16];
+
+    const ssize_t count(::read(worker.socket, buffer, sizeof(buffer)));
+    if (count < 0 && errno == EINTR)
+    {
+      return;
+    }
+
+    if (count <= 0)
+    {
+      int exitStatus(0);
+      stop(worker, false, &exitStatus);
+      abort(worker, TaskStatus::Crashed, describeExitStatus(exitStatus));
+
+      return;
+    }
+
+    worker.reply.append(buffer, size_t(count));
+
+    if (worker.reply.size() < sizeof(ReplyHeader))
+    {
+      return;
+    }
+
+    ReplyHeader header;
+    std::memcpy(&header, worker.reply.data(), sizeof(header));
+
+    if (worker.reply.size() - sizeof(header) < header.size)
+    {
+      return;
+    }
+
+    const size_t taskIdx(*worker.taskIdx);
+    worker.taskIdx = none;
+
+    finish(
+      taskIdx, TaskStatus(header.status),
+      worker.reply.substr(sizeof(header), header.size)
+    );
+  }
+
+
+  /**
+   * @brief ProcessPool::abort
+   * Gives the task of the stopped worker to the other one or reports
+   * it, if it is out of attempts.
+   * @param worker
+   * @param status
+   * @param reason
+   */
+  void
+  ProcessPool::abort(Worker& worker, TaskStatus status, const string& reason)
+  {
+    const size_t taskIdx(*worker.taskIdx);
+    worker.taskIdx = none;
+
+    if (attemptsCounts_[taskIdx] < Config::Utils::MaxTaskAttempts)
+    {
+      pendingTasks_.push_front(taskIdx);
+    }
+    else
+    {
+      finish(taskIdx, status, string(reason));
+    }
+  }
+
+
+  /**
+   * @brief ProcessPool::stop
+   * Closes the socket of the worker and waits for it to leave.
+   * @param worker
+   * @param isKilled Kill the worker instead of waiting.
+   * @param exitStatus (optional) Exit status of the worker.
+   */
+  void
+  ProcessPool::stop(Worker& worker, bool isKilled, int* exitStatus)
+  {
+    if (isKilled)
+    {
+      ::kill(worker.pid, SIGKILL);
+    }
+
+    ::close(worker.socket);
+
+    int status(0);
+    while (::waitpid(worker.pid, &status, 0) < 0 && errno == EINTR)
+    { }
+
+    if (exitStatus != nullptr)
+    {
+      *exitStatus = status;
+    }
+
+    worker.pid = -1;
+    worker.socket = -1;
+  }
+
+
+  /**
+   * @brief ProcessPool::finish
+   * Stores the result of the task and handles all the results
+   * that are in order.
+   * @param taskIdx
+   * @param status
+   * @param data
+   */
+  void
+  ProcessPool::finish(size_t taskIdx, TaskStatus status, string&& data)
+  {
+    results_[taskIdx] = make_pair(status, std::move(data));
+
+    while (nextResultIdx_ < results_.size() && results_[nextResultIdx_])
+    {
+      const pair<TaskStatus, string>& result(*results_[nextResultIdx_]);
+      (*handler_)(nextResultIdx_, result.first, result.second);
+
+      results_[nextResultIdx_] = none;
+      ++nextResultIdx_;
+    }
+  }
+
+
+  /**
+   * @brief ProcessPool::serve
+   * Main loop of the worker process: runs the tasks until the socket
+   * is closed by the coordinator.
+   * NOTE: The exception thrown by the task must not be caught by the
+   * callers of `spawn' in the worker, so it terminates the worker here.
+   * @param socket
+   */
+  void
+  ProcessPool::serve(int socket) const throw()
+  {
+    uint64_t message(0);
+
+    while (readAll(socket, &message, sizeof(message)))
+    {
+      string output;
+      const bool isDone((*task_)(size_t(message), output));
+
+      const ReplyHeader header{
+        uint64_t(isDone ? TaskStatus::Done : TaskStatus::Failed),
+        output.size()
+      };
+
+      if (
+        !writeAll(socket, &header, sizeof(header)) ||
+        !writeAll(socket, output.data(), output.size())
+      )
+      {
+        ::_exit(1);
+      }
+    }
+
+    ::_exit(0);
+  }
+}
+#endif // _WIN32
@@ -0,0 +1,156 @@
+﻿#pragma once
+
+#ifndef PROCESSPOOL_HXX
+#define PROCESSPOOL_HXX
+
+
+#include <cstddef>
+#include <cstdint>
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "boost/optional.hpp"
+
+
+//NOTE: Worker processes are forked, so the pool is POSIX-only
+#ifndef _WIN32
+#include <sys/types.h>
+
+
+namespace Utils
+{
+  using boost::optional;
+  using std::deque;
+  using std::function;
+  using std::pair;
+  using std::runtime_error;
+  using std::size_t;
+  using std::string;
+  using std::vector;
+
+
+  /**
+   * @brief The ProcessPool class
+   * Runs the batches of independent tasks in the forked worker
+   * processes, so that the task that crashes or hangs takes down its
+   * worker only. The workers are forked by `run' and inherit the whole
+   * state of the caller, so only the task indices and the outputs of
+   * the tasks are passed over the UNIX-domain sockets.
+   * The task whose worker has crashed or timed out is given to the new
+   * worker, up to `Config::Utils::MaxTaskAttempts' times in total.
+   */
+  class ProcessPool
+  {
+    public:
+      /**
+       * @brief The TaskStatus enum
+       */
+      enum struct TaskStatus : int
+      {
+        Done = 0,
+        Failed = 1,
+        Crashed = 2,
+        TimedOut = 3
+      };
+
+
+      /**
+       * @brief Task
+       * Called in the worker process w/ the task index, writes the output
+       * of the task to the string, returns `false' if the task has failed.
+       */
+      using Task = function<bool(size_t, string&)>;
+
+      /**
+       * @brief Handler
+       * Called in the calling process w/ the task index, the status and
+       * either the output of the task (`TaskStatus::Done' and
+       * `TaskStatus::Failed') or the description of what happened to its
+       * worker. The tasks are handled in the order of their indices.
+       */
+      using Handler = function<void(size_t, TaskStatus, const string&)>;
+
+
+      explicit ProcessPool(
+        size_t processesCount = 0,
+        std::chrono::seconds timeout = std::chrono::seconds::zero()
+      );
+
+      ProcessPool(const ProcessPool&) = delete;
+
+      ProcessPool& operator =(const ProcessPool&) = delete;
+
+      size_t processesCount() const;
+
+      void run(
+        size_t tasksCount, const Task& task, const Handler& handler
+      ) throw(runtime_error);
+
+
+    private:
+      using Clock = std::chrono::steady_clock;
+
+
+      /**
+       * @brief The Worker struct
+       * Worker process and the coordinator's end of its socket.
+       */
+      struct Worker
+      {
+        pid_t pid = -1;
+
+        int socket = -1;
+
+        optional<size_t> taskIdx;
+
+        Clock::time_point deadline;
+
+        string reply;
+      };
+
+
+      size_t processesCount_;
+
+      std::chrono::seconds timeout_;
+
+      //State of the current `run' call
+      const Task* task_ = nullptr;
+
+      const Handler* handler_ = nullptr;
+
+      vector<Worker> workers_;
+
+      deque<size_t> pendingTasks_;
+
+      vector<uint16_t> attemptsCounts_;
+
+      vector<optional<pair<TaskStatus, string>>> results_;
+
+      size_t nextResultIdx_ = 0;
+
+
+      void spawn(Worker& worker) throw(runtime_error);
+
+      void dispatch(Worker& worker) throw(runtime_error);
+
+      void receive(Worker& worker);
+
+      void abort(Worker& worker, TaskStatus status, const string& reason);
+
+      void stop(Worker& worker, bool isKilled, int* exitStatus = nullptr);
+
+      void finish(size_t taskIdx, TaskStatus status, string&& data);
+
+      [[noreturn]] void serve(int socket) const throw();
+  };
+}
+#endif // _WIN32
+
+
+#endif // PROCESSPOOL_HXX
@@ -0,0 +1,276 @@
+﻿#include "threadpool.hxx"
+
+#include <cstddef>
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+
+namespace Utils
+{
+  using std::lock_guard;
+  using std::size_t;
+  using std::thread;
+  using std::unique_lock;
+
+
+  /**
+   * @brief ThreadPool::ThreadPool
+   * @param threadsCount Workers count (including the calling thread),
+   * `0' stands for the number of the hardware threads.
+   */
+  ThreadPool::ThreadPool(size_t threadsCount) :
+    ranges_(
+      threadsCount > 0 ?
+      threadsCount :
+      std::max<size_t>(thread::hardware_concurrency(), 1)
+    )
+  {
+    threads_.reserve(ranges_.size() - 1);
+    for (size_t workerIdx(1); workerIdx < ranges_.size(); ++workerIdx)
+    {
+      threads_.emplace_back(&ThreadPool::work, this, workerIdx);
+    }
+  }
+
+
+  ThreadPool::~ThreadPool()
+  {
+    {
+      const lock_guard<mutex> lock(mutex_);
+      isStopping_ = true;
+    }
+    startCondition_.notify_all();
+
+    for (thread& workerThread : threads_)
+    {
+      workerThread.join();
+    }
+  }
+
+
+  size_t
+  ThreadPool::threadsCount() const
+  {
+    return ranges_.size();
+  }
+
+
+  /**
+   * @brief ThreadPool::run
+   * Calls `task' for every index in [0; tasksCount) and waits for all
+   * of them to finish. The first exception thrown by `task' is rethrown
+   * after that.
+   * @param tasksCount
+   * @param task
+   */
+  void
+  ThreadPool::run(size_t tasksCount, const Task& task)
+  {
+    const lock_guard<mutex> runLock(runMutex_);
+
+    if (tasksCount == 0)
+    {
+      return;
+    }
+
+    const size_t workersCount(ranges_.size());
+    for (size_t workerIdx(0); workerIdx < workersCount; ++workerIdx)
+    {
+      TaskRange& range(ranges_[workerIdx]);
+      const lock_guard<mutex> rangeLock(range.rangeMutex);
+
+      range.first = tasksCount * workerIdx / workersCount;
+      range.last = tasksCount * (workerIdx + 1) / workersCount;
+    }
+
+    {
+      const lock_guard<mutex> lock(mutex_);
+      task_ = &task;
+      exception_ = exception_ptr();
+      busyThreadsCount_ = threads_.size();
+      ++generation_;
+    }
+    startCondition_.notify_all();
+
+    runTasks(0);
+
+    exception_ptr exception;
+    {
+      unique_lock<mutex> lock(mutex_);
+      finishCondition_.wait(lock, [this] { return busyThreadsCount_ == 0; });
+
+      task_ = nullptr;
+      std::swap(exception, exception_);
+    }
+
+    if (exception)
+    {
+      std::rethrow_exception(exception);
+    }
+  }
+
+
+  /**
+   * @brief ThreadPool::work
+   * The loop of the pool thread: waits for the next batch and runs it.
+   * @param workerIdx
+   */
+  void
+  ThreadPool::work(size_t workerIdx)
+  {
+    size_t generation(0);
+
+    while (true)
+    {
+      {
+        unique_lock<mutex> lock(mutex_);
+        startCondition_.wait(
+          lock, [&] { return isStopping_ || generation_ != generation; }
+        );
+
+        if (isStopping_)
+        {
+          return;
+        }
+
+        generation = generation_;
+      }
+
+      runTasks(workerIdx);
+
+      {
+        const lock_guard<mutex> lock(mutex_);
+        if (--busyThreadsCount_ == 0)
+        {
+          finishCondition_.notify_one();
+        }
+      }
+    }
+  }
+
+
+  /**
+   * @brief ThreadPool::runTasks
+   * Runs the tasks of the worker's own range, then the stolen ones,
+   * until there is nothing left to steal.
+   * @param workerIdx
+   */
+  void
+  ThreadPool::runTasks(size_t workerIdx)
+  {
+    size_t taskIdx(0);
+
+    while (true)
+    {
+      if (!popTask(workerIdx, taskIdx))
+      {
+        if (!stealTasks(workerIdx))
+        {
+          return;
+        }
+
+        continue;
+      }
+
+      try
+      {
+        (*task_)(workerIdx, taskIdx);
+      }
+      catch (...)
+      {
+        const lock_guard<mutex> lock(mutex_);
+        if (!exception_)
+        {
+          exception_ = std::current_exception();
+        }
+      }
+    }
+  }
+
+
+  /**
+   * @brief ThreadPool::popTask
+   * Takes the lowest task index of the worker's own range.
+   * @param workerIdx
+   * @param taskIdx
+   * @return `false' if the range is empty.
+   */
+  bool
+  ThreadPool::popTask(size_t workerIdx, size_t& taskIdx)
+  {
+    TaskRange& range(ranges_[workerIdx]);
+    const lock_guard<mutex> rangeLock(range.rangeMutex);
+
+    if (range.first == range.last)
+    {
+      return false;
+    }
+
+    taskIdx = range.first++;
+
+    return true;
+  }
+
+
+  /**
+   * @brief ThreadPool::stealTasks
+   * Moves the upper half of the largest range left to the worker's
+   * own (empty) range.
+   * @param workerIdx
+   * @return `false' if there is nothing left to steal.
+   */
+  bool
+  ThreadPool::stealTasks(size_t workerIdx)
+  {
+    while (true)
+    {
+      //NOTE: The sizes are only a hint, the victim's range is rechecked
+      size_t victimIdx(workerIdx);
+      size_t maxSize(0);
+      for (size_t idx(0); idx < ranges_.size(); ++idx)
+      {
+        TaskRange& range(ranges_[idx]);
+        const lock_guard<mutex> rangeLock(range.rangeMutex);
+
+        if (range.last - range.first > maxSize)
+        {
+          maxSize = range.last - range.first;
+          victimIdx = idx;
+        }
+      }
+
+      if (maxSize == 0)
+      {
+        return false;
+      }
+
+      size_t first(0);
+      size_t last(0);
+      {
+        TaskRange& victim(ranges_[victimIdx]);
+        const lock_guard<mutex> rangeLock(victim.rangeMutex);
+
+        const size_t size(victim.last - victim.first);
+        if (size == 0)
+        {
+          continue;
+        }
+
+        last = victim.last;
+        first = last - (size + 1) / 2;
+        victim.last = first;
+      }
+
+      TaskRange& range(ranges_[workerIdx]);
+      const lock_guard<mutex> rangeLock(range.rangeMutex);
+
+      range.first = first;
+      range.last = last;
+
+      return true;
+    }
+  }
+}
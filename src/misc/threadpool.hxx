@@ -0,0 +1,111 @@
+﻿#pragma once
+
+#ifndef THREADPOOL_HXX
+#define THREADPOOL_HXX
+
+
+#include <cstddef>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace Utils
+{
+  using std::condition_variable;
+  using std::exception_ptr;
+  using std::function;
+  using std::mutex;
+  using std::size_t;
+  using std::thread;
+  using std::vector;
+
+
+  /**
+   * @brief The ThreadPool class
+   * Runs the batches of independent tasks on the fixed set of threads.
+   * Each worker starts w/ the equal contiguous range of the task
+   * indices, the idle ones steal the upper half of the largest range
+   * left, so that the batches of uneven tasks keep all the cores busy.
+   * The calling thread works as the worker #0.
+   */
+  class ThreadPool
+  {
+    public:
+      /**
+       * @brief Task
+       * Called w/ the worker index (in [0; threadsCount())) and
+       * the task index.
+       */
+      using Task = function<void(size_t, size_t)>;
+
+
+      explicit ThreadPool(size_t threadsCount = 0);
+
+      ThreadPool(const ThreadPool&) = delete;
+
+      ThreadPool& operator =(const ThreadPool&) = delete;
+
+      ~ThreadPool();
+
+      size_t threadsCount() const;
+
+      void run(size_t tasksCount, const Task& task);
+
+
+    private:
+      /**
+       * @brief The TaskRange struct
+       * Task indices [first; last) left to the worker.
+       */
+      struct TaskRange
+      {
+        mutex rangeMutex;
+
+        size_t first = 0;
+
+        size_t last = 0;
+      };
+
+
+      vector<TaskRange> ranges_;
+
+      vector<thread> threads_;
+
+      //Guards everything below
+      mutex mutex_;
+
+      condition_variable startCondition_;
+
+      condition_variable finishCondition_;
+
+      const Task* task_ = nullptr;
+
+      size_t generation_ = 0;
+
+      size_t busyThreadsCount_ = 0;
+
+      bool isStopping_ = false;
+
+      exception_ptr exception_;
+
+      //Serializes the concurrent `run' calls
+      mutex runMutex_;
+
+
+      void work(size_t workerIdx);
+
+      void runTasks(size_t workerIdx);
+
+      bool popTask(size_t workerIdx, size_t& taskIdx);
+
+      bool stealTasks(size_t workerIdx);
+  };
+}
+
+
+#endif // THREADPOOL_HXX
@@ -15,18 +15,20 @@
 #include <type_traits>
 #include <vector>
 
-#include <QApplication>
-
 #include "cxx-prettyprint/prettyprint.hpp"
 #include "eigen3/Eigen/Core"
 #include "fmt/format.h"
 #include "fmt/ostream.h"
 
+#include "logsink.hxx"
+
+
+//NOTE: The non-GUI code never creates the application object
+class QApplication;
+
 
 namespace Utils
 {
-  using fmt::print;
-  using std::cerr;
   using std::copy;
   using std::false_type;
   using std::list;
@@ -153,13 +155,13 @@ namespace Utils
   template <typename... Args>
   /**
    * @brief printDebugLog
+   * Formats the message and passes it to the log sink.
    * TODO: [1;0] Use
    *   `Q_FUNC_INFO' (from `QtGlobal') or
    *   `BOOST_CURRENT_FUNCTION' (from `boost/current_function.hpp') or
    *   `__PRETTY_FUNCTION__' or
    *   `__FUNCTION__' or
    *   `__func__'?
-   * TODO: [1;0] Use `std::clog'.
    * @param func
    * @param file
    * @param line
@@ -172,9 +174,11 @@ namespace Utils
     const char* format, const Args&... args
   )
   {
-    print(cerr, "\n|*** {0}  {1}  {2}\n|    ", func, file, line);
-    print(cerr, format, args...);
-    print(cerr, "\n");
+    writeLog(
+      LogLevel::Debug,
+      fmt::format("\n|*** {0}  {1}  {2}\n|    ", func, file, line) +
+      fmt::format(format, args...)
+    );
   }
 }
 
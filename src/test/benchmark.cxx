@@ -0,0 +1,193 @@
+﻿#include "benchmark.hxx"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+#include "eigen3/Eigen/Core"
+
+#include "../lp/linearprogramdata.hxx"
+#include "../lp/packedsimplexsolver.hxx"
+#include "../lp/simplexsolver.hxx"
+#include "../math/numerictypes.hxx"
+
+
+namespace Test
+{
+  using namespace Eigen;
+  using namespace LinearProgramming;
+  using namespace NumericTypes;
+  using namespace std;
+
+
+  namespace
+  {
+    /**
+     * @brief makeRandomPrograms
+     * Makes `count' random programs of the same size, about a third
+     * of the constraints coefficients are zeros.
+     * @param rows
+     * @param cols
+     * @param count
+     * @return
+     */
+    template<typename T>
+    vector<LinearProgramData<T>>
+    makeRandomPrograms(DenseIndex rows, DenseIndex cols, size_t count)
+    {
+      mt19937 generator(1);
+      uniform_int_distribution<int> distribution(-5, 9);
+
+      vector<LinearProgramData<T>> ret;
+      ret.reserve(count);
+
+      for (size_t k(0); k < count; ++k)
+      {
+        Matrix<T, 1, Dynamic> c(1, cols);
+        Matrix<T, Dynamic, Dynamic> A(rows, cols);
+        Matrix<T, Dynamic, 1> b(rows, 1);
+
+        for (DenseIndex i(0); i < rows; ++i)
+        {
+          for (DenseIndex j(0); j < cols; ++j)
+          {
+            A(i, j) = (
+              distribution(generator) > 6 ? 0 : distribution(generator)
+            );
+          }
+
+          b(i) = distribution(generator) + 5;
+        }
+
+        for (DenseIndex j(0); j < cols; ++j)
+        {
+          c(j) = distribution(generator);
+        }
+
+        ret.emplace_back(c, A, b);
+      }
+
+      return ret;
+    }
+
+
+    /**
+     * @brief benchmark
+     * Solves `linearProgramsData' w/ `SimplexSolver' one by one and w/
+     * `PackedSimplexSolver', writes the best of 3 times of both.
+     * @param linearProgramsData
+     */
+    template<typename T>
+    void
+    benchmark(const vector<LinearProgramData<T>>& linearProgramsData)
+    throw(logic_error)
+    {
+      using Clock = chrono::steady_clock;
+      using Result = typename PackedSimplexSolver<T>::Result;
+
+      const auto milliseconds([](Clock::duration duration)
+      {
+        return chrono::duration<double, milli>(duration).count();
+      });
+
+      double plainTime(numeric_limits<double>::max());
+      double packedTime(numeric_limits<double>::max());
+
+      vector<Result> plainResults;
+      vector<Result> packedResults;
+
+      for (int run(0); run < 3; ++run)
+      {
+        plainResults.clear();
+
+        const Clock::time_point start(Clock::now());
+
+        SimplexSolver<T> solver;
+        for (const LinearProgramData<T>& linearProgramData : linearProgramsData)
+        {
+          solver.setLinearProgramData(linearProgramData);
+          plainResults.push_back(solver.solve());
+        }
+
+        const Clock::time_point middle(Clock::now());
+
+        packedResults = PackedSimplexSolver<T>().solve(linearProgramsData);
+
+        const Clock::time_point finish(Clock::now());
+
+        plainTime = min(plainTime, milliseconds(middle - start));
+        packedTime = min(packedTime, milliseconds(finish - middle));
+      }
+
+      for (size_t k(0); k < plainResults.size(); ++k)
+      {
+        if (
+          plainResults[k].first != packedResults[k].first ||
+          bool(plainResults[k].second) != bool(packedResults[k].second) ||
+          (
+            plainResults[k].second &&
+            plainResults[k].second->extremePoint !=
+            packedResults[k].second->extremePoint
+          )
+        )
+        {
+          throw logic_error(
+            "Test::benchmarkPackedSimplexSolver: assertion failed."
+          );
+        }
+      }
+
+      cout << fmt::format(
+        "{:>4}x{:<4} {:>6} {:>12.2f} {:>12.2f} {:>8.2f}\n",
+        linearProgramsData.front().constraintsCount(),
+        linearProgramsData.front().variablesCount(),
+        linearProgramsData.size(), plainTime, packedTime,
+        plainTime / packedTime
+      ) << flush;
+    }
+  }
+
+
+  /**
+   * @brief benchmarkPackedSimplexSolver
+   * Compares `PackedSimplexSolver' w/ `SimplexSolver' on the batches
+   * of the random programs of the growing size. Writes the times (ms)
+   * to `std::cout', the solutions are checked to be the same.
+   * NOTE: Is meaningful w/o `LP_WITH_DEBUG_LOG' only.
+   */
+  void
+  benchmarkPackedSimplexSolver() throw(logic_error)
+  {
+    const vector<pair<DenseIndex, DenseIndex>> sizes{
+      {4, 8}, {8, 16}, {16, 32}, {32, 64}, {64, 128}, {128, 256}
+    };
+
+    cout << " rows×cols  count   plain (ms)  packed (ms)  speedup\n";
+
+    cout << "real:\n";
+    for (const pair<DenseIndex, DenseIndex>& size : sizes)
+    {
+      benchmark(
+        makeRandomPrograms<real_t>(
+          size.first, size.second, 262144 / (size.first * size.second)
+        )
+      );
+    }
+
+    //NOTE: The larger rational programs overflow `integer_t'
+    cout << "rational:\n";
+    for (const pair<DenseIndex, DenseIndex>& size : {sizes[0], sizes[1]})
+    {
+      benchmark(
+        makeRandomPrograms<rational_t>(
+          size.first, size.second, 16384 / (size.first * size.second)
+        )
+      );
+    }
+  }
+}
@@ -0,0 +1,19 @@
+﻿#pragma once
+
+#ifndef BENCHMARK_HXX
+#define BENCHMARK_HXX
+
+
+#include <stdexcept>
+
+
+namespace Test
+{
+  using std::logic_error;
+
+
+  void benchmarkPackedSimplexSolver() throw(logic_error);
+}
+
+
+#endif // BENCHMARK_HXX
@@ -0,0 +1,304 @@
+﻿#include "clitest.hxx"
+
+#ifndef _WIN32
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "fmt/format.h"
+#include "eigen3/Eigen/Core"
+
+#include "../cli/solvedaemon.hxx"
+#include "../io/binaryformat.hxx"
+#include "../io/binarywriter.hxx"
+#include "../lp/linearprogramdata.hxx"
+#include "../math/numerictypes.hxx"
+#include "../misc/processpool.hxx"
+#include "../misc/utils.hxx"
+#include "../config.hxx"
+
+
+namespace Test
+{
+  using namespace Eigen;
+  using namespace LinearProgramming;
+  using namespace NumericTypes;
+  using namespace ProgramIO;
+  using namespace std;
+  using namespace Utils;
+
+
+  namespace
+  {
+    /**
+     * @brief countAttempt
+     * Appends the mark to the file of the task, as the workers
+     * can not share any other state w/ the test.
+     * @param taskIdx
+     * @return Count of the attempts to run the task, including this one.
+     */
+    size_t
+    countAttempt(size_t taskIdx)
+    {
+      const string fileName(fmt::format("clitest.task{}", taskIdx));
+
+      {
+        ofstream file(fileName, ios::out | ios::app);
+        file << '.';
+      }
+
+      ifstream file(fileName);
+      file.seekg(0, ios::end);
+
+      return size_t(file.tellg());
+    }
+
+
+    /**
+     * @brief connectTo
+     * Connects to the UNIX-domain socket, waiting for it to be listened
+     * on for a second at most.
+     * @param socketName
+     * @return The connected socket, -1 on failure.
+     */
+    int
+    connectTo(const string& socketName)
+    {
+      sockaddr_un address;
+      std::memset(&address, 0, sizeof(address));
+      address.sun_family = AF_UNIX;
+      socketName.copy(address.sun_path, sizeof(address.sun_path) - 1);
+
+      for (int attempt(0); attempt < 100; ++attempt)
+      {
+        const int socket(::socket(AF_UNIX, SOCK_STREAM, 0));
+        if (
+          ::connect(
+            socket, reinterpret_cast<const sockaddr*>(&address),
+            sizeof(address)
+          ) == 0
+        )
+        {
+          return socket;
+        }
+
+        ::close(socket);
+        this_thread::sleep_for(chrono::milliseconds(10));
+      }
+
+      return -1;
+    }
+
+
+    /**
+     * @brief request
+     * Sends the request and reads the response line.
+     * @param socket
+     * @param request
+     * @return
+     */
+    string
+    request(int socket, const string& request)
+    {
+      const ssize_t size(ssize_t(request.size()));
+      if (::write(socket, request.data(), request.size()) != size)
+      {
+        return string();
+      }
+
+      string ret;
+      char c('\0');
+      while (::read(socket, &c, 1) == 1 && c != '\n')
+      {
+        ret += c;
+      }
+
+      return ret;
+    }
+  }
+
+
+  /**
+   * @brief testProcessPool
+   * Runs the tasks, one of which always crashes its worker, one crashes
+   * it the first time only and one fails. Checks that the crashed tasks
+   * are retried `Config::Utils::MaxTaskAttempts' times at most and that
+   * the results are handled in the order of the tasks.
+   * NOTE: The marks of the attempts are written to the current directory.
+   */
+  void
+  testProcessPool() throw(logic_error)
+  {
+    using TaskStatus = ProcessPool::TaskStatus;
+
+    const size_t tasksCount(6);
+    const size_t crashingTaskIdx(2);
+    const size_t onceCrashingTaskIdx(3);
+    const size_t failingTaskIdx(4);
+
+    const ProcessPool::Task task([&](size_t taskIdx, string& output)
+    {
+      const size_t attemptsCount(countAttempt(taskIdx));
+
+      if (
+        taskIdx == crashingTaskIdx ||
+        (taskIdx == onceCrashingTaskIdx && attemptsCount == 1)
+      )
+      {
+        std::abort();
+      }
+
+      output = fmt::format("task #{} attempt #{}", taskIdx, attemptsCount);
+
+      return (taskIdx != failingTaskIdx);
+    });
+
+    vector<tuple<size_t, TaskStatus, string>> results;
+
+    ProcessPool(2).run(
+      tasksCount, task,
+      [&results](size_t taskIdx, TaskStatus status, const string& output)
+      {
+        results.emplace_back(taskIdx, status, output);
+      }
+    );
+
+    vector<size_t> attemptsCounts;
+    for (size_t taskIdx(0); taskIdx < tasksCount; ++taskIdx)
+    {
+      const string fileName(fmt::format("clitest.task{}", taskIdx));
+
+      ifstream file(fileName);
+      file.seekg(0, ios::end);
+      attemptsCounts.push_back(size_t(file.tellg()));
+      file.close();
+
+      std::remove(fileName.c_str());
+    }
+
+    bool isPassed(results.size() == tasksCount);
+    for (size_t taskIdx(0); isPassed && taskIdx < tasksCount; ++taskIdx)
+    {
+      const TaskStatus status(get<1>(results[taskIdx]));
+
+      LOG(
+        "Task #{0}: status == {1}, attempts == {2}, output == `{3}'",
+        taskIdx, int(status), attemptsCounts[taskIdx],
+        get<2>(results[taskIdx])
+      );
+
+      if (taskIdx == crashingTaskIdx)
+      {
+        isPassed = (
+          status == TaskStatus::Crashed &&
+          attemptsCounts[taskIdx] == Config::Utils::MaxTaskAttempts
+        );
+      }
+      else
+      {
+        const size_t attemptsCount(taskIdx == onceCrashingTaskIdx ? 2 : 1);
+
+        isPassed = (
+          status == (
+            taskIdx == failingTaskIdx ? TaskStatus::Failed : TaskStatus::Done
+          ) &&
+          attemptsCounts[taskIdx] == attemptsCount &&
+          get<2>(results[taskIdx]) ==
+          fmt::format("task #{} attempt #{}", taskIdx, attemptsCount)
+        );
+      }
+
+      isPassed = isPassed && get<0>(results[taskIdx]) == taskIdx;
+    }
+
+    if (!isPassed)
+    {
+      throw logic_error("Test::testProcessPool: assertion failed.");
+    }
+  }
+
+
+  /**
+   * @brief testSolveDaemon
+   * Sends the binary program w/ the corrupted rational number to the
+   * daemon and then the valid program over the same connection.
+   * Checks that the first one is answered w/ the error and the second
+   * one is solved.
+   * NOTE: The socket is created in the current directory.
+   */
+  void
+  testSolveDaemon() throw(logic_error)
+  {
+    Matrix<rational_t, 1, Dynamic> c(1, 2);
+    c << 1, 1;
+    Matrix<rational_t, Dynamic, Dynamic> A(1, 2);
+    A << 1, 1;
+    Matrix<rational_t, Dynamic, 1> b(1, 1);
+    b << 1;
+
+    ostringstream stream;
+    BinaryWriter<rational_t>().write(
+      stream, LinearProgramData<rational_t>(c, A, b)
+    );
+    string image(stream.str());
+
+    //Zero denominator of the RHS entry
+    BinaryHeader header;
+    std::memcpy(&header, image.data(), sizeof(header));
+    const integer_t pair[2] = {1, 0};
+    std::memcpy(&image[header.rhsOffset], pair, sizeof(pair));
+
+    const string json(
+      "{\"objective\": [1, 1], \"rhs\": [1], \"constraints\": [[1, 1]]}"
+    );
+
+    const string socketName("clitest.sock");
+    Cli::SolveDaemon daemon(socketName);
+    thread daemonThread(&Cli::SolveDaemon::run, &daemon);
+
+    string corruptedResponse;
+    string validResponse;
+
+    const int socket(connectTo(socketName));
+    if (socket >= 0)
+    {
+      corruptedResponse = request(
+        socket, fmt::format("lpb {} corrupted\n", image.size()) + image
+      );
+      validResponse = request(
+        socket, fmt::format("json {} valid\n", json.size()) + json
+      );
+
+      ::close(socket);
+    }
+
+    daemon.stop();
+    daemonThread.join();
+
+    LOG("Responses:\n{0}\n{1}", corruptedResponse, validResponse);
+
+    if (
+      corruptedResponse.find("\"name\": \"corrupted\"") == string::npos ||
+      corruptedResponse.find("\"status\": \"error\"") == string::npos ||
+      validResponse.find("\"name\": \"valid\"") == string::npos ||
+      validResponse.find("\"status\": \"optimal\"") == string::npos
+    )
+    {
+      throw logic_error("Test::testSolveDaemon: assertion failed.");
+    }
+  }
+}
+#endif // _WIN32
@@ -0,0 +1,24 @@
+﻿#pragma once
+
+#ifndef CLITEST_HXX
+#define CLITEST_HXX
+
+
+#include <stdexcept>
+
+
+//NOTE: The process pool and the daemon are POSIX-only
+#ifndef _WIN32
+namespace Test
+{
+  using std::logic_error;
+
+
+  void testProcessPool() throw(logic_error);
+
+  void testSolveDaemon() throw(logic_error);
+}
+#endif // _WIN32
+
+
+#endif // CLITEST_HXX
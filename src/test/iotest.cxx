@@ -0,0 +1,444 @@
+﻿#include "iotest.hxx"
+
+#include <cstdio>
+#include <cstring>
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "eigen3/Eigen/Core"
+
+#include "../io/binaryformat.hxx"
+#include "../io/binaryprogram.hxx"
+#include "../io/binarywriter.hxx"
+#include "../io/compressedstreambuffer.hxx"
+#include "../io/importedprogram.hxx"
+#include "../io/jsonreader.hxx"
+#include "../io/jsonwriter.hxx"
+#include "../io/lpreader.hxx"
+#include "../io/mpsformat.hxx"
+#include "../io/mpsreader.hxx"
+#include "../io/mpswriter.hxx"
+#include "../io/parseerror.hxx"
+#include "../io/programfile.hxx"
+#include "../lp/linearprogramdata.hxx"
+#include "../math/numerictypes.hxx"
+#include "../misc/utils.hxx"
+
+
+namespace Test
+{
+  using namespace Eigen;
+  using namespace LinearProgramming;
+  using namespace NumericTypes;
+  using namespace ProgramIO;
+  using namespace std;
+
+
+  namespace
+  {
+    /**
+     * @brief isSameProgram
+     * @param lhs
+     * @param rhs
+     * @return `true' if the programs have the same coefficients.
+     */
+    template<typename T>
+    bool
+    isSameProgram(
+      const LinearProgramData<T>& lhs, const LinearProgramData<T>& rhs
+    )
+    {
+      return (
+        lhs.constraintsCount() == rhs.constraintsCount() &&
+        lhs.variablesCount() == rhs.variablesCount() &&
+        lhs.objectiveFunctionCoeffs == rhs.objectiveFunctionCoeffs &&
+        lhs.constraintsCoeffs == rhs.constraintsCoeffs &&
+        lhs.constraintsRHS == rhs.constraintsRHS
+      );
+    }
+
+
+    /**
+     * @brief isRejected
+     * @param json
+     * @return `true' if `JsonReader' rejects `json' w/ `ParseError'.
+     */
+    bool
+    isRejected(const string& json)
+    {
+      try
+      {
+        JsonReader<rational_t>().read(json.data(), json.data() + json.size());
+      }
+      catch (const ParseError& pe)
+      {
+        LOG("Rejected: {0}", pe.what());
+
+        return true;
+      }
+
+      return false;
+    }
+
+
+    /**
+     * @brief writeFile
+     * Writes `text' to the file, gzip-compressed if `isCompressed'.
+     * @param fileName
+     * @param text
+     * @param isCompressed
+     */
+    void
+    writeFile(const string& fileName, const string& text, bool isCompressed)
+    {
+      std::ofstream file(fileName, std::ios::out | std::ios::binary);
+
+      if (!isCompressed)
+      {
+        file << text;
+
+        return;
+      }
+
+      DeflatingStreamBuffer compressor(file.rdbuf());
+      std::ostream stream(&compressor);
+      stream << text;
+      stream.flush();
+
+      if (!compressor.finish())
+      {
+        throw logic_error("Test::writeFile: compression failed.");
+      }
+    }
+
+
+    /**
+     * @brief exampleProgram
+     * @return Example 2.2 - (3/2, 0, 0, 1) -> -18
+     */
+    LinearProgramData<rational_t>
+    exampleProgram()
+    {
+      Matrix<rational_t, 1, Dynamic> c(1, 4);
+      c <<
+        -10, 5, 7, -3;
+
+      Matrix<rational_t, Dynamic, Dynamic> A(3, 4);
+      A <<
+        -1, -2, 3, 3,
+        1, 1, 7, 2,
+        2, 2, 8, 1;
+
+      Matrix<rational_t, Dynamic, 1> b(3, 1);
+      b <<
+        rational_t(3, 2),
+        rational_t(7, 2),
+        4;
+
+      return LinearProgramData<rational_t>(c, A, b);
+    }
+  }
+
+
+  /**
+   * @brief testMpsWriter
+   * Checks that the program written w/ the names that clash w/ each other
+   * or w/ the objective function row is read back as is.
+   */
+  void
+  testMpsWriter() throw(logic_error)
+  {
+    const LinearProgramData<rational_t> linearProgramData(exampleProgram());
+
+    const vector<string> rowNames{"COST", "a b", "R3"};
+    const vector<string> columnNames{"x", "x", "X2", "X2"};
+
+    for (const MpsFormat format : {MpsFormat::Fixed, MpsFormat::Free})
+    {
+      ostringstream stream;
+      MpsWriter<rational_t>(format).write(
+        stream, linearProgramData, "TEST", rowNames, columnNames
+      );
+
+      istringstream input(stream.str());
+      const ImportedProgram<rational_t> importedProgram(
+        MpsReader<rational_t>(format).read(input)
+      );
+
+      LOG("MPS:\n{0}", stream.str());
+
+      if (!isSameProgram(importedProgram.linearProgramData, linearProgramData))
+      {
+        throw logic_error("Test::testMpsWriter: assertion failed.");
+      }
+    }
+  }
+
+
+  /**
+   * @brief testLpReader
+   * Checks that the bounds are read the same way as `MpsReader' reads
+   * them: the negative upper bound w/o the lower one makes the variable
+   * unbounded below.
+   */
+  void
+  testLpReader() throw(logic_error)
+  {
+    const string lp(
+      "minimize\n"
+      " obj: x + 2 y\n"
+      "subject to\n"
+      " c1: x + y >= -10\n"
+      "bounds\n"
+      " x <= -5\n"
+      "end\n"
+    );
+
+    const string mps(
+      "NAME TEST\n"
+      "ROWS\n"
+      " N COST\n"
+      " G C1\n"
+      "COLUMNS\n"
+      " x COST 1 C1 1\n"
+      " y COST 2 C1 1\n"
+      "RHS\n"
+      " RHS C1 -10\n"
+      "BOUNDS\n"
+      " UP BND x -5\n"
+      "ENDATA\n"
+    );
+
+    const ImportedProgram<rational_t> lpProgram(
+      LpReader<rational_t>().read(lp.data(), lp.data() + lp.size())
+    );
+
+    istringstream input(mps);
+    const ImportedProgram<rational_t> mpsProgram(
+      MpsReader<rational_t>().read(input)
+    );
+
+    LOG(
+      "LP: c == {0}, A == {1}, b == {2}",
+      lpProgram.linearProgramData.objectiveFunctionCoeffs,
+      lpProgram.linearProgramData.constraintsCoeffs,
+      lpProgram.linearProgramData.constraintsRHS
+    );
+
+    if (
+      !isSameProgram(
+        lpProgram.linearProgramData, mpsProgram.linearProgramData
+      ) ||
+      lpProgram.objectiveOffset != mpsProgram.objectiveOffset ||
+      lpProgram.columnMappings.size() != mpsProgram.columnMappings.size()
+    )
+    {
+      throw logic_error("Test::testLpReader: assertion failed.");
+    }
+  }
+
+
+  /**
+   * @brief testBinaryProgram
+   * Checks that the rational numbers w/ the corrupted denominator
+   * are rejected and the ones not in the lowest terms are normalized.
+   */
+  void
+  testBinaryProgram() throw(logic_error)
+  {
+    const LinearProgramData<rational_t> linearProgramData(exampleProgram());
+
+    for (const BinaryLayout layout : {BinaryLayout::Dense, BinaryLayout::CSC})
+    {
+      ostringstream stream;
+      BinaryWriter<rational_t>(layout).write(stream, linearProgramData);
+      const string image(stream.str());
+
+      BinaryHeader header;
+      std::memcpy(&header, image.data(), sizeof(header));
+
+      //Puts the (numerator, denominator) pair into the first RHS entry
+      const auto readPatched([&](integer_t numerator, integer_t denominator)
+      {
+        string patched(image);
+        const integer_t pair[2] = {numerator, denominator};
+        std::memcpy(&patched[header.rhsOffset], pair, sizeof(pair));
+
+        const BinaryProgram binaryProgram(
+          patched.data(), patched.data() + patched.size()
+        );
+
+        return binaryProgram.view<rational_t>().linearProgramData();
+      });
+
+      for (const integer_t denominator : {integer_t(0), integer_t(-2)})
+      {
+        bool isRejected(false);
+        try
+        {
+          readPatched(1, denominator);
+        }
+        catch (const ParseError&)
+        {
+          isRejected = true;
+        }
+
+        if (!isRejected)
+        {
+          throw logic_error("Test::testBinaryProgram: assertion failed.");
+        }
+      }
+
+      //NOTE: The entry is 3/2 already, the pairs are compared as is
+      if (!isSameProgram(readPatched(6, 4), linearProgramData))
+      {
+        throw logic_error("Test::testBinaryProgram: assertion failed.");
+      }
+    }
+  }
+
+
+  /**
+   * @brief testJsonReader
+   * Checks that the ragged `constraints' rows and the indices beyond
+   * `rhs' and `objective' are rejected rather than padded w/ zeros.
+   */
+  void
+  testJsonReader() throw(logic_error)
+  {
+    const string program(
+      "{\"objective\": [1, 2], \"rhs\": [3, 4], "
+      "\"constraints\": [[1, 0], [0, 1]]}"
+    );
+    const string raggedProgram(
+      "{\"objective\": [1, 2], \"rhs\": [3, 4], "
+      "\"constraints\": [[1, 0], [1]]}"
+    );
+    const string wideProgram(
+      "{\"objective\": [1, 2], \"rhs\": [3, 4], "
+      "\"constraints\": [[1, 0, 5], [0, 1, 6]]}"
+    );
+    const string tripletsProgram(
+      "{\"triplets\": [[0, 0, 1], [1, 1, 1]], "
+      "\"objective\": [1, 2], \"rhs\": [3, 4]}"
+    );
+    const string tripletRowProgram(
+      "{\"triplets\": [[0, 0, 1], [2, 1, 1]], "
+      "\"objective\": [1, 2], \"rhs\": [3, 4]}"
+    );
+    const string tripletColumnProgram(
+      "{\"objective\": [1, 2], \"rhs\": [3, 4], "
+      "\"triplets\": [[0, 0, 1], [1, 2, 1]]}"
+    );
+    const string declaredProgram(
+      "{\"rows\": 2, \"cols\": 3, \"objective\": [1, 2], "
+      "\"rhs\": [3, 4], \"triplets\": [[0, 0, 1], [1, 2, 1]]}"
+    );
+
+    if (
+      isRejected(program) || !isRejected(raggedProgram) ||
+      !isRejected(wideProgram) || isRejected(tripletsProgram) ||
+      !isRejected(tripletRowProgram) || !isRejected(tripletColumnProgram) ||
+      isRejected(declaredProgram)
+    )
+    {
+      throw logic_error("Test::testJsonReader: assertion failed.");
+    }
+  }
+
+
+  /**
+   * @brief testCompressedFiles
+   * Checks that the gzip-compressed MPS, LP and JSON files are read
+   * as the plain ones and that the truncated ones are rejected.
+   * NOTE: The files are written to the current directory.
+   */
+  void
+  testCompressedFiles() throw(logic_error)
+  {
+    const LinearProgramData<rational_t> linearProgramData(exampleProgram());
+
+    ostringstream mps;
+    MpsWriter<rational_t>().write(mps, linearProgramData);
+
+    ostringstream json;
+    JsonWriter<rational_t>().write(json, linearProgramData);
+
+    const string lp(
+      "maximize\n"
+      " obj: 3 x + 2 y\n"
+      "subject to\n"
+      " c1: x + y <= 4\n"
+      " c2: x + 3 y <= 6\n"
+      "bounds\n"
+      " x <= 3\n"
+      "end\n"
+    );
+
+    const vector<pair<string, string>> files{
+      {"mps", mps.str()}, {"lp", lp}, {"json", json.str()}
+    };
+
+    for (const pair<string, string>& file : files)
+    {
+      const string plainName("iotest." + file.first);
+      const string compressedName(plainName + ".gz");
+
+      writeFile(plainName, file.second, false);
+      writeFile(compressedName, file.second, true);
+
+      const ImportedProgram<rational_t> plainProgram(
+        readProgramFile<rational_t>(plainName)
+      );
+      const ImportedProgram<rational_t> compressedProgram(
+        readProgramFile<rational_t>(compressedName)
+      );
+
+      bool isPassed(
+        isSameProgram(
+          plainProgram.linearProgramData, compressedProgram.linearProgramData
+        ) &&
+        plainProgram.goalType == compressedProgram.goalType
+      );
+
+      //Cut in the middle of the data and right before the gzip trailer
+      std::ifstream compressedFile(
+        compressedName, std::ios::in | std::ios::binary
+      );
+      const string compressed(
+        (std::istreambuf_iterator<char>(compressedFile)),
+        std::istreambuf_iterator<char>()
+      );
+      compressedFile.close();
+
+      for (const size_t size : {compressed.size() / 2, compressed.size() - 4})
+      {
+        writeFile(compressedName, compressed.substr(0, size), false);
+
+        try
+        {
+          readProgramFile<rational_t>(compressedName);
+          isPassed = false;
+        }
+        catch (const ParseError& pe)
+        {
+          LOG("Rejected: {0}", pe.what());
+        }
+      }
+
+      std::remove(plainName.c_str());
+      std::remove(compressedName.c_str());
+
+      if (!isPassed)
+      {
+        throw logic_error("Test::testCompressedFiles: assertion failed.");
+      }
+    }
+  }
+}
@@ -0,0 +1,27 @@
+﻿#pragma once
+
+#ifndef IOTEST_HXX
+#define IOTEST_HXX
+
+
+#include <stdexcept>
+
+
+namespace Test
+{
+  using std::logic_error;
+
+
+  void testMpsWriter() throw(logic_error);
+
+  void testLpReader() throw(logic_error);
+
+  void testBinaryProgram() throw(logic_error);
+
+  void testJsonReader() throw(logic_error);
+
+  void testCompressedFiles() throw(logic_error);
+}
+
+
+#endif // IOTEST_HXX
@@ -1,19 +1,74 @@
 ﻿#include "test.hxx"
 
+#include <cstddef>
+#include <cstdlib>
+
+#include <memory>
+#include <random>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "boost/optional.hpp"
 #include "eigen3/Eigen/Core"
 
+#include "../lp/basiscache.hxx"
+#include "../lp/boundedsimplexsolver.hxx"
+#include "../lp/columngenerator.hxx"
+#include "../lp/degeneracystrategy.hxx"
+#include "../lp/dualizationmode.hxx"
+#include "../lp/generalprogramdata.hxx"
 #include "../lp/simplexsolver.hxx"
 #include "../lp/linearprogramdata.hxx"
 #include "../lp/linearprogrammingutils.hxx"
 #include "../lp/linearprogramsolution.hxx"
+#include "../lp/multirhssolution.hxx"
+#include "../lp/multirhssolver.hxx"
+#include "../lp/parametricsolver.hxx"
+#include "../lp/rowsense.hxx"
+#include "../lp/solutioncache.hxx"
 #include "../lp/solutiontype.hxx"
 #include "../math/mathutils.hxx"
 #include "../math/numerictypes.hxx"
 #include "../misc/utils.hxx"
+#include "../config.hxx"
+
+
+#if defined(LP_TEST_MODE) && defined(__GLIBC__)
+//NOTE: The calls to `malloc' (that `operator new' and Eigen call too)
+//are counted by interposing glibc's one
+#define LP_WITH_ALLOCATIONS_COUNT
+
+static std::size_t allocationsCount(0);
+
+extern "C" void* __libc_malloc(std::size_t size);
+extern "C" void* __libc_calloc(std::size_t count, std::size_t size);
+extern "C" void* __libc_realloc(void* pointer, std::size_t size);
+
+extern "C" void*
+malloc(std::size_t size)
+{
+  ++allocationsCount;
+
+  return __libc_malloc(size);
+}
+
+extern "C" void*
+calloc(std::size_t count, std::size_t size)
+{
+  ++allocationsCount;
+
+  return __libc_calloc(count, size);
+}
+
+extern "C" void*
+realloc(void* pointer, std::size_t size)
+{
+  ++allocationsCount;
+
+  return __libc_realloc(pointer, size);
+}
+#endif // LP_TEST_MODE && __GLIBC__
 
 
 namespace Test
@@ -542,4 +597,938 @@ namespace Test
       LOG("A^==\n{0}\nrank=={1}", rref.rref, rref.rank);
     }
   }
+
+
+#ifdef LP_WITH_ALLOCATIONS_COUNT
+  template<typename T>
+  /**
+   * @brief countSolveAllocations
+   * Solves the random programs of the same size (each one three times)
+   * w/ the same solver, i.e. in the same `SimplexWorkspace'.
+   * @return Count of the allocations made by these solves once each
+   * program was solved before.
+   */
+  size_t
+  countSolveAllocations()
+  {
+    const DenseIndex rowsCount(4);
+    const DenseIndex colsCount(8);
+
+    mt19937 generator(1);
+    uniform_int_distribution<int> distribution(-5, 9);
+
+    vector<LinearProgramData<T>> programs;
+    for (size_t k(0); k < 50; ++k)
+    {
+      Matrix<T, 1, Dynamic> c(colsCount);
+      Matrix<T, Dynamic, Dynamic> A(rowsCount, colsCount);
+      Matrix<T, Dynamic, 1> x(colsCount);
+
+      for (DenseIndex j(0); j < colsCount; ++j)
+      {
+        c(j) = T(distribution(generator));
+        x(j) = T(abs(distribution(generator)) + 1);
+
+        for (DenseIndex i(0); i < rowsCount; ++i)
+        {
+          A(i, j) = T(distribution(generator));
+        }
+      }
+
+      //The programs are feasible, so the both phases are done
+      const Matrix<T, Dynamic, 1> b(A * x);
+      programs.emplace_back(c, A, b);
+    }
+
+    SimplexSolver<T> solver;
+    LinearProgramSolution<T> solution;
+
+    for (const LinearProgramData<T>& program : programs)
+    {
+      solver.setLinearProgramData(program);
+      solver.solve(solution);
+    }
+
+    const size_t initialAllocationsCount(allocationsCount);
+
+    for (size_t round(0); round < 3; ++round)
+    {
+      for (const LinearProgramData<T>& program : programs)
+      {
+        solver.setLinearProgramData(program);
+        solver.solve(solution);
+      }
+    }
+
+    return (allocationsCount - initialAllocationsCount);
+  }
+#endif // LP_WITH_ALLOCATIONS_COUNT
+
+
+  /**
+   * @brief testAllocations
+   * Checks that the repeated solves of the programs of the same size
+   * make no allocations (w/o the debug log, that does allocate).
+   */
+  void
+  testAllocations() throw(logic_error)
+  {
+#ifdef LP_WITH_ALLOCATIONS_COUNT
+    const size_t realAllocationsCount(countSolveAllocations<real_t>());
+    const size_t rationalAllocationsCount(
+      countSolveAllocations<rational_t>()
+    );
+
+    LOG(
+      "Allocations: real == {0}, rational == {1}",
+      realAllocationsCount, rationalAllocationsCount
+    );
+
+#ifndef LP_WITH_DEBUG_LOG
+    if (realAllocationsCount != 0 || rationalAllocationsCount != 0)
+    {
+      throw logic_error("Test::testAllocations: assertion failed.");
+    }
+#endif // LP_WITH_DEBUG_LOG
+#endif // LP_WITH_ALLOCATIONS_COUNT
+  }
+
+
+  namespace
+  {
+    /**
+     * @brief exampleProgram
+     * @return The program of the Example 2.2 (it takes a few pivots).
+     */
+    LinearProgramData<rational_t>
+    exampleProgram()
+    {
+      Matrix<rational_t, 1, Dynamic> c(1, 4);
+      c <<
+        -10, 5, 7, -3;
+
+      Matrix<rational_t, Dynamic, Dynamic> A(3, 4);
+      A <<
+        -1, -2, 3, 3,
+        1, 1, 7, 2,
+        2, 2, 8, 1;
+
+      Matrix<rational_t, Dynamic, 1> b(3, 1);
+      b <<
+        rational_t(3, 2),
+        rational_t(7, 2),
+        4;
+
+      return LinearProgramData<rational_t>(c, A, b);
+    }
+
+
+    /**
+     * @brief isSolvedFromCache
+     * @param solutionCache
+     * @param solver Solver that has never solved before.
+     * @return Whether `solver' was left idle, i.e. its solution was taken
+     * from `solutionCache'.
+     */
+    bool
+    isSolvedFromCache(
+      SolutionCache<rational_t>& solutionCache,
+      SimplexSolver<rational_t>& solver
+    )
+    {
+      solutionCache.solve(solver);
+
+      return (solver.statistics().pivotsCount == 0);
+    }
+  }
+
+
+  /**
+   * @brief testSolutionCache
+   * Checks that the same program is only solved from `SolutionCache'
+   * if the solver options that change its solution are the same.
+   */
+  void
+  testSolutionCache() throw(logic_error)
+  {
+    const LinearProgramData<rational_t> linearProgramData(exampleProgram());
+
+    SolutionCache<rational_t> solutionCache;
+
+    SimplexSolver<rational_t> solver(linearProgramData);
+    const bool isSolved(!isSolvedFromCache(solutionCache, solver));
+
+    SimplexSolver<rational_t> sameSolver(linearProgramData);
+    const bool isSameSolvedFromCache(
+      isSolvedFromCache(solutionCache, sameSolver)
+    );
+
+    SimplexSolver<rational_t> lexicographicSolver(linearProgramData);
+    lexicographicSolver.setDegeneracyStrategy(
+      DegeneracyStrategy::Lexicographic
+    );
+    const bool isLexicographicSolved(
+      !isSolvedFromCache(solutionCache, lexicographicSolver)
+    );
+
+    SimplexSolver<rational_t> dualSolver(linearProgramData);
+    dualSolver.setDualizationMode(DualizationMode::Always);
+    const bool isDualSolved(!isSolvedFromCache(solutionCache, dualSolver));
+
+    SimplexSolver<rational_t> warmSolver(linearProgramData);
+    warmSolver.setBasisCache(std::make_shared<BasisCache>());
+    const bool isWarmSolved(!isSolvedFromCache(solutionCache, warmSolver));
+
+    LOG(
+      "Solved: {0}, from cache: {1}, lexicographic solved: {2},"
+      " dual solved: {3}, warm solved: {4}",
+      isSolved, isSameSolvedFromCache, isLexicographicSolved, isDualSolved,
+      isWarmSolved
+    );
+
+    if (
+      !isSolved || !isSameSolvedFromCache || !isLexicographicSolved ||
+      !isDualSolved || !isWarmSolved
+    )
+    {
+      throw logic_error("Test::testSolutionCache: assertion failed.");
+    }
+  }
+
+
+  /**
+   * @brief testBasisCache
+   * Checks that `BasisCache' is hit by the programs of the same structure
+   * only, and that the programs solved from the cached basis have got
+   * the same solutions as the ones solved from scratch.
+   */
+  void
+  testBasisCache() throw(logic_error)
+  {
+    const LinearProgramData<rational_t> linearProgramData(exampleProgram());
+
+    //Same structure, the cached basis stays optimal
+    LinearProgramData<rational_t> scaledProgram(linearProgramData);
+    scaledProgram.constraintsRHS *= rational_t(2);
+
+    //Same structure, the cached basis is only feasible
+    LinearProgramData<rational_t> negatedProgram(linearProgramData);
+    negatedProgram.objectiveFunctionCoeffs *= rational_t(-1);
+
+    //Other structure
+    LinearProgramData<rational_t> otherProgram(linearProgramData);
+    otherProgram.constraintsCoeffs(0, 0) = rational_t(0);
+
+    const std::shared_ptr<BasisCache> basisCache(
+      std::make_shared<BasisCache>()
+    );
+
+    const bool isMissedBefore(
+      !basisCache->find(BasisCache::makeKey(linearProgramData))
+    );
+
+    SimplexSolver<rational_t> solver(linearProgramData);
+    solver.setBasisCache(basisCache);
+    LinearProgramSolution<rational_t> solution;
+    solver.solve(solution);
+
+    const bool isHit(
+      basisCache->find(BasisCache::makeKey(linearProgramData)) &&
+      basisCache->find(BasisCache::makeKey(scaledProgram)) &&
+      basisCache->find(BasisCache::makeKey(negatedProgram))
+    );
+    const bool isMissed(!basisCache->find(BasisCache::makeKey(otherProgram)));
+
+    bool isSame(true);
+
+    for (
+      const LinearProgramData<rational_t>& program :
+      {scaledProgram, negatedProgram}
+    )
+    {
+      SimplexSolver<rational_t> coldSolver(program);
+      LinearProgramSolution<rational_t> coldSolution;
+      const SolutionType coldSolutionType(coldSolver.solve(coldSolution));
+
+      SimplexSolver<rational_t> warmSolver(program);
+      warmSolver.setBasisCache(basisCache);
+      LinearProgramSolution<rational_t> warmSolution;
+      const SolutionType warmSolutionType(warmSolver.solve(warmSolution));
+
+      LOG(
+        "Cold: {0}, x* == {1}, F* == {2}; warm: {3}, x* == {4}, F* == {5}",
+        int(coldSolutionType), coldSolution.extremePoint.transpose(),
+        coldSolution.extremeValue, int(warmSolutionType),
+        warmSolution.extremePoint.transpose(), warmSolution.extremeValue
+      );
+
+      isSame = isSame && coldSolutionType == SolutionType::Optimal &&
+        warmSolutionType == coldSolutionType &&
+        warmSolution.extremePoint == coldSolution.extremePoint &&
+        warmSolution.extremeValue == coldSolution.extremeValue;
+    }
+
+    if (!isMissedBefore || !isHit || !isMissed || !isSame)
+    {
+      throw logic_error("Test::testBasisCache: assertion failed.");
+    }
+  }
+
+
+  namespace
+  {
+    template<typename T>
+    /**
+     * @brief generalExampleProgram
+     * The program w/ every kind of the rows and the bounds:
+     *   min (-x1 - 2x2 + x3 - x4),
+     *   1 <= x1 + x2 + x3 <= 4 (the (<=) row w/ range 3),
+     *   x1 - x2 >= -2,
+     *   x1 - x3 == 5/2,
+     *   0 <= x1 <= 3, x2 is free, -1 <= x3 <= 1, x4 <= -2.
+     * x* == [3/2, 7/2, -1, -2], F* == -15/2.
+     * @return
+     */
+    GeneralProgramData<T>
+    generalExampleProgram()
+    {
+      Matrix<T, 1, Dynamic> c(1, 4);
+      c <<
+        -1, -2, 1, -1;
+
+      Matrix<T, Dynamic, Dynamic> A(3, 4);
+      A <<
+        1, 1, 1, 0,
+        1, -1, 0, 0,
+        1, 0, -1, 0;
+
+      Matrix<T, Dynamic, 1> b(3, 1);
+      b <<
+        4,
+        -2,
+        T(5) / T(2);
+
+      GeneralProgramData<T> ret(
+        c, A, b,
+        {
+          RowSense::LessThanOrEqual, RowSense::GreaterThanOrEqual,
+          RowSense::Equal
+        }
+      );
+
+      ret.constraintsRanges[0] = T(3);
+      ret.upperBounds[0] = T(3);
+      ret.lowerBounds[1] = boost::none;
+      ret.lowerBounds[2] = T(-1);
+      ret.upperBounds[2] = T(1);
+      ret.lowerBounds[3] = boost::none;
+      ret.upperBounds[3] = T(-2);
+
+      return ret;
+    }
+
+
+    template<typename T>
+    /**
+     * @brief checkBoundedSimplexSolver
+     * Solves `generalExampleProgram' and its infeasible and unbounded
+     * variants w/ `BoundedSimplexSolver<T>'.
+     * @return Whether the solutions are the expected ones.
+     */
+    bool
+    checkBoundedSimplexSolver()
+    {
+      const GeneralProgramData<T> generalProgramData(
+        generalExampleProgram<T>()
+      );
+
+      BoundedSimplexSolver<T> solver(generalProgramData);
+      LinearProgramSolution<T> solution;
+      const SolutionType solutionType(solver.solve(solution));
+
+      LOG(
+        "{0}: x* == {1}, F* == {2}",
+        int(solutionType), solution.extremePoint.transpose(),
+        solution.extremeValue
+      );
+
+      Matrix<T, Dynamic, 1> x(4, 1);
+      x <<
+        T(3) / T(2),
+        T(7) / T(2),
+        -1,
+        -2;
+
+      bool ret(
+        solutionType == SolutionType::Optimal &&
+        solution.extremePoint.rows() == x.rows() &&
+        MathUtils::isEqual<T>(solution.extremeValue, T(-15) / T(2))
+      );
+
+      for (DenseIndex j(0); ret && j < x.rows(); ++j)
+      {
+        ret = MathUtils::isEqual<T>(solution.extremePoint(j), x(j));
+      }
+
+      //x1 <= 1 contradicts x1 - x3 == 5/2, x3 <= 1
+      GeneralProgramData<T> infeasibleProgramData(generalProgramData);
+      infeasibleProgramData.upperBounds[0] = T(1);
+      solver.setGeneralProgramData(infeasibleProgramData);
+      ret = ret && solver.solve(solution) == SolutionType::Infeasible;
+
+      //x2 -> -oo w/o the lower limit of the ranged row
+      GeneralProgramData<T> unboundedProgramData(generalProgramData);
+      unboundedProgramData.objectiveFunctionCoeffs(1) = T(2);
+      unboundedProgramData.constraintsRanges[0] = boost::none;
+      solver.setGeneralProgramData(unboundedProgramData);
+      ret = ret && solver.solve(solution) == SolutionType::Unbounded;
+
+      return ret;
+    }
+  }
+
+
+  /**
+   * @brief testBoundedSimplexSolver
+   * Checks `BoundedSimplexSolver' on the general form program w/ the ranged,
+   * (>=) and (==) rows and w/ the boxed, free and upper-bounded variables
+   * (i.e. w/ the implicit slack variables and bounds).
+   */
+  void
+  testBoundedSimplexSolver() throw(logic_error)
+  {
+    if (
+      !checkBoundedSimplexSolver<real_t>() ||
+      !checkBoundedSimplexSolver<rational_t>()
+    )
+    {
+      throw logic_error("Test::testBoundedSimplexSolver: assertion failed.");
+    }
+  }
+
+
+  namespace
+  {
+    /**
+     * @brief sweepBreakpoints
+     * Sweeps the RHS of the program
+     *   min (-x1), x1 + x2 == 2, x1 + x3 == 1 + t
+     * that has got the only breakpoint (x2 leaves the basis) at t == 1.
+     * @param lowerParameter
+     * @param upperParameter
+     * @return The breakpoints, `none' if there is no solution.
+     */
+    optional<ParametricSolution<real_t>>
+    sweepBreakpoints(real_t lowerParameter, real_t upperParameter)
+    {
+      Matrix<real_t, 1, Dynamic> c(1, 3);
+      c <<
+        -1, 0, 0;
+
+      Matrix<real_t, Dynamic, Dynamic> A(2, 3);
+      A <<
+        1, 1, 0,
+        1, 0, 1;
+
+      Matrix<real_t, Dynamic, 1> b(2, 1);
+      b <<
+        2,
+        1;
+
+      Matrix<real_t, Dynamic, 1> delta(2, 1);
+      delta <<
+        0,
+        1;
+
+      ParametricSolver<real_t> solver(LinearProgramData<real_t>(c, A, b));
+      const optional<ParametricSolution<real_t>> ret(
+        solver.sweepRHS(delta, lowerParameter, upperParameter).second
+      );
+
+      if (ret)
+      {
+        LOG(
+          "[{0}; {1}]: t == {2}", lowerParameter, upperParameter,
+          makeString(ret->breakpoints)
+        );
+      }
+
+      return ret;
+    }
+  }
+
+
+  /**
+   * @brief testParametricSolver
+   * Checks that the breakpoint less than `Epsilon' away from either end
+   * of the sweep is snapped onto it, while the one farther away is kept,
+   * and that `F*(t)' is given within `Epsilon' past the last breakpoint.
+   */
+  void
+  testParametricSolver() throw(logic_error)
+  {
+    const real_t epsilon(Config::MathUtils::Epsilon);
+
+    const auto hasBreakpoints(
+      [](
+        const optional<ParametricSolution<real_t>>& solution,
+        const vector<real_t>& breakpoints
+      ) -> bool
+      {
+        if (!solution || solution->breakpoints.size() != breakpoints.size())
+        {
+          return false;
+        }
+
+        for (size_t k(0); k < breakpoints.size(); ++k)
+        {
+          if (!isEqual<real_t>(solution->breakpoints[k], breakpoints[k]))
+          {
+            return false;
+          }
+        }
+
+        return true;
+      }
+    );
+
+    const real_t nearEnd(1 + epsilon / 10);
+    const real_t farEnd(1 + 1E-3);
+    const real_t nearStart(1 - epsilon / 10);
+    const real_t farStart(1 - 1E-3);
+
+    const optional<ParametricSolution<real_t>> nearEndSolution(
+      sweepBreakpoints(0, nearEnd)
+    );
+
+    bool isPassed(
+      hasBreakpoints(nearEndSolution, {0, nearEnd}) &&
+      nearEndSolution->breakpoints.back() == nearEnd &&
+      hasBreakpoints(sweepBreakpoints(0, farEnd), {0, 1, farEnd}) &&
+      hasBreakpoints(sweepBreakpoints(nearStart, 3), {nearStart, 3}) &&
+      hasBreakpoints(sweepBreakpoints(farStart, 3), {farStart, 1, 3})
+    );
+
+    if (isPassed)
+    {
+      const optional<real_t> nearValue(
+        nearEndSolution->extremeValue(nearEnd + epsilon / 10)
+      );
+      const optional<real_t> farValue(
+        nearEndSolution->extremeValue(nearEnd + 1E-3)
+      );
+
+      isPassed = nearValue && isEqual<real_t>(*nearValue, -2) && !farValue;
+    }
+
+    if (!isPassed)
+    {
+      throw logic_error("Test::testParametricSolver: assertion failed.");
+    }
+  }
+
+
+  /**
+   * @brief testMultiRHSSolver
+   * Solves the random programs for many `β' (the feasible, infeasible
+   * and unbounded ones, some w/ the redundant constraints) w/ one
+   * `MultiRHSSolver' and compares every solution w/ the one
+   * of `SimplexSolver' solved from scratch.
+   */
+  void
+  testMultiRHSSolver() throw(logic_error)
+  {
+    const DenseIndex rhsCount(6);
+
+    mt19937 generator(7);
+    uniform_int_distribution<int> distribution(-2, 4);
+
+    MultiRHSSolver<rational_t> solver;
+    size_t mismatchesCount(0);
+
+    for (size_t k(0); k < 60; ++k)
+    {
+      const DenseIndex rowsCount(1 + DenseIndex(k % 4));
+      const DenseIndex colsCount(2 + DenseIndex(k % 5));
+
+      Matrix<rational_t, 1, Dynamic> c(colsCount);
+      Matrix<rational_t, Dynamic, Dynamic> A(rowsCount, colsCount);
+      Matrix<rational_t, Dynamic, Dynamic> B(rowsCount, rhsCount);
+
+      for (DenseIndex j(0); j < colsCount; ++j)
+      {
+        //Some of the programs are unbounded
+        c(j) = rational_t(distribution(generator) + (k % 3 == 0 ? 0 : 2));
+
+        for (DenseIndex i(0); i < rowsCount; ++i)
+        {
+          A(i, j) = rational_t(distribution(generator));
+        }
+      }
+
+      if (k % 7 == 3)
+      {
+        for (DenseIndex i(1); i < rowsCount; ++i)
+        {
+          A.row(i) = A.row(0) * rational_t(i + 1);
+        }
+      }
+
+      for (DenseIndex q(0); q < rhsCount; ++q)
+      {
+        Matrix<rational_t, Dynamic, 1> x(colsCount);
+        for (DenseIndex j(0); j < colsCount; ++j)
+        {
+          x(j) = rational_t(abs(distribution(generator)));
+        }
+
+        //Every other `β' is likely to be infeasible
+        B.col(q) = A * x;
+        if (q % 2 == 1)
+        {
+          B(0, q) += rational_t(distribution(generator));
+        }
+      }
+
+      solver.setLinearProgramData(
+        LinearProgramData<rational_t>(c, A, B.col(0))
+      );
+      const MultiRHSSolution<rational_t> solution(solver.solve(B));
+
+      for (DenseIndex q(0); q < rhsCount; ++q)
+      {
+        SimplexSolver<rational_t> simplexSolver(
+          LinearProgramData<rational_t>(c, A, B.col(q))
+        );
+        LinearProgramSolution<rational_t> simplexSolution;
+        const SolutionType solutionType(simplexSolver.solve(simplexSolution));
+
+        const Matrix<rational_t, Dynamic, 1> x(solution.extremePoints.col(q));
+
+        const bool isSame(
+          solution.solutionTypes[size_t(q)] == solutionType &&
+          (
+            solutionType != SolutionType::Optimal ||
+            (
+              solution.extremeValues(q) == simplexSolution.extremeValue &&
+              (c * x)(0) == solution.extremeValues(q) &&
+              A * x == B.col(q) &&
+              (x.array() >= rational_t(0)).all()
+            )
+          )
+        );
+
+        if (!isSame)
+        {
+          LOG(
+            "Program #{0}, β #{1}: {2} != {3}",
+            k, q, int(solution.solutionTypes[size_t(q)]), int(solutionType)
+          );
+
+          ++mismatchesCount;
+        }
+      }
+    }
+
+    if (mismatchesCount != 0)
+    {
+      throw logic_error("Test::testMultiRHSSolver: assertion failed.");
+    }
+  }
+
+
+  /**
+   * @brief testIncrementalEdits
+   * Makes the random edits (adds and removes the constraints and
+   * the variables, changes the RHS) of the programs solved w/
+   * `SimplexSolver' and compares the solution of every edit w/ the one
+   * of the edited program solved from scratch.
+   */
+  void
+  testIncrementalEdits() throw(logic_error)
+  {
+    mt19937 generator(11);
+    uniform_int_distribution<int> distribution(-3, 4);
+
+    size_t mismatchesCount(0);
+
+    for (size_t k(0); k < 40; ++k)
+    {
+      const DenseIndex rowsCount(1 + DenseIndex(k % 4));
+      const DenseIndex colsCount(2 + DenseIndex(k % 5));
+
+      Matrix<rational_t, 1, Dynamic> c(colsCount);
+      Matrix<rational_t, Dynamic, Dynamic> A(rowsCount, colsCount);
+      Matrix<rational_t, Dynamic, 1> x(colsCount);
+
+      for (DenseIndex j(0); j < colsCount; ++j)
+      {
+        c(j) = rational_t(abs(distribution(generator)));
+        x(j) = rational_t(abs(distribution(generator)));
+
+        for (DenseIndex i(0); i < rowsCount; ++i)
+        {
+          A(i, j) = rational_t(distribution(generator));
+        }
+      }
+
+      //Some of the tableaus have got the redundant rows dropped
+      if (k % 9 == 4 && rowsCount > 1)
+      {
+        A.row(rowsCount - 1) = A.row(0) * rational_t(2);
+      }
+
+      const Matrix<rational_t, Dynamic, 1> b(A * x);
+
+      SimplexSolver<rational_t> solver(LinearProgramData<rational_t>(c, A, b));
+      solver.setSensitivityAnalysisEnabled(k % 3 == 0);
+      LinearProgramSolution<rational_t> solution;
+      solver.solve(solution);
+
+      for (size_t edit(0); edit < 8; ++edit)
+      {
+        const LinearProgramData<rational_t>& linearProgramData(
+          solver.linearProgramData()
+        );
+        const DenseIndex M(linearProgramData.constraintsCount());
+        const DenseIndex N(linearProgramData.variablesCount());
+
+        SolutionType solutionType(SolutionType::Unknown);
+
+        switch ((k + edit) % 5)
+        {
+        case 0:
+          {
+            Matrix<rational_t, 1, Dynamic> coeffs(N);
+            for (DenseIndex j(0); j < N; ++j)
+            {
+              coeffs(j) = rational_t(distribution(generator));
+            }
+
+            solutionType = solver.addConstraint(
+              coeffs, RowSense(edit % 3),
+              rational_t(distribution(generator) + 2), solution
+            );
+
+            break;
+          }
+
+        case 1:
+          solutionType = (
+            M > 1 ?
+              solver.removeConstraint(DenseIndex(edit) % M, solution) :
+              solver.solve(solution)
+          );
+
+          break;
+
+        case 2:
+          {
+            const DenseIndex rowIdx(DenseIndex(edit) % M);
+
+            solutionType = solver.setConstraintRHS(
+              rowIdx,
+              linearProgramData.constraintsRHS(rowIdx) +
+                rational_t(distribution(generator)),
+              solution
+            );
+
+            break;
+          }
+
+        case 3:
+          {
+            Matrix<rational_t, Dynamic, 1> coeffs(M);
+            for (DenseIndex i(0); i < M; ++i)
+            {
+              coeffs(i) = rational_t(distribution(generator));
+            }
+
+            solutionType = solver.addVariable(
+              coeffs, rational_t(distribution(generator)), solution
+            );
+
+            break;
+          }
+
+        default:
+          solutionType = (
+            N > 1 ?
+              solver.removeVariable(DenseIndex(edit) % N, solution) :
+              solver.solve(solution)
+          );
+
+          break;
+        }
+
+        SimplexSolver<rational_t> coldSolver(solver.linearProgramData());
+        coldSolver.setSensitivityAnalysisEnabled(k % 3 == 0);
+        LinearProgramSolution<rational_t> coldSolution;
+        const SolutionType coldSolutionType(coldSolver.solve(coldSolution));
+
+        const LinearProgramData<rational_t>& editedProgramData(
+          solver.linearProgramData()
+        );
+        const Matrix<rational_t, Dynamic, 1>& point(solution.extremePoint);
+
+        const bool isSame(
+          solutionType == coldSolutionType &&
+          (
+            solutionType != SolutionType::Optimal ||
+            (
+              point.rows() == editedProgramData.variablesCount() &&
+              solution.extremeValue == coldSolution.extremeValue &&
+              (editedProgramData.objectiveFunctionCoeffs * point)(0) ==
+                solution.extremeValue &&
+              editedProgramData.constraintsCoeffs * point ==
+                editedProgramData.constraintsRHS &&
+              (point.array() >= rational_t(0)).all() &&
+              bool(solution.sensitivityAnalysis) == (k % 3 == 0)
+            )
+          )
+        );
+
+        if (!isSame)
+        {
+          LOG(
+            "Program #{0}, edit #{1}: {2} != {3}",
+            k, edit, int(solutionType), int(coldSolutionType)
+          );
+
+          ++mismatchesCount;
+        }
+      }
+    }
+
+    if (mismatchesCount != 0)
+    {
+      throw logic_error("Test::testIncrementalEdits: assertion failed.");
+    }
+  }
+
+
+  /**
+   * @brief testColumnGenerator
+   * Solves the random programs (min (c, x), αx <= β) by the column
+   * generation: the master only has got the slack columns at first,
+   * the pricing gives the columns of `α' of the negative reduced costs.
+   * W/ the idle limit of 0 or 1 round the slack columns would be free
+   * long enough to be retired, so checks that they are kept and that
+   * the solutions are the ones of the whole program solved at once.
+   */
+  void
+  testColumnGenerator() throw(logic_error)
+  {
+    using Column = ColumnGenerator<rational_t>::Column;
+
+    mt19937 generator(3);
+    uniform_int_distribution<int> distribution(0, 8);
+
+    size_t mismatchesCount(0);
+
+    for (const uint32_t maxIdleRounds : {0u, 1u})
+    {
+      for (size_t k(0); k < 40; ++k)
+      {
+        const DenseIndex rowsCount(1 + DenseIndex(k % 5));
+        const DenseIndex colsCount(2 + DenseIndex(k % 7));
+
+        //Some of the programs are unbounded
+        const int shift(k % 4 == 0 ? 5 : 2);
+
+        Matrix<rational_t, 1, Dynamic> c(colsCount);
+        Matrix<rational_t, Dynamic, Dynamic> A(rowsCount, colsCount);
+        Matrix<rational_t, Dynamic, 1> b(rowsCount);
+
+        for (DenseIndex i(0); i < rowsCount; ++i)
+        {
+          b(i) = rational_t(distribution(generator));
+
+          for (DenseIndex j(0); j < colsCount; ++j)
+          {
+            A(i, j) = rational_t(distribution(generator) - shift);
+          }
+        }
+
+        for (DenseIndex j(0); j < colsCount; ++j)
+        {
+          c(j) = rational_t(distribution(generator) - 6);
+        }
+
+        //The whole program w/ the slack columns
+        Matrix<rational_t, 1, Dynamic> wholeC(rowsCount + colsCount);
+        wholeC << c, Matrix<rational_t, 1, Dynamic>::Zero(rowsCount);
+        Matrix<rational_t, Dynamic, Dynamic> wholeA(
+          rowsCount, rowsCount + colsCount
+        );
+        wholeA << A, Matrix<rational_t, Dynamic, Dynamic>::Identity(
+          rowsCount, rowsCount
+        );
+
+        SimplexSolver<rational_t> wholeSolver(
+          LinearProgramData<rational_t>(wholeC, wholeA, b)
+        );
+        LinearProgramSolution<rational_t> wholeSolution;
+        const SolutionType wholeSolutionType(
+          wholeSolver.solve(wholeSolution)
+        );
+
+        ColumnGenerator<rational_t> columnGenerator(
+          LinearProgramData<rational_t>(
+            Matrix<rational_t, 1, Dynamic>::Zero(rowsCount),
+            Matrix<rational_t, Dynamic, Dynamic>::Identity(
+              rowsCount, rowsCount
+            ),
+            b
+          ),
+          [&](const Matrix<rational_t, Dynamic, 1>& y) -> vector<Column>
+          {
+            vector<Column> ret;
+
+            for (DenseIndex j(0); j < colsCount; ++j)
+            {
+              if (c(j) - y.dot(A.col(j)) < rational_t(0))
+              {
+                ret.push_back({A.col(j), c(j)});
+              }
+            }
+
+            return ret;
+          }
+        );
+        columnGenerator.setMaxIdleRounds(maxIdleRounds);
+
+        LinearProgramSolution<rational_t> solution;
+        const SolutionType solutionType(columnGenerator.solve(solution));
+
+        bool isSame(
+          solutionType == wholeSolutionType &&
+          (
+            solutionType != SolutionType::Optimal ||
+            solution.extremeValue == wholeSolution.extremeValue
+          )
+        );
+
+        for (DenseIndex i(0); isSame && i < rowsCount; ++i)
+        {
+          isSame = (columnGenerator.columnIds()[size_t(i)] == size_t(i));
+        }
+
+        if (!isSame)
+        {
+          LOG(
+            "Program #{0}, idle limit {1}: {2} != {3}",
+            k, maxIdleRounds, int(solutionType), int(wholeSolutionType)
+          );
+
+          ++mismatchesCount;
+        }
+      }
+    }
+
+    if (mismatchesCount != 0)
+    {
+      throw logic_error("Test::testColumnGenerator: assertion failed.");
+    }
+  }
 }
@@ -39,6 +39,22 @@ namespace Test
   void testUtilities();
 
   void testRREF();
+
+  void testAllocations() throw(logic_error);
+
+  void testSolutionCache() throw(logic_error);
+
+  void testBasisCache() throw(logic_error);
+
+  void testBoundedSimplexSolver() throw(logic_error);
+
+  void testParametricSolver() throw(logic_error);
+
+  void testMultiRHSSolver() throw(logic_error);
+
+  void testIncrementalEdits() throw(logic_error);
+
+  void testColumnGenerator() throw(logic_error);
 }
 
 